@@ -131,6 +131,15 @@ BOOST_AUTO_TEST_CASE(checkHeat1D)
 	BOOST_REQUIRE_CLOSE(val[0], -135508639961461, 0.01);
 	BOOST_REQUIRE_CLOSE(val[1], 80171695638351, 0.01);
 	BOOST_REQUIRE_CLOSE(val[2], 50744437570026, 0.01);
+
+	// The same rate and partials from the temperatures alone
+	double temps[3] = {hConcPtrVec[0][9], hConcPtrVec[1][9], hConcPtrVec[2][9]};
+	double rate =
+		heatHandler.computeTemperatureRate(time, temps, valPointer, hx, hx, hx);
+	BOOST_REQUIRE_CLOSE(rate, 7500434287856011, 0.01);
+	BOOST_REQUIRE_CLOSE(val[0], -135508639961461, 0.01);
+	BOOST_REQUIRE_CLOSE(val[1], 80171695638351, 0.01);
+	BOOST_REQUIRE_CLOSE(val[2], 50744437570026, 0.01);
 }
 
 /**
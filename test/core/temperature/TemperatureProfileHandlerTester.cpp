@@ -82,6 +82,15 @@ BOOST_AUTO_TEST_CASE(check_getTemperature)
 	for (unsigned int j = 0; j < t.size(); j++)
 		BOOST_REQUIRE_CLOSE(tempInterp[j], trueInterp[j], 10e-8);
 
+	// Get the temperatures of several grid points at once
+	std::vector<plsm::SpaceVector<double, 3>> fractions(3, pos);
+	std::vector<double> temperatures;
+	testTemp->getTemperatures(fractions, t[1],
+		network::IReactionNetwork::GridConcentrationsView{}, temperatures);
+	BOOST_REQUIRE_EQUAL(temperatures.size(), 3);
+	for (auto temperature : temperatures)
+		BOOST_REQUIRE_CLOSE(temperature, trueInterp[1], 10e-8);
+
 	// Remove the created file
 	std::string tempFile = "tempFile.dat";
 	std::remove(tempFile.c_str());
@@ -1,6 +1,10 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE Regression
 
+#include <petscts.h>
+
+#include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 
@@ -14,6 +18,95 @@ using namespace std;
 using namespace xolotl;
 using namespace interface;
 
+// Keep Kokkos and PETSc alive between the instances of a test
+using Kokkos::ScopeGuard;
+BOOST_GLOBAL_FIXTURE(ScopeGuard);
+
+struct PetscFixture
+{
+	PetscFixture()
+	{
+		auto& mts = boost::unit_test::framework::master_test_suite();
+		PetscInitialize(&mts.argc, &mts.argv, NULL, NULL);
+	}
+
+	~PetscFixture()
+	{
+		PetscFinalize();
+	}
+};
+BOOST_GLOBAL_FIXTURE(PetscFixture);
+
+/**
+ * Heat a 1D tungsten surface for 100 fixed time steps and return the local
+ * temperatures. The columns of the temperature row of the Jacobian at a
+ * grid point away from the boundaries are returned as well, as offsets in
+ * grid points.
+ */
+std::vector<double>
+runHeat1D(const std::string& heatArgs, std::vector<PetscInt>& rowColumns)
+{
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "vizHandler=dummy" << std::endl
+			  << "petscArgs=-fieldsplit_0_pc_type jacobi "
+				 "-fieldsplit_1_pc_type redundant "
+				 "-pc_fieldsplit_detect_coupling "
+				 "-pc_type fieldsplit "
+				 "-snes_force_iteration "
+				 "-ts_max_snes_failures -1 "
+				 "-ts_adapt_type none "
+				 "-ts_dt 1.0e-6 "
+				 "-ts_max_steps 100 "
+				 "-ts_max_time 1.0e-4 "
+				 "-ts_exact_final_time matchstep "
+			  << heatArgs << std::endl
+			  << "tempHandler=heat" << std::endl
+			  << "tempParam=1.0e-11 400" << std::endl
+			  << "tempGridPower=1.0" << std::endl
+			  << "perfHandler=dummy" << std::endl
+			  << "flux=1.0e3" << std::endl
+			  << "material=W100" << std::endl
+			  << "dimensions=1" << std::endl
+			  << "gridType=geometric" << std::endl
+			  << "gridParam=100 1.1" << std::endl
+			  << "boundary=1 1" << std::endl
+			  << "process=diff" << std::endl
+			  << "netParam=1 0 0 0 0" << std::endl;
+	paramFile.close();
+
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	auto interface = XolotlInterface{cl.argc, cl.argv};
+	interface.solveXolotl();
+	std::remove(parameterFile.c_str());
+
+	// The temperature is the last component
+	IdType dof = interface.getDOF();
+	std::vector<double> concs;
+	auto nPoints = interface.getConcentrations(dof + 1, concs);
+	std::vector<double> temps(nPoints);
+	for (IdType i = 0; i < nPoints; ++i) {
+		temps[i] = concs[i * (dof + 1) + dof];
+	}
+
+	// The temperature row in the middle of the local grid
+	std::array<IdType, 3> start, count, globalSize;
+	interface.getLocalGridBox(start, count, globalSize);
+	PetscInt row = (start[0] + count[0] / 2) * (dof + 1) + dof;
+	Mat J;
+	TSGetRHSJacobian(interface.getTS(), &J, NULL, NULL, NULL);
+	PetscInt nCols;
+	const PetscInt* cols;
+	MatGetRow(J, row, &nCols, &cols, NULL);
+	rowColumns.clear();
+	for (PetscInt n = 0; n < nCols; ++n) {
+		rowColumns.push_back((cols[n] - row) / (dof + 1));
+	}
+	MatRestoreRow(J, row, &nCols, &cols, NULL);
+
+	return temps;
+}
+
 /**
  * Test suite for the interface class.
  */
@@ -59,7 +152,48 @@ BOOST_AUTO_TEST_CASE(simple0D)
 	BOOST_REQUIRE_EQUAL(concVector[0][0][0][10].first, 10);
 	BOOST_REQUIRE_EQUAL(concVector[0][0][0][10].second, 0);
 
+	// The same values through a registered buffer
+	std::vector<double> buffer(2, -1.0);
+	interface.registerConcentrationBuffer(buffer.data(), {0, 10});
+	interface.exportConcentrations();
+	BOOST_REQUIRE_CLOSE(buffer[0], concVector[0][0][0][0].second, 0.01);
+	BOOST_REQUIRE_EQUAL(buffer[1], 0);
+
 	std::remove(parameterFile.c_str());
 }
 
+BOOST_AUTO_TEST_CASE(heatDecoupled1D)
+{
+	// The reference, the heat equation in the time stepper
+	std::vector<PetscInt> columns;
+	auto coupled = runHeat1D("", columns);
+
+	// The neighbors of the temperature are in the Jacobian
+	auto hasColumn = [&columns](PetscInt offset) {
+		return std::find(columns.begin(), columns.end(), offset) !=
+			columns.end();
+	};
+	BOOST_REQUIRE(hasColumn(-1));
+	BOOST_REQUIRE(hasColumn(1));
+	auto maxRise = *std::max_element(coupled.begin(), coupled.end()) - 400.0;
+	BOOST_REQUIRE_GT(maxRise, 1.0);
+
+	// Advanced separately, the Jacobian only keeps the diagonal of the
+	// temperature and the profile follows the reference at this time step
+	auto decoupled = runHeat1D("-heat_decoupled", columns);
+	BOOST_REQUIRE_EQUAL(columns.size(), 1);
+	BOOST_REQUIRE_EQUAL(columns[0], 0);
+	BOOST_REQUIRE_EQUAL(decoupled.size(), coupled.size());
+	for (std::size_t i = 0; i < coupled.size(); ++i) {
+		BOOST_REQUIRE_SMALL(decoupled[i] - coupled[i], 0.02 * maxRise);
+	}
+
+	// Same with several tridiagonal solves per time step
+	auto subSteps = runHeat1D("-heat_decoupled -heat_substeps 4", columns);
+	BOOST_REQUIRE_EQUAL(columns.size(), 1);
+	for (std::size_t i = 0; i < coupled.size(); ++i) {
+		BOOST_REQUIRE_SMALL(subSteps[i] - coupled[i], 0.02 * maxRise);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,119 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/core/network/INetworkHandler.h>
+#include <xolotl/factory/network/NetworkHandlerFactory.h>
+#include <xolotl/interface/AlphaZrSubOptions.h>
+#include <xolotl/options/ConfOptions.h>
+#include <xolotl/test/CommandLine.h>
+#include <xolotl/test/MPITestUtils.h>
+
+using namespace std;
+using namespace xolotl;
+using namespace interface;
+
+using Kokkos::ScopeGuard;
+BOOST_GLOBAL_FIXTURE(ScopeGuard);
+BOOST_GLOBAL_FIXTURE(MPIFixture);
+
+/**
+ * Read the options of an AlphaZr network with many more vacancy clusters
+ * than interstitial ones.
+ */
+void
+readOptions(options::ConfOptions& opts)
+{
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "material=AlphaZr" << std::endl
+			  << "netParam=0 0 0 100 10" << std::endl
+			  << "process=reaction sink" << std::endl
+			  << "perfHandler=dummy" << std::endl;
+	paramFile.close();
+
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+
+	std::remove(parameterFile.c_str());
+}
+
+/**
+ * The number of clusters in the network described by the options.
+ */
+std::size_t
+getNumClusters(const options::IOptions& opts)
+{
+	return factory::network::NetworkHandlerFactory::get(
+		core::network::loadNetworkHandlers)
+		.generate(opts)
+		->getNetwork()
+		->getNumClusters();
+}
+
+/**
+ * This suite is responsible for testing the MaterialSubOptions.
+ */
+BOOST_AUTO_TEST_SUITE(MaterialSubOptions_testSuite)
+
+BOOST_AUTO_TEST_CASE(defaultPartition)
+{
+	options::ConfOptions opts;
+	readOptions(opts);
+	AlphaZrSubOptions subOptions(opts);
+
+	// One sub-instance for the vacancies and one for the interstitials
+	auto partition = subOptions.getDefaultPartition();
+	BOOST_REQUIRE_EQUAL(partition.size(), 2);
+	BOOST_REQUIRE_EQUAL(partition[0].size(), 1);
+	BOOST_REQUIRE_EQUAL(partition[0][0], 0);
+	BOOST_REQUIRE_EQUAL(partition[1].size(), 1);
+	BOOST_REQUIRE_EQUAL(partition[1][0], 1);
+
+	// The vacancies dominate the cost
+	auto maxCost = subOptions.getMaxCost(partition);
+	BOOST_REQUIRE_GT(maxCost, 0.0);
+	BOOST_REQUIRE_EQUAL(maxCost, subOptions.getMaxCost({partition[0]}));
+	BOOST_REQUIRE_GT(maxCost, subOptions.getMaxCost({partition[1]}));
+
+	// Without more blocks the balanced partition is the default one
+	auto balanced = subOptions.getBalancedPartition(1.0e9);
+	BOOST_REQUIRE_EQUAL(subOptions.getMaxCost(balanced), maxCost);
+}
+
+BOOST_AUTO_TEST_CASE(splitSizeRanges)
+{
+	options::ConfOptions opts;
+	readOptions(opts);
+	AlphaZrSubOptions subOptions(opts);
+	auto defaultCost = subOptions.getMaxCost(subOptions.getDefaultPartition());
+
+	// The vacancies are split in 2 size ranges, the interstitials in 2 as
+	// well
+	subOptions.splitSizeRanges(2);
+	auto defaultPartition = subOptions.getDefaultPartition();
+	BOOST_REQUIRE_EQUAL(defaultPartition.size(), 2);
+	BOOST_REQUIRE_EQUAL(defaultPartition[0].size(), 2);
+	BOOST_REQUIRE_EQUAL(subOptions.getMaxCost(defaultPartition), defaultCost);
+
+	// The balanced partition splits the vacancies
+	auto balanced = subOptions.getBalancedPartition(1.0e9);
+	BOOST_REQUIRE_LT(subOptions.getMaxCost(balanced), defaultCost);
+
+	// The sub-instances still cover the whole network
+	std::size_t nClusters = 0;
+	for (auto&& subOpts : subOptions.getSubOptions(balanced)) {
+		nClusters += getNumClusters(*subOpts);
+	}
+	BOOST_REQUIRE_EQUAL(nClusters, getNumClusters(opts));
+
+	// The size ranges of a sub-instance must follow each other
+	subOptions.splitSizeRanges(3);
+	BOOST_REQUIRE_THROW(
+		subOptions.getSubOptions({{0, 2}, {1}, {3, 4, 5}}), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
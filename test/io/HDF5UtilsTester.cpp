@@ -1,6 +1,7 @@
 #define BOOST_TEST_DYN_LINK
 #define BOOST_TEST_MODULE Regression
 
+#include <algorithm>
 #include <memory>
 
 #include <boost/test/framework.hpp>
@@ -300,6 +301,39 @@ BOOST_AUTO_TEST_CASE(checkIO)
 			}
 		}
 
+		// The network is stored as tables that can be read at once
+		BOOST_REQUIRE(networkGroup->isTabular());
+		auto allBounds = networkGroup->readClusterBounds();
+		auto expectedBounds = network.getAllClusterBounds();
+		BOOST_REQUIRE_EQUAL(allBounds.size(), networkSize);
+		for (int i = 0; i < networkSize; i++) {
+			BOOST_REQUIRE_EQUAL_COLLECTIONS(allBounds[i].begin(),
+				allBounds[i].end(), expectedBounds[i].begin(),
+				expectedBounds[i].end());
+		}
+		std::vector<double> formationEnergies, migrationEnergies,
+			diffusionFactors;
+		networkGroup->readClusterProperties(
+			formationEnergies, migrationEnergies, diffusionFactors);
+		BOOST_REQUIRE_EQUAL(formationEnergies.size(), networkSize);
+		for (int i = 0; i < networkSize; i++) {
+			auto cluster = network.getClusterCommon(i);
+			BOOST_REQUIRE_EQUAL(
+				cluster.getFormationEnergy(), formationEnergies[i]);
+			BOOST_REQUIRE_EQUAL(
+				cluster.getMigrationEnergy(), migrationEnergies[i]);
+			BOOST_REQUIRE_EQUAL(
+				cluster.getDiffusionFactor(), diffusionFactors[i]);
+		}
+		auto momentIds = networkGroup->readMomentIds();
+		auto expectedIds = network.getAllMomentIdInfo();
+		BOOST_REQUIRE_EQUAL(momentIds.size(), networkSize);
+		for (int i = 0; i < networkSize; i++) {
+			BOOST_REQUIRE_EQUAL_COLLECTIONS(momentIds[i].begin(),
+				momentIds[i].end(), expectedIds[i].begin(),
+				expectedIds[i].end());
+		}
+
 		// If the HDF5 file contains initial concentrations
 		// TODO Doesn't it always contain initial concentrations if
 		// it has those earlier items?  Or did I put them on timesteps
@@ -634,4 +668,312 @@ BOOST_AUTO_TEST_CASE(checkSurface3D)
 	}
 }
 
+/**
+ * Method checking the dense concentration layout.
+ */
+BOOST_AUTO_TEST_CASE(checkDenseConcentrations)
+{
+	const std::string testFileName = "test_dense.h5";
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	// Each rank owns a slab of a 2D grid
+	const int nXPerRank = 4;
+	const int nY = 3;
+	const int nValues = 6;
+	XFile::TimestepGroup::GridBox globalSize{nXPerRank * commSize, nY, 1};
+	XFile::TimestepGroup::GridBox start{nXPerRank * commRank, 0, 0};
+	XFile::TimestepGroup::GridBox count{nXPerRank, nY, 1};
+
+	// The values, some of them are zero
+	auto value = [](int i, int j, int l) {
+		return (l % 2 == 0) ? 0.0 : 1.0 + 0.1 * i + 10.0 * j + 100.0 * l;
+	};
+	std::vector<double> data;
+	for (int j = 0; j < nY; j++)
+		for (int i = start[0]; i < start[0] + nXPerRank; i++)
+			for (int l = 0; l < nValues; l++)
+				data.push_back(value(i, j, l));
+
+	// Write the compressed dense dataset
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup =
+			concGroup->addTimestepGroup(0, 0, 0, 1.0e-4, 1.0e-5, 1.0e-6);
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(not tsGroup->hasDenseConcentrations());
+
+		tsGroup->writeDenseConcentrations(
+			globalSize, start, count, nValues, data.data(), 4);
+	}
+
+	// Read it back with the different readers
+	{
+		XFile testFile(
+			testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup = concGroup->getLastTimestepGroup();
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(tsGroup->hasDenseConcentrations());
+
+		// Our block
+		int readValues = 0;
+		auto block = tsGroup->readDenseConcentrations(start, count, readValues);
+		BOOST_REQUIRE_EQUAL(readValues, nValues);
+		BOOST_REQUIRE_EQUAL(block.size(), data.size());
+		for (auto n = 0; n < data.size(); n++) {
+			BOOST_REQUIRE_EQUAL(block[n], data[n]);
+		}
+
+		// The first row as ragged data
+		auto concs = tsGroup->readConcentrations(testFile, start[0], nXPerRank);
+		BOOST_REQUIRE_EQUAL(concs.size(), nXPerRank);
+		for (int i = 0; i < nXPerRank; i++) {
+			BOOST_REQUIRE_EQUAL(concs[i].size(), nValues / 2);
+			for (auto const& conc : concs[i]) {
+				BOOST_REQUIRE_EQUAL(
+					conc.second, value(start[0] + i, 0, conc.first));
+			}
+		}
+
+		// A single grid point owned by another rank
+		int i = (nXPerRank * (commRank + 1) + 1) % globalSize[0];
+		auto gridPoint = tsGroup->readGridPoint(i, nY - 1);
+		BOOST_REQUIRE_EQUAL(gridPoint.size(), nValues / 2);
+		for (auto const& conc : gridPoint) {
+			BOOST_REQUIRE_EQUAL(conc[1], value(i, nY - 1, (int)conc[0]));
+		}
+
+		// The same point and our first one with a bulk read
+		std::vector<uint32_t> offsets;
+		auto flatConcs = tsGroup->readGridPoints(testFile, globalSize, 2,
+			{{i, nY - 1, 0}, {start[0], 0, 0}}, offsets);
+		BOOST_REQUIRE_EQUAL(offsets.size(), 3);
+		BOOST_REQUIRE_EQUAL(offsets[1], nValues / 2);
+		BOOST_REQUIRE_EQUAL(offsets[2], nValues);
+		for (auto m = 0; m < offsets[2]; m++) {
+			auto j = (m < offsets[1]) ? nY - 1 : 0;
+			auto x = (m < offsets[1]) ? i : start[0];
+			BOOST_REQUIRE_EQUAL(
+				flatConcs[m].second, value(x, j, flatConcs[m].first));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(checkMultiGroup)
+{
+	const std::string testFileName = "test_multi.h5";
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	// Two sub-instances with a different number of values on the same 1D
+	// grid, only the first rank owns grid points of the second one
+	const int nXPerRank = 5;
+	XFile::MultiGroup::GridBox globalSize{nXPerRank * commSize, 1, 1};
+	std::vector<XFile::MultiGroup::GridBox> starts{
+		{nXPerRank * commRank, 0, 0}, {0, 0, 0}};
+	std::vector<XFile::MultiGroup::GridBox> counts{{nXPerRank, 1, 1},
+		{commRank == 0 ? globalSize[0] : 0, commRank == 0 ? 1 : 0,
+			commRank == 0 ? 1 : 0}};
+	std::vector<int> nValues{3, 7};
+	XFile::MultiGroup::Partition partition{{0, 2}, {1}};
+	std::vector<int> subDOFs{2, 6};
+	std::vector<double> subDts{1.0e-3, 2.0e-3};
+	auto value = [](int id, int i, int l) { return id + 0.1 * i + 10.0 * l; };
+	std::vector<std::vector<double>> data(2);
+	for (int id = 0; id < 2; id++)
+		for (int i = starts[id][0]; i < starts[id][0] + counts[id][0]; i++)
+			for (int l = 0; l < nValues[id]; l++)
+				data[id].push_back(value(id, i, l));
+
+	// Write everything
+	{
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		XFile::MultiGroup multiGroup(testFile, true);
+		multiGroup.writeTimes(12, 3.5, 0.25);
+		multiGroup.writeInstances(partition, 2, subDOFs, subDts);
+		for (int id = 0; id < 2; id++) {
+			multiGroup.writeConcentrations(id, globalSize, starts[id],
+				counts[id], nValues[id], data[id].data());
+		}
+	}
+
+	// Read it back
+	{
+		XFile testFile(
+			testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+		auto multiGroup = testFile.getGroup<XFile::MultiGroup>();
+		BOOST_REQUIRE(multiGroup);
+
+		auto [step, time, dt] = multiGroup->readTimes();
+		BOOST_REQUIRE_EQUAL(step, 12);
+		BOOST_REQUIRE_EQUAL(time, 3.5);
+		BOOST_REQUIRE_EQUAL(dt, 0.25);
+
+		int readSubRanges = 0;
+		std::vector<int> readSubDOFs;
+		std::vector<double> readSubDts;
+		auto readPartition = multiGroup->readInstances(
+			readSubRanges, readSubDOFs, readSubDts);
+		BOOST_REQUIRE(readPartition == partition);
+		BOOST_REQUIRE_EQUAL(readSubRanges, 2);
+		BOOST_REQUIRE(readSubDOFs == subDOFs);
+		BOOST_REQUIRE(readSubDts == subDts);
+
+		// Every rank reads its slab of both of them
+		XFile::MultiGroup::GridBox start{nXPerRank * commRank, 0, 0};
+		XFile::MultiGroup::GridBox count{nXPerRank, 1, 1};
+		for (int id = 0; id < 2; id++) {
+			int readValues = 0;
+			auto block =
+				multiGroup->readConcentrations(id, start, count, readValues);
+			BOOST_REQUIRE_EQUAL(readValues, nValues[id]);
+			BOOST_REQUIRE_EQUAL(block.size(), nXPerRank * nValues[id]);
+			for (int i = 0; i < nXPerRank; i++)
+				for (int l = 0; l < nValues[id]; l++)
+					BOOST_REQUIRE_EQUAL(block[i * nValues[id] + l],
+						value(id, start[0] + i, l));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(checkRaggedRowRanges)
+{
+	const std::string testFileName = "test_ranges.h5";
+
+	// Determine where we are in the MPI world.
+	int commRank = -1;
+	int commSize = -1;
+	MPI_Comm_rank(MPI_COMM_WORLD, &commRank);
+	MPI_Comm_size(MPI_COMM_WORLD, &commSize);
+
+	// A 2D grid, each rank owns a slab along X when writing
+	const int nXPerRank = 3;
+	const int nY = 4;
+	XFile::TimestepGroup::GridBox globalSize{nXPerRank * commSize, nY, 1};
+
+	// The number of values changes with the grid point
+	auto concsAt = [](int i, int j) {
+		XFile::TimestepGroup::Concs1DType::value_type concs;
+		for (int l = 0; l < (i + j) % 3 + 1; l++) {
+			concs.emplace_back(2 * l, 1.0 + 0.1 * i + 10.0 * j + 100.0 * l);
+		}
+		return concs;
+	};
+
+	{
+		XFile::TimestepGroup::GridBox start{nXPerRank * commRank, 0, 0};
+		XFile::TimestepGroup::GridBox count{nXPerRank, nY, 1};
+		XFile::TimestepGroup::Concs1DType concs;
+		for (int j = 0; j < nY; j++)
+			for (int i = start[0]; i < start[0] + nXPerRank; i++)
+				concs.push_back(concsAt(i, j));
+
+		XFile testFile(testFileName, 1, MPI_COMM_WORLD);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto tsGroup =
+			concGroup->addTimestepGroup(0, 0, 0, 1.0e-4, 1.0e-5, 1.0e-6);
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(not tsGroup->hasRaggedConcentrations());
+		tsGroup->writeConcentrations(
+			testFile, globalSize, start, count, concs);
+	}
+
+	// Read it back with a decomposition along Y
+	{
+		XFile testFile(
+			testFileName, MPI_COMM_WORLD, XFile::AccessMode::OpenReadOnly);
+		auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+		BOOST_REQUIRE(concGroup);
+		auto timesteps = concGroup->getTimesteps();
+		BOOST_REQUIRE_EQUAL(timesteps.size(), 1);
+		auto tsGroup = concGroup->getTimestepGroup(
+			timesteps[0][0], timesteps[0][1], timesteps[0][2]);
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(tsGroup->hasRaggedConcentrations());
+
+		// The last rank can be left without rows
+		int nYPerRank = (nY + commSize - 1) / commSize;
+		int yStart = std::min(nYPerRank * commRank, nY);
+		int yCount = std::min(nYPerRank, nY - yStart);
+		XFile::TimestepGroup::GridBox start{0, yStart, 0};
+		XFile::TimestepGroup::GridBox count{globalSize[0], yCount, 1};
+		auto concs =
+			tsGroup->readConcentrations(testFile, globalSize, start, count);
+		BOOST_REQUIRE_EQUAL(concs.size(), globalSize[0] * yCount);
+		auto n = 0;
+		for (int j = yStart; j < yStart + yCount; j++)
+			for (int i = 0; i < globalSize[0]; i++, n++) {
+				auto expected = concsAt(i, j);
+				BOOST_REQUIRE_EQUAL(concs[n].size(), expected.size());
+				for (auto l = 0; l < expected.size(); l++) {
+					BOOST_REQUIRE_EQUAL(concs[n][l].first, expected[l].first);
+					BOOST_REQUIRE_EQUAL(
+						concs[n][l].second, expected[l].second);
+				}
+			}
+
+		// Scattered grid points, in any order and with duplicates
+		std::vector<XFile::TimestepGroup::GridBox> points{{2, nY - 1, 0},
+			{0, 0, 0}, {globalSize[0] - 1, 1, 0}, {0, 0, 0}};
+		std::vector<uint32_t> offsets;
+		auto flatConcs = tsGroup->readGridPoints(
+			testFile, globalSize, 2, points, offsets);
+		BOOST_REQUIRE_EQUAL(offsets.size(), points.size() + 1);
+		for (auto p = 0; p < points.size(); p++) {
+			auto expected = concsAt(points[p][0], points[p][1]);
+			BOOST_REQUIRE_EQUAL(offsets[p + 1] - offsets[p], expected.size());
+			for (auto l = 0; l < expected.size(); l++) {
+				BOOST_REQUIRE_EQUAL(
+					flatConcs[offsets[p] + l].first, expected[l].first);
+				BOOST_REQUIRE_EQUAL(
+					flatConcs[offsets[p] + l].second, expected[l].second);
+			}
+		}
+	}
+}
+
+BOOST_AUTO_TEST_CASE(checkRetention)
+{
+	const std::string testFileName = "test_retention.h5";
+
+	XFile testFile(testFileName, 1, MPI_COMM_WORLD,
+		XFile::AccessMode::CreateOrTruncateIfExists, true);
+	auto concGroup = testFile.getGroup<XFile::ConcentrationGroup>();
+	BOOST_REQUIRE(concGroup);
+
+	// Keep the last two time steps, and every third one
+	for (int n = 0; n < 8; n++) {
+		auto tsGroup =
+			concGroup->addTimestepGroup(0, 0, n, 1.0e-4 * n, 0.0, 1.0e-4);
+		BOOST_REQUIRE(tsGroup);
+		if (n % 3 == 0) {
+			tsGroup->setKept();
+		}
+		tsGroup.reset();
+		concGroup->pruneTimesteps(2);
+	}
+
+	std::vector<int> expected{0, 3, 6, 7};
+	auto timesteps = concGroup->getTimesteps();
+	BOOST_REQUIRE_EQUAL(timesteps.size(), expected.size());
+	for (auto n = 0; n < expected.size(); n++) {
+		BOOST_REQUIRE_EQUAL(timesteps[n][2], expected[n]);
+	}
+	BOOST_REQUIRE_EQUAL(concGroup->getLastTimeStep(), 7);
+	BOOST_REQUIRE(concGroup->getLastTimestepGroup());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -135,7 +135,8 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 		<< "basalPortion=0.6" << std::endl
 		<< "transitionSize=300" << std::endl
 		<< "cascadeDose=5000.0" << std::endl
-		<< "cascadeEfficiency=0.2" << std::endl;
+		<< "cascadeEfficiency=0.2" << std::endl
+		<< "timeIntegration=strang" << std::endl;
 	goodParamFile.close();
 
 	string pathToFile("param_good.txt");
@@ -253,6 +254,9 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 	BOOST_REQUIRE_EQUAL(opts.getCascadeDose(), 5000);
 	BOOST_REQUIRE_EQUAL(opts.getCascadeEfficiency(), 0.2);
 
+	// Check the time integration scheme
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "strang");
+
 	// Check the physical processes option
 	auto map = opts.getProcesses();
 	BOOST_REQUIRE_EQUAL(map["diff"], true);
@@ -310,11 +314,132 @@ BOOST_AUTO_TEST_CASE(goodParamFileNoHDF5)
 	BOOST_REQUIRE_EQUAL(opts.getMaxI(), 3);
 	BOOST_REQUIRE_EQUAL(opts.getMaxPureV(), 5);
 
+	// Check the default time integration scheme
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "coupled");
+
 	// Remove the created file
 	std::string tempFile = "param_good.txt";
 	std::remove(tempFile.c_str());
 }
 
+BOOST_AUTO_TEST_CASE(ensembleParamFile)
+{
+	ConfOptions opts;
+
+	// Create a parameter file for a 0D ensemble
+	std::ofstream paramFile("param_ensemble.txt");
+	paramFile << "dimensions=0" << std::endl
+			  << "ensembleTemp=900 1000 1100" << std::endl
+			  << "ensembleFlux=1.0 0.5 2.0" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_ensemble.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing good options
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_REQUIRE_NO_THROW(opts.readParams(2, argv));
+
+	// Check the members
+	auto temps = opts.getEnsembleTemperatures();
+	BOOST_REQUIRE_EQUAL(temps.size(), 3);
+	BOOST_REQUIRE_EQUAL(temps[0], 900.0);
+	BOOST_REQUIRE_EQUAL(temps[2], 1100.0);
+	auto factors = opts.getEnsembleFluxFactors();
+	BOOST_REQUIRE_EQUAL(factors.size(), 3);
+	BOOST_REQUIRE_EQUAL(factors[1], 0.5);
+
+	// Remove the created file
+	std::string tempFile = "param_ensemble.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(wrongEnsemble)
+{
+	ConfOptions opts;
+
+	// Create a parameter file with members of different sizes
+	std::ofstream paramFile("param_ensemble_wrong.txt");
+	paramFile << "dimensions=0" << std::endl
+			  << "ensembleTemp=900 1000 1100" << std::endl
+			  << "ensembleFlux=1.0 0.5" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_ensemble_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong ensemble
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), InvalidOptionValue);
+
+	// Remove the created file
+	std::string tempFile = "param_ensemble_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(imexTimeIntegration)
+{
+	ConfOptions opts;
+
+	// Create a parameter file with the imex time integration scheme
+	std::ofstream paramFile("param_time_imex.txt");
+	paramFile << "timeIntegration=imex" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_time_imex.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing the imex option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Read the parameter file
+	opts.readParams(2, argv);
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "imex");
+
+	// The scheme names are case sensitive
+	ConfOptions wrongOpts;
+	paramFile.open("param_time_imex.txt");
+	paramFile << "timeIntegration=IMEX" << std::endl;
+	paramFile.close();
+	BOOST_CHECK_THROW(wrongOpts.readParams(2, argv), InvalidOptionValue);
+
+	// Remove the created file
+	std::string tempFile = "param_time_imex.txt";
+	std::remove(tempFile.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(wrongTimeIntegration)
+{
+	ConfOptions opts;
+
+	// Create a parameter file with a wrong time integration scheme
+	std::ofstream paramFile("param_time_wrong.txt");
+	paramFile << "timeIntegration=bogus" << std::endl;
+	paramFile.close();
+
+	string pathToFile("param_time_wrong.txt");
+	string filename = pathToFile;
+	const char* fname = filename.c_str();
+
+	// Build a command line with a parameter file containing a wrong time
+	// integration option
+	const char* argv[] = {"./xolotl", fname};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), InvalidOptionValue);
+
+	// Remove the created file
+	std::string tempFile = "param_time_wrong.txt";
+	std::remove(tempFile.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(wrongPerfHandler)
 {
 	ConfOptions opts;
@@ -133,7 +133,8 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 		<< "\"basalPortion\": 0.6,\n"
 		<< "\"transitionSize\": 300,\n"
 		<< "\"cascadeDose\": 5000.0,\n"
-		<< "\"cascadeEfficiency\": 0.2\n"
+		<< "\"cascadeEfficiency\": 0.2,\n"
+		<< "\"timeIntegration\": \"strang\"\n"
 		<< "}\n";
 	goodParamFile.close();
 
@@ -248,6 +249,9 @@ BOOST_AUTO_TEST_CASE(goodParamFile)
 	BOOST_REQUIRE_EQUAL(opts.getCascadeDose(), 5000);
 	BOOST_REQUIRE_EQUAL(opts.getCascadeEfficiency(), 0.2);
 
+	// Check the time integration scheme
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "strang");
+
 	// Check the physical processes option
 	auto map = opts.getProcesses();
 	BOOST_REQUIRE_EQUAL(map["diff"], true);
@@ -301,6 +305,115 @@ BOOST_AUTO_TEST_CASE(goodParamFileNoHDF5)
 	BOOST_REQUIRE_EQUAL(opts.getMaxI(), 3);
 	BOOST_REQUIRE_EQUAL(opts.getMaxPureV(), 5);
 
+	// Check the default time integration scheme
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "coupled");
+
+	// Remove the created file
+	fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(ensembleParamFile)
+{
+	JSONOptions opts;
+
+	// Create a parameter file for a 0D ensemble
+	std::string fileName = "param_ensemble.json";
+	std::ofstream paramFile(fileName);
+	paramFile << "{\n"
+			  << "\"dimensions\": 0,\n"
+			  << "\"ensembleTemp\": [900, 1000, 1100],\n"
+			  << "\"ensembleFlux\": \"1.0 0.5 2.0\"\n"
+			  << "}\n";
+	paramFile.close();
+
+	// Build a command line with a parameter file containing good options
+	const char* argv[] = {"./xolotl", fileName.c_str()};
+
+	// Attempt to read the parameter file
+	BOOST_REQUIRE_NO_THROW(opts.readParams(2, argv));
+
+	// Check the members
+	auto temps = opts.getEnsembleTemperatures();
+	BOOST_REQUIRE_EQUAL(temps.size(), 3);
+	BOOST_REQUIRE_EQUAL(temps[0], 900.0);
+	BOOST_REQUIRE_EQUAL(temps[2], 1100.0);
+	auto factors = opts.getEnsembleFluxFactors();
+	BOOST_REQUIRE_EQUAL(factors.size(), 3);
+	BOOST_REQUIRE_EQUAL(factors[1], 0.5);
+
+	// Remove the created file
+	fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(wrongEnsemble)
+{
+	JSONOptions opts;
+
+	// Create a parameter file with members of different sizes
+	std::string fileName = "param_ensemble_wrong.json";
+	std::ofstream paramFile(fileName);
+	paramFile << "{\n"
+			  << "\"dimensions\": 0,\n"
+			  << "\"ensembleTemp\": [900, 1000, 1100],\n"
+			  << "\"ensembleFlux\": [1.0, 0.5]\n"
+			  << "}\n";
+	paramFile.close();
+
+	// Build a command line with a parameter file containing a wrong ensemble
+	const char* argv[] = {"./xolotl", fileName.c_str()};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), InvalidOptionValue);
+
+	// Remove the created file
+	fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(imexTimeIntegration)
+{
+	JSONOptions opts;
+
+	// Create a parameter file with the imex time integration scheme
+	std::string fileName = "param_time_imex.json";
+	std::ofstream paramFile(fileName);
+	paramFile << "{ \"timeIntegration\": \"imex\" }\n";
+	paramFile.close();
+
+	// Build a command line with a parameter file containing the imex option
+	const char* argv[] = {"./xolotl", fileName.c_str()};
+
+	// Read the parameter file
+	opts.readParams(2, argv);
+	BOOST_REQUIRE_EQUAL(opts.getTimeIntegrationName(), "imex");
+
+	// The scheme names are case sensitive
+	JSONOptions wrongOpts;
+	paramFile.open(fileName);
+	paramFile << "{ \"timeIntegration\": \"IMEX\" }\n";
+	paramFile.close();
+	BOOST_CHECK_THROW(wrongOpts.readParams(2, argv), InvalidOptionValue);
+
+	// Remove the created file
+	fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(wrongTimeIntegration)
+{
+	JSONOptions opts;
+
+	// Create a parameter file with a wrong time integration scheme
+	std::string fileName = "param_time_wrong.json";
+	std::ofstream paramFile(fileName);
+	paramFile << "{ \"timeIntegration\": \"bogus\" }\n";
+	paramFile.close();
+
+	// Build a command line with a parameter file containing a wrong time
+	// integration option
+	const char* argv[] = {"./xolotl", fileName.c_str()};
+
+	// Attempt to read the parameter file
+	BOOST_CHECK_THROW(opts.readParams(2, argv), InvalidOptionValue);
+
 	// Remove the created file
 	fs::remove(fileName);
 }
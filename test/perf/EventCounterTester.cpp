@@ -45,6 +45,10 @@ BOOST_AUTO_TEST_CASE(checkCounting)
 
 	// Require that the value of this EventCounter is 3
 	BOOST_REQUIRE_EQUAL(3U, tester.getValue());
+
+	// Several events at once
+	tester.increment(4);
+	BOOST_REQUIRE_EQUAL(7U, tester.getValue());
 }
 
 BOOST_AUTO_TEST_SUITE_END()
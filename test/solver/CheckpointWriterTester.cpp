@@ -0,0 +1,201 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <cstdio>
+
+#include <hdf5.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/io/XFile.h>
+#include <xolotl/solver/monitor/CheckpointWriter.h>
+#include <xolotl/util/MPIUtils.h>
+
+using namespace std;
+using namespace xolotl;
+using namespace io;
+using solver::monitor::CheckpointWriter;
+
+// Initialize MPI with the threads needed by the asynchronous writes
+struct ThreadedMPIFixture
+{
+	ThreadedMPIFixture()
+	{
+		auto& mts = boost::unit_test::framework::master_test_suite();
+		auto argv = const_cast<const char**>(mts.argv);
+		util::mpiInit(mts.argc, argv, true);
+	}
+
+	~ThreadedMPIFixture()
+	{
+		MPI_Finalize();
+	}
+};
+BOOST_GLOBAL_FIXTURE(ThreadedMPIFixture);
+
+const int nGridPointsPerRank = 4;
+const int nTimeSteps = 3;
+
+/**
+ * Write a few time steps through the writer. The data is changed right
+ * after each submission, the writes must use the snapshot they were given.
+ */
+void
+writeCheckpoint(CheckpointWriter& writer, const std::string& fileName)
+{
+	int baseX = util::getMPIRank() * nGridPointsPerRank;
+
+	writer.submit(
+		[fileName](MPI_Comm comm) { XFile file(fileName, 1, comm); });
+
+	std::vector<double> grid = {0.0, 0.5, 1.0, 1.5, 2.0};
+	std::vector<double> fluence = {1.0, 5.0};
+	XFile::TimestepGroup::Concs1DType concs(nGridPointsPerRank);
+	for (int step = 0; step < nTimeSteps; ++step) {
+		for (int i = 0; i < nGridPointsPerRank; ++i) {
+			concs[i].clear();
+			for (int j = 0; j <= i; ++j) {
+				concs[i].emplace_back(j, 1.5 * (baseX + j) + step);
+			}
+		}
+		fluence[0] += 1.0;
+
+		writer.waitForSlot();
+		writer.submit([=](MPI_Comm comm) {
+			XFile file(fileName, comm, XFile::AccessMode::OpenReadWrite);
+			auto concGroup = file.getGroup<XFile::ConcentrationGroup>();
+			auto tsGroup = concGroup->addTimestepGroup(
+				0, 0, step, 0.1 * (step + 1), 0.1 * step, 0.1);
+			tsGroup->writeGrid(grid);
+			tsGroup->writeFluence(fluence);
+			tsGroup->writeConcentrations(file, baseX, concs);
+		});
+
+		// Invalidate the local data
+		for (auto& pointConcs : concs) {
+			for (auto& conc : pointConcs) {
+				conc.second = -1.0;
+			}
+		}
+		fluence[1] = -1.0;
+	}
+
+	writer.wait();
+}
+
+/**
+ * Check that two checkpoint files hold the same time steps.
+ */
+void
+checkSameContent(const std::string& fileName, const std::string& refName)
+{
+	int baseX = util::getMPIRank() * nGridPointsPerRank;
+	XFile file(fileName, MPI_COMM_WORLD);
+	XFile refFile(refName, MPI_COMM_WORLD);
+	auto concGroup = file.getGroup<XFile::ConcentrationGroup>();
+	auto refConcGroup = refFile.getGroup<XFile::ConcentrationGroup>();
+	BOOST_REQUIRE(concGroup);
+	BOOST_REQUIRE(refConcGroup);
+	BOOST_REQUIRE_EQUAL(concGroup->getLastTimeStep(), nTimeSteps - 1);
+	BOOST_REQUIRE_EQUAL(refConcGroup->getLastTimeStep(), nTimeSteps - 1);
+
+	for (int step = 0; step < nTimeSteps; ++step) {
+		auto tsGroup = concGroup->getTimestepGroup(0, 0, step);
+		auto refTsGroup = refConcGroup->getTimestepGroup(0, 0, step);
+		BOOST_REQUIRE(tsGroup);
+		BOOST_REQUIRE(refTsGroup);
+
+		auto times = tsGroup->readTimes();
+		auto refTimes = refTsGroup->readTimes();
+		BOOST_REQUIRE_EQUAL(times.first, refTimes.first);
+		BOOST_REQUIRE_EQUAL(times.second, refTimes.second);
+
+		auto grid = tsGroup->readGrid();
+		auto refGrid = refTsGroup->readGrid();
+		BOOST_REQUIRE_EQUAL_COLLECTIONS(
+			grid.begin(), grid.end(), refGrid.begin(), refGrid.end());
+
+		auto fluence = tsGroup->readFluence();
+		auto refFluence = refTsGroup->readFluence();
+		BOOST_REQUIRE_EQUAL_COLLECTIONS(fluence.begin(), fluence.end(),
+			refFluence.begin(), refFluence.end());
+		BOOST_REQUIRE_EQUAL(fluence[0], 2.0 + step);
+		BOOST_REQUIRE_EQUAL(fluence[1], 5.0);
+
+		auto concs =
+			tsGroup->readConcentrations(file, baseX, nGridPointsPerRank);
+		auto refConcs =
+			refTsGroup->readConcentrations(refFile, baseX, nGridPointsPerRank);
+		BOOST_REQUIRE_EQUAL(concs.size(), refConcs.size());
+		for (int i = 0; i < nGridPointsPerRank; ++i) {
+			BOOST_REQUIRE_EQUAL(concs[i].size(), i + 1);
+			BOOST_REQUIRE_EQUAL(concs[i].size(), refConcs[i].size());
+			for (int j = 0; j <= i; ++j) {
+				BOOST_REQUIRE_EQUAL(concs[i][j].first, refConcs[i][j].first);
+				BOOST_REQUIRE_EQUAL(
+					concs[i][j].second, refConcs[i][j].second);
+				BOOST_REQUIRE_EQUAL(
+					concs[i][j].second, 1.5 * (baseX + j) + step);
+			}
+		}
+	}
+}
+
+/**
+ * This suite is responsible for testing the CheckpointWriter.
+ */
+BOOST_AUTO_TEST_SUITE(CheckpointWriter_testSuite)
+
+BOOST_AUTO_TEST_CASE(synchronousFallback)
+{
+	// Without the asynchronous mode the writes are done right away
+	CheckpointWriter writer(false);
+	BOOST_REQUIRE(not writer.isAsync());
+
+	const std::string fileName = "test_checkpoint_sync.h5";
+	bool written = false;
+	writer.submit([&written](MPI_Comm) { written = true; });
+	BOOST_REQUIRE(written);
+
+	writeCheckpoint(writer, fileName);
+	checkSameContent(fileName, fileName);
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if (util::getMPIRank() == 0) {
+		std::remove(fileName.c_str());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(queuedWrite)
+{
+	// The writes are queued when both MPI and HDF5 support threads, they
+	// fall back to the synchronous mode otherwise
+	int threadLevel;
+	MPI_Query_thread(&threadLevel);
+	hbool_t threadSafe = 0;
+	H5is_library_threadsafe(&threadSafe);
+	bool canQueue = threadLevel >= MPI_THREAD_MULTIPLE and threadSafe;
+
+	const std::string fileName = "test_checkpoint_async.h5";
+	const std::string refName = "test_checkpoint_ref.h5";
+	{
+		CheckpointWriter writer(true);
+		BOOST_REQUIRE_EQUAL(writer.isAsync(), canQueue);
+		writeCheckpoint(writer, fileName);
+	}
+	{
+		CheckpointWriter writer(false);
+		writeCheckpoint(writer, refName);
+	}
+
+	// The content does not depend on the mode
+	checkSameContent(fileName, refName);
+
+	MPI_Barrier(MPI_COMM_WORLD);
+	if (util::getMPIRank() == 0) {
+		std::remove(fileName.c_str());
+		std::remove(refName.c_str());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,142 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <petscts.h>
+
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/options/ConfOptions.h>
+#include <xolotl/perf/dummy/DummyHandler.h>
+#include <xolotl/solver/monitor/MonitorScheduler.h>
+
+using namespace std;
+using namespace xolotl;
+using solver::monitor::MonitorScheduler;
+
+struct PetscFixture
+{
+	PetscFixture()
+	{
+		auto& mts = boost::unit_test::framework::master_test_suite();
+		PetscInitialize(&mts.argc, &mts.argv, NULL, NULL);
+	}
+
+	~PetscFixture()
+	{
+		PetscFinalize();
+	}
+};
+BOOST_GLOBAL_FIXTURE(PetscFixture);
+
+/**
+ * The right hand side of du/dt = -u.
+ */
+PetscErrorCode
+decay(TS, PetscReal, Vec u, Vec f, void*)
+{
+	PetscFunctionBeginUser;
+	PetscCall(VecCopy(u, f));
+	PetscCall(VecScale(f, -1.0));
+	PetscFunctionReturn(0);
+}
+
+/**
+ * Record the time steps at which the monitor runs.
+ */
+PetscErrorCode
+recordStep(TS, PetscInt timestep, PetscReal, Vec, void* ctx)
+{
+	PetscFunctionBeginUser;
+	static_cast<std::vector<PetscInt>*>(ctx)->push_back(timestep);
+	PetscFunctionReturn(0);
+}
+
+/**
+ * Take 10 forward Euler steps of 0.1 and return the time steps at which
+ * the monitor with the given name runs.
+ */
+std::vector<PetscInt>
+runMonitor(const std::string& name)
+{
+	options::ConfOptions opts;
+	auto perfHandler = std::make_shared<perf::dummy::DummyHandler>(opts);
+	MonitorScheduler scheduler(perfHandler);
+
+	Vec u;
+	VecCreateSeq(PETSC_COMM_SELF, 1, &u);
+	VecSet(u, 1.0);
+
+	TS ts;
+	TSCreate(PETSC_COMM_SELF, &ts);
+	TSSetType(ts, TSEULER);
+	TSSetRHSFunction(ts, NULL, decay, NULL);
+	TSSetTimeStep(ts, 0.1);
+	TSSetMaxSteps(ts, 10);
+	TSSetMaxTime(ts, 100.0);
+	TSSetExactFinalTime(ts, TS_EXACTFINALTIME_MATCHSTEP);
+
+	std::vector<PetscInt> steps;
+	scheduler.add(ts, name, recordStep, &steps);
+	TSSolve(ts, u);
+
+	TSDestroy(&ts);
+	VecDestroy(&u);
+
+	return steps;
+}
+
+/**
+ * This suite is responsible for testing the MonitorScheduler.
+ */
+BOOST_AUTO_TEST_SUITE(MonitorScheduler_testSuite)
+
+BOOST_AUTO_TEST_CASE(everyStep)
+{
+	// Without cadence the monitor runs at every time step
+	auto steps = runMonitor("plain");
+	std::vector<PetscInt> expected{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+	BOOST_REQUIRE_EQUAL_COLLECTIONS(
+		steps.begin(), steps.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(everySteps)
+{
+	// The first step, the multiples of 4, and the last step
+	PetscOptionsSetValue(NULL, "-steps_every_steps", "4");
+	auto steps = runMonitor("steps");
+	std::vector<PetscInt> expected{0, 4, 8, 10};
+	BOOST_REQUIRE_EQUAL_COLLECTIONS(
+		steps.begin(), steps.end(), expected.begin(), expected.end());
+
+	// The step count does not need to stop on a multiple
+	PetscOptionsSetValue(NULL, "-dense_every_steps", "5");
+	steps = runMonitor("dense");
+	expected = {0, 5, 10};
+	BOOST_REQUIRE_EQUAL_COLLECTIONS(
+		steps.begin(), steps.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(everyTime)
+{
+	// At least 0.35 of simulated time between two runs, then the last step
+	PetscOptionsSetValue(NULL, "-time_every_time", "0.35");
+	auto steps = runMonitor("time");
+	std::vector<PetscInt> expected{0, 4, 8, 10};
+	BOOST_REQUIRE_EQUAL_COLLECTIONS(
+		steps.begin(), steps.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(everyWall)
+{
+	// The wall time cadence is far longer than the run, only the first and
+	// last steps are left
+	PetscOptionsSetValue(NULL, "-wall_every_wall", "3600");
+	auto steps = runMonitor("wall");
+	std::vector<PetscInt> expected{0, 10};
+	BOOST_REQUIRE_EQUAL_COLLECTIONS(
+		steps.begin(), steps.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
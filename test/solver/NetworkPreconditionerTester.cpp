@@ -0,0 +1,222 @@
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE Regression
+
+#include <petscksp.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <xolotl/core/network/FeReactionNetwork.h>
+#include <xolotl/options/ConfOptions.h>
+#include <xolotl/perf/dummy/DummyHandler.h>
+#include <xolotl/solver/NetworkPreconditioner.h>
+#include <xolotl/test/CommandLine.h>
+#include <xolotl/test/Util.h>
+
+using namespace std;
+using namespace xolotl;
+using namespace core;
+using namespace network;
+
+using Kokkos::ScopeGuard;
+BOOST_GLOBAL_FIXTURE(ScopeGuard);
+
+struct PetscFixture
+{
+	PetscFixture()
+	{
+		auto& mts = boost::unit_test::framework::master_test_suite();
+		PetscInitialize(&mts.argc, &mts.argv, NULL, NULL);
+	}
+
+	~PetscFixture()
+	{
+		PetscFinalize();
+	}
+};
+BOOST_GLOBAL_FIXTURE(PetscFixture);
+
+/**
+ * Fill a matrix with the network block at each grid point and a weak
+ * coupling between neighboring grid points.
+ */
+Mat
+createOperator(const IReactionNetwork::SparseFillMap& fillMap,
+	PetscInt blockSize, PetscInt nPoints)
+{
+	Mat A;
+	MatCreate(PETSC_COMM_SELF, &A);
+	MatSetSizes(A, blockSize * nPoints, blockSize * nPoints,
+		blockSize * nPoints, blockSize * nPoints);
+	MatSetType(A, MATSEQAIJ);
+	MatSetBlockSize(A, blockSize);
+	MatSeqAIJSetPreallocation(A, blockSize + 2, NULL);
+
+	for (PetscInt b = 0; b < nPoints; ++b) {
+		auto blockStart = b * blockSize;
+		for (PetscInt r = 0; r < blockSize; ++r) {
+			// Diagonally dominant so that the blocks are well conditioned
+			PetscInt row = blockStart + r;
+			PetscScalar value = 20.0 + r + b;
+			MatSetValue(A, row, row, value, INSERT_VALUES);
+			if (auto it = fillMap.find(r); it != fillMap.end()) {
+				for (auto c : it->second) {
+					if (c == r) {
+						continue;
+					}
+					value = (r > c ? 1.0 : -1.0) / (1.0 + r + c + b);
+					MatSetValue(A, row, blockStart + c, value, INSERT_VALUES);
+				}
+			}
+			// Coupling with the next grid point, ignored by the blocks
+			if (b + 1 < nPoints) {
+				MatSetValue(A, row, row + blockSize, -0.5, INSERT_VALUES);
+			}
+		}
+	}
+	MatAssemblyBegin(A, MAT_FINAL_ASSEMBLY);
+	MatAssemblyEnd(A, MAT_FINAL_ASSEMBLY);
+
+	return A;
+}
+
+/**
+ * This suite is responsible for testing the NetworkPreconditioner.
+ */
+BOOST_AUTO_TEST_SUITE(NetworkPreconditioner_testSuite)
+
+BOOST_AUTO_TEST_CASE(blockJacobi)
+{
+	// Create the option to create a network
+	xolotl::options::ConfOptions opts;
+	// Create a good parameter file
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=3 0 0 3 1" << std::endl
+			  << "process=reaction sink" << std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+
+	std::remove(parameterFile.c_str());
+
+	using NetworkType = FeReactionNetwork;
+	NetworkType network({(NetworkType::AmountType)opts.getMaxImpurity(),
+							(NetworkType::AmountType)opts.getMaxV(),
+							(NetworkType::AmountType)opts.getMaxI()},
+		1, opts);
+	perf::dummy::DummyHandler perfHandler(opts);
+
+	// Build an operator with the network sparsity on 3 grid points
+	const PetscInt blockSize = network.getDOF() + 1;
+	const PetscInt nPoints = 3;
+	IReactionNetwork::SparseFillMap fillMap;
+	network.getDiagonalFill(fillMap);
+	Mat A = createOperator(fillMap, blockSize, nPoints);
+
+	// The right hand side
+	Vec x, yRef, y;
+	MatCreateVecs(A, &x, &yRef);
+	VecDuplicate(yRef, &y);
+	for (PetscInt i = 0; i < blockSize * nPoints; ++i) {
+		VecSetValue(x, i, 1.0 + 0.1 * (i % 7), INSERT_VALUES);
+	}
+	VecAssemblyBegin(x);
+	VecAssemblyEnd(x);
+
+	// Apply the PETSc point-block Jacobi, dense inverse of each block
+	PC pcRef;
+	PCCreate(PETSC_COMM_SELF, &pcRef);
+	PCSetOperators(pcRef, A, A);
+	PCSetType(pcRef, PCPBJACOBI);
+	PCSetUp(pcRef);
+	PCApply(pcRef, x, yRef);
+
+	// Apply the network preconditioner
+	solver::NetworkPreconditioner networkPC(network, perfHandler);
+	PC pc;
+	PCCreate(PETSC_COMM_SELF, &pc);
+	PCSetOperators(pc, A, A);
+	networkPC.attach(pc);
+	PCSetUp(pc);
+	PCApply(pc, x, y);
+
+	// Both block solves should give the same result
+	const PetscScalar *yRefArray, *yArray;
+	VecGetArrayRead(yRef, &yRefArray);
+	VecGetArrayRead(y, &yArray);
+	for (PetscInt i = 0; i < blockSize * nPoints; ++i) {
+		BOOST_REQUIRE_CLOSE(yArray[i], yRefArray[i], 1.0e-8);
+	}
+	VecRestoreArrayRead(yRef, &yRefArray);
+	VecRestoreArrayRead(y, &yArray);
+
+	PCDestroy(&pc);
+	PCDestroy(&pcRef);
+	VecDestroy(&x);
+	VecDestroy(&y);
+	VecDestroy(&yRef);
+	MatDestroy(&A);
+}
+
+BOOST_AUTO_TEST_CASE(outerIterations)
+{
+	// Create the option to create a network
+	xolotl::options::ConfOptions opts;
+	// Create a good parameter file
+	std::string parameterFile = "param.txt";
+	std::ofstream paramFile(parameterFile);
+	paramFile << "netParam=3 0 0 3 1" << std::endl
+			  << "process=reaction sink" << std::endl;
+	paramFile.close();
+
+	// Create a fake command line to read the options
+	test::CommandLine<2> cl{{"fakeXolotlAppNameForTests", parameterFile}};
+	opts.readParams(cl.argc, cl.argv);
+
+	std::remove(parameterFile.c_str());
+
+	using NetworkType = FeReactionNetwork;
+	NetworkType network({(NetworkType::AmountType)opts.getMaxImpurity(),
+							(NetworkType::AmountType)opts.getMaxV(),
+							(NetworkType::AmountType)opts.getMaxI()},
+		1, opts);
+	perf::dummy::DummyHandler perfHandler(opts);
+
+	const PetscInt blockSize = network.getDOF() + 1;
+	const PetscInt nPoints = 3;
+	IReactionNetwork::SparseFillMap fillMap;
+	network.getDiagonalFill(fillMap);
+	Mat A = createOperator(fillMap, blockSize, nPoints);
+
+	Vec x, y, r;
+	MatCreateVecs(A, &x, &y);
+	VecDuplicate(y, &r);
+	VecSet(x, 1.0);
+
+	// The outer iterations recover the coupling between grid points, the
+	// result should solve the full system
+	solver::NetworkPreconditioner networkPC(network, perfHandler, 20);
+	PC pc;
+	PCCreate(PETSC_COMM_SELF, &pc);
+	PCSetOperators(pc, A, A);
+	networkPC.attach(pc);
+	PCSetUp(pc);
+	PCApply(pc, x, y);
+
+	// Check the residual
+	MatMult(A, y, r);
+	VecAXPY(r, -1.0, x);
+	PetscReal norm;
+	VecNorm(r, NORM_INFINITY, &norm);
+	BOOST_REQUIRE_SMALL(norm, 1.0e-10);
+
+	PCDestroy(&pc);
+	VecDestroy(&x);
+	VecDestroy(&y);
+	VecDestroy(&r);
+	MatDestroy(&A);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
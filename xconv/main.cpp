@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <cassert>
 #include <iostream>
+#include <limits>
 #include <string>
 
 #include <boost/program_options.hpp>
@@ -7,6 +10,56 @@
 
 namespace bpo = boost::program_options;
 
+using xolotl::io::XFile;
+
+/**
+ * Convert the concentrations of a time step to the ragged representation.
+ * The grid is split in slices along its slowest direction, each process
+ * converts its slice with collective reads and writes.
+ *
+ * @param xfile The file
+ * @param tsGroup The time step to convert
+ * @param rank Our rank
+ * @param size The number of processes
+ */
+void
+convertTimestep(const XFile& xfile, const XFile::TimestepGroup& tsGroup,
+	int rank, int size)
+{
+	auto globalSize = tsGroup.readGlobalSize();
+
+	// Split the slowest direction with more than one grid point
+	int dir = (globalSize[2] > 1) ? 2 : (globalSize[1] > 1) ? 1 : 0;
+	XFile::TimestepGroup::GridBox start{0, 0, 0};
+	auto count = globalSize;
+	int nPerProc = (globalSize[dir] + size - 1) / size;
+	start[dir] = std::min(nPerProc * rank, globalSize[dir]);
+	count[dir] = std::min(nPerProc, globalSize[dir] - start[dir]);
+
+	// Read our slice in one request
+	std::vector<XFile::TimestepGroup::GridBox> points;
+	for (auto k = start[2]; k < start[2] + count[2]; ++k)
+		for (auto j = start[1]; j < start[1] + count[1]; ++j)
+			for (auto i = start[0]; i < start[0] + count[0]; ++i) {
+				points.push_back({i, j, k});
+			}
+	std::vector<uint32_t> offsets;
+	// The dimension follows the slowest direction with more than one point
+	int dim = dir + 1;
+	auto flatConcs =
+		tsGroup.readGridPoints(xfile, globalSize, dim, points, offsets);
+
+	// Store into our ragged 2D representation.
+	XFile::TimestepGroup::Concs1DType concs;
+	for (auto n = 0; n + 1 < offsets.size(); ++n) {
+		concs.emplace_back(flatConcs.begin() + offsets[n],
+			flatConcs.begin() + offsets[n + 1]);
+	}
+
+	// Write the dataset to the file.
+	tsGroup.writeConcentrations(xfile, globalSize, start, count, concs);
+}
+
 int
 main(int argc, char* argv[])
 {
@@ -21,31 +74,32 @@ main(int argc, char* argv[])
 		MPI_Comm_rank(MPI_COMM_WORLD, &cwRank);
 		MPI_Comm_size(MPI_COMM_WORLD, &cwSize);
 
-		// We have to be an MPI program,
-		// but for now we only support a single process.
-		if (cwSize > 1) {
-			throw std::runtime_error(
-				"Multiple MPI processes not yet supported.  Run with 1 proc.");
-		}
-
 		// Parse the command line options.
 		bool shouldRun = true;
 		bpo::options_description desc("Supported options");
 		desc.add_options()("help", "show this help message")(
-			"infile", bpo::value<std::string>(), "input file name");
+			"infile", bpo::value<std::string>(), "input file name")(
+			"all", "convert all the time steps instead of the last one")(
+			"first", bpo::value<int>(),
+			"first time step to convert (implies --all)")("last",
+			bpo::value<int>(), "last time step to convert (implies --all)");
 
 		bpo::variables_map opts;
 		bpo::store(bpo::parse_command_line(argc, argv, desc), opts);
 		bpo::notify(opts);
 
 		if (opts.count("help")) {
-			std::cout << desc << '\n';
+			if (cwRank == 0) {
+				std::cout << desc << '\n';
+			}
 			shouldRun = false;
 		}
 
 		if ((opts.count("infile") == 0) or
 			opts["infile"].as<std::string>().empty()) {
-			std::cerr << "input file name must not be empty" << std::endl;
+			if (cwRank == 0) {
+				std::cerr << "input file name must not be empty" << std::endl;
+			}
 			shouldRun = false;
 			ret = 1;
 		}
@@ -54,50 +108,50 @@ main(int argc, char* argv[])
 			std::string fname = opts["infile"].as<std::string>();
 
 			// Open the file.
-			xolotl::io::XFile xfile(fname, MPI_COMM_WORLD,
-				xolotl::io::XFile::AccessMode::OpenReadWrite);
-
-			// Determine the last timestep written to the file.
-			auto concGroup =
-				xfile.getGroup<xolotl::io::XFile::ConcentrationGroup>();
+			XFile xfile(
+				fname, MPI_COMM_WORLD, XFile::AccessMode::OpenReadWrite);
+			auto concGroup = xfile.getGroup<XFile::ConcentrationGroup>();
 			assert(concGroup);
-			xolotl::io::HDF5File::Attribute<int> lastTimestepAttr(
-				*concGroup, "lastTimeStep");
-			auto lastTimeStep = lastTimestepAttr.get();
-
-			std::cout << "last time step: " << lastTimeStep << std::endl;
-
-			// Open the timestep group associated with the
-			// last written timestep.
-			auto tsGroup = concGroup->getLastTimestepGroup();
-			assert(tsGroup);
-
-			xolotl::io::HDF5File::Attribute<int> nxAttr(*tsGroup, "nx");
-			auto nx = nxAttr.get();
-
-			// Convert the last written timestep's concentrations to
-			// the new representation.
-			xolotl::io::XFile::TimestepGroup::Concs1DType allConcs(nx);
-			for (auto x = 0; x < nx; ++x) {
-				// Read the concentrations for the current position.
-				std::ostringstream dsNameStr;
-				dsNameStr << "position_" << x << "-1_-1";
-				std::string dsName = dsNameStr.str();
-				std::cout << "Reading conc data for gridpoint " << x
-						  << " from dataset " << dsName << std::endl;
-				auto oldData = tsGroup->readGridPoint(x);
-				auto nConcs = oldData.size();
-
-				// Store into our ragged 2D representation.
-				for (auto i = 0; i < nConcs; ++i) {
-					auto l = oldData[i][0];
-					auto conc = oldData[i][1];
-					allConcs[x].emplace_back(l, conc);
+
+			// Select the time steps to convert, the last one by default
+			std::vector<std::array<int, 3>> timesteps;
+			bool convertAll = opts.count("all") or opts.count("first") or
+				opts.count("last");
+			if (convertAll) {
+				int first = opts.count("first") ? opts["first"].as<int>() : 0;
+				int last = opts.count("last") ? opts["last"].as<int>() :
+												std::numeric_limits<int>::max();
+				for (auto const& ids : concGroup->getTimesteps()) {
+					if (ids[2] >= first and ids[2] <= last) {
+						timesteps.push_back(ids);
+					}
 				}
 			}
+			else if (concGroup->hasTimesteps()) {
+				timesteps.push_back({concGroup->getLastControlStep(),
+					concGroup->getLastLoop(), concGroup->getLastTimeStep()});
+			}
 
-			// Write the dataset to the file.
-			tsGroup->writeConcentrations(xfile, 0, allConcs);
+			for (auto const& ids : timesteps) {
+				auto tsGroup =
+					concGroup->getTimestepGroup(ids[0], ids[1], ids[2]);
+				assert(tsGroup);
+
+				// Nothing to do if it is already converted
+				if (tsGroup->hasRaggedConcentrations()) {
+					if (cwRank == 0) {
+						std::cout << "Skipping " << tsGroup->getName()
+								  << ", already converted" << std::endl;
+					}
+					continue;
+				}
+
+				if (cwRank == 0) {
+					std::cout << "Converting " << tsGroup->getName()
+							  << std::endl;
+				}
+				convertTimestep(xfile, *tsGroup, cwRank, cwSize);
+			}
 		}
 	}
 	catch (std::exception& e) {
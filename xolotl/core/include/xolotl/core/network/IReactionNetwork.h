@@ -9,6 +9,7 @@
 #include <xolotl/core/network/SpeciesId.h>
 #include <xolotl/core/network/detail/ClusterConnectivity.h>
 #include <xolotl/core/network/detail/ClusterData.h>
+#include <xolotl/core/network/detail/ConstantConnectivity.h>
 #include <xolotl/core/network/detail/ReactionData.h>
 #include <xolotl/util/Array.h>
 
@@ -33,7 +34,7 @@ public:
 	using FluxesView = Kokkos::View<double*, Kokkos::MemoryUnmanaged>;
 	using OwnedFluxesView = Kokkos::View<double*>;
 	using RatesView = Kokkos::View<double*>;
-	using ConnectivitiesView = Kokkos::View<bool**>;
+	using ConnectivitiesView = detail::ConstantConnectivity;
 	using ConnectivitiesPairView = Kokkos::View<IndexType*>;
 	using SubMapView = Kokkos::View<AmountType*, Kokkos::MemoryUnmanaged>;
 	using OwnedSubMapView = Kokkos::View<AmountType*>;
@@ -48,6 +49,27 @@ public:
 	using ConnectivitiesPair =
 		std::pair<std::vector<IdType>, std::vector<IdType>>;
 	using PhaseSpace = std::vector<std::string>;
+	using GridConcentrationsView = Kokkos::View<const double**,
+		Kokkos::LayoutRight, Kokkos::MemoryUnmanaged>;
+	using GridFluxesView =
+		Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::MemoryUnmanaged>;
+	using GridRatesView = Kokkos::View<double**, Kokkos::LayoutRight>;
+
+	/**
+	 * @brief Description of one grid point for the batched flux and partial
+	 * derivative computations.
+	 */
+	struct GridPoint
+	{
+		//! The row of the point in the concentration array
+		IndexType concentrationRow;
+		//! The row in the fluxes array, or the first index in the values
+		IndexType outputOffset;
+		//! The grid index for the rates
+		IndexType gridIndex;
+		double surfaceDepth;
+		double spacing;
+	};
 
 	KOKKOS_INLINE_FUNCTION
 	static constexpr IndexType
@@ -456,6 +478,31 @@ public:
 		Kokkos::View<double*> values, IndexType gridIndex = 0,
 		double surfaceDepth = 0.0, double spacing = 0.0) = 0;
 
+	/**
+	 * @brief Same as computeAllFluxes but for a set of grid points at once.
+	 * The grid points are distributed over Kokkos teams and the reactions
+	 * over the threads of each team.
+	 *
+	 * @param concentrations The concentrations, one row per grid point
+	 * @param fluxes The fluxes, one row per grid point
+	 * @param points The description of each grid point to compute
+	 */
+	virtual void
+	computeGridFluxes(GridConcentrationsView concentrations,
+		GridFluxesView fluxes, const std::vector<GridPoint>& points) = 0;
+
+	/**
+	 * @brief Same as computeAllPartials but for a set of grid points at once.
+	 *
+	 * @param concentrations The concentrations, one row per grid point
+	 * @param values The partial derivatives, the values of each grid point
+	 * start at its outputOffset
+	 * @param points The description of each grid point to compute
+	 */
+	virtual void
+	computeGridPartials(GridConcentrationsView concentrations,
+		Kokkos::View<double*> values, const std::vector<GridPoint>& points) = 0;
+
 	/**
 	 * @brief Updates the rates view with the rates from all the
 	 * reactions at this grid point, this is for multiple instances use.
@@ -466,11 +513,26 @@ public:
 		double spacing = 0.0) = 0;
 
 	/**
-	 * @brief Updates the rates view with the rates from all the
-	 * reactions at this grid point, this is for multiple instances use.
+	 * @brief Same as computeConstantRates but for a set of grid points at
+	 * once. The rates are accumulated so they should be zeroed beforehand.
+	 *
+	 * @param concentrations The concentrations, one row per grid point
+	 * @param rates The rates, one row per grid point
+	 * @param subId The sub network
+	 * @param points The description of each grid point to compute
 	 */
 	virtual void
-	getConstantConnectivities(ConnectivitiesView conns, IndexType subId) = 0;
+	computeGridConstantRates(GridConcentrationsView concentrations,
+		GridRatesView rates, IndexType subId,
+		const std::vector<GridPoint>& points) = 0;
+
+	/**
+	 * @brief Returns the sparse connectivity (rows and entries) of the
+	 * constant rates of the given sub-network, this is for multiple instances
+	 * use. The last column stands for the constant term.
+	 */
+	virtual ConnectivitiesPair
+	getConstantConnectivities(IndexType subId) = 0;
 
 	/**
 	 * @brief Returns the largest computed rate.
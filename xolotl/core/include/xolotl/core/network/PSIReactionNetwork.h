@@ -94,6 +94,13 @@ public:
 	void
 	selectTrapMutationReactions(double surfaceDepth, double spacing);
 
+	bool
+	hasPointwisePreProcess() const
+	{
+		// The trap-mutation reactions depend on the depth of each point
+		return this->_enableTrapMutation;
+	}
+
 	void
 	computeFluxesPreProcess(ConcentrationsView concentrations,
 		FluxesView fluxes, IndexType gridIndex, double surfaceDepth,
@@ -94,6 +94,10 @@ public:
 	using ConnectivitiesPair = IReactionNetwork::ConnectivitiesPair;
 	using PhaseSpace = IReactionNetwork::PhaseSpace;
 	using TotalQuantity = IReactionNetwork::TotalQuantity;
+	using GridConcentrationsView = IReactionNetwork::GridConcentrationsView;
+	using GridFluxesView = IReactionNetwork::GridFluxesView;
+	using GridRatesView = IReactionNetwork::GridRatesView;
+	using GridPoint = IReactionNetwork::GridPoint;
 
 	template <typename PlsmContext>
 	using Cluster = Cluster<TImpl, PlsmContext>;
@@ -494,6 +498,26 @@ public:
 		Kokkos::View<double*> values, IndexType gridIndex = 0,
 		double surfaceDepth = 0.0, double spacing = 0.0) override;
 
+	/**
+	 * @brief Whether the pre-processing of the fluxes and partials depends on
+	 * the grid point, in which case the grid points can't be computed in the
+	 * same kernel.
+	 */
+	bool
+	hasPointwisePreProcess() const
+	{
+		return false;
+	}
+
+	void
+	computeGridFluxes(GridConcentrationsView concentrations,
+		GridFluxesView fluxes, const std::vector<GridPoint>& points) final;
+
+	void
+	computeGridPartials(GridConcentrationsView concentrations,
+		Kokkos::View<double*> values,
+		const std::vector<GridPoint>& points) final;
+
 	void
 	computeConstantRatesPreProcess(
 		ConcentrationsView, IndexType, double, double)
@@ -506,7 +530,12 @@ public:
 		double spacing = 0.0) final;
 
 	void
-	getConstantConnectivities(ConnectivitiesView conns, IndexType subId) final;
+	computeGridConstantRates(GridConcentrationsView concentrations,
+		GridRatesView rates, IndexType subId,
+		const std::vector<GridPoint>& points) final;
+
+	ConnectivitiesPair
+	getConstantConnectivities(IndexType subId) final;
 
 	template <typename TReaction>
 	void
@@ -785,6 +814,9 @@ private:
 	void
 	generateDiagonalFill(const Connectivity& connectivity);
 
+	Kokkos::View<const GridPoint*>
+	copyGridPoints(const std::vector<GridPoint>& points);
+
 private:
 	std::optional<SubpavingMirror> _subpavingMirror;
 
@@ -792,6 +824,10 @@ private:
 
 	std::vector<BelongingView> isInSub;
 	std::vector<OwnedSubMapView> backMap;
+	std::vector<IndexType> subDOFs;
+
+	// Device copy of the grid points for the batched computations
+	Kokkos::View<GridPoint*> _gridPoints;
 
 protected:
 	std::optional<ClusterDataMirror> _clusterDataMirror;
@@ -60,12 +60,24 @@ public:
 		double impurityRadius) const noexcept;
 
 private:
+	/**
+	 * Read the size range of the selected clusters of each species.
+	 */
+	void
+	setSizeRanges(const options::IOptions& options);
+
 	AmountType _maxV;
 	AmountType _maxB;
 	AmountType _maxI;
 	AmountType _groupingMin;
 	AmountType _groupingWidth;
 	AmountType _transitionSize;
+	AmountType _minSelectV;
+	AmountType _maxSelectV;
+	AmountType _minSelectB;
+	AmountType _maxSelectB;
+	AmountType _minSelectI;
+	AmountType _maxSelectI;
 };
 } // namespace network
 } // namespace core
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/core/network/detail/ClusterConnectivity.h>
+
+namespace xolotl
+{
+namespace core
+{
+namespace network
+{
+namespace detail
+{
+/**
+ * @brief Collects the constant connectivity of a sub-network in a sparse
+ * ClusterConnectivity. The reactions use it as a boolean matrix,
+ * conns(rowId, columnId) = true, where the column extent(0) stands for the
+ * constant term. Depending on the state of the underlying connectivity, the
+ * assignment either counts the entry of the row or fills it.
+ */
+class ConstantConnectivity
+{
+public:
+	using IndexType = ReactionNetworkIndexType;
+	using Connectivity = ClusterConnectivity<>;
+
+	/**
+	 * @brief Proxy for one element of the matrix.
+	 */
+	class Element
+	{
+	public:
+		KOKKOS_INLINE_FUNCTION
+		Element(const Connectivity& connectivity, IndexType rowId,
+			IndexType columnId) :
+			_connectivity(connectivity),
+			_rowId(rowId),
+			_columnId(columnId)
+		{
+		}
+
+		KOKKOS_INLINE_FUNCTION
+		void
+		operator=(bool value) const
+		{
+			if (value) {
+				_connectivity.add(_rowId, _columnId);
+			}
+		}
+
+	private:
+		const Connectivity& _connectivity;
+		IndexType _rowId;
+		IndexType _columnId;
+	};
+
+	ConstantConnectivity() = default;
+
+	ConstantConnectivity(const Connectivity& connectivity, IndexType nRows) :
+		_connectivity(connectivity),
+		_nRows(nRows)
+	{
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	IndexType
+	extent(int) const
+	{
+		return _nRows;
+	}
+
+	KOKKOS_INLINE_FUNCTION
+	Element
+	operator()(IndexType rowId, IndexType columnId) const
+	{
+		return Element(_connectivity, rowId, columnId);
+	}
+
+private:
+	Connectivity _connectivity;
+	IndexType _nRows{};
+};
+} // namespace detail
+} // namespace network
+} // namespace core
+} // namespace xolotl
@@ -634,6 +634,33 @@ public:
 			DEVICE_LAMBDA(const IndexType i) { func(view[i]); });
 	}
 
+	/**
+	 * @brief Perform a hierarchical Kokkos parallel_for: each team of the
+	 * league handles one batch index and the threads of the team share all
+	 * the elements in the collection
+	 *
+	 * The callable should be of the form
+	 * `void f(IndexType batchIndex, ElemType&& elem)`.
+	 */
+	template <typename F>
+	void
+	forEachTeam(const std::string& label, IndexType batchSize, const F& func)
+	{
+		using TeamPolicy = Kokkos::TeamPolicy<>;
+		using TeamMember = TeamPolicy::member_type;
+		auto chain = _chain;
+		auto numElems = _numElems;
+		Kokkos::parallel_for(
+			label, TeamPolicy(batchSize, Kokkos::AUTO),
+			DEVICE_LAMBDA(const TeamMember& team) {
+				const IndexType b = team.league_rank();
+				Kokkos::parallel_for(Kokkos::TeamThreadRange(team, numElems),
+					[&](const IndexType i) {
+						chain.apply([&](auto&& elem) { func(b, elem); }, i);
+					});
+			});
+	}
+
 	/**
 	 * @brief Apply a function for each distinct element type
 	 */
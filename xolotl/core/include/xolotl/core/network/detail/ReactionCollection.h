@@ -203,6 +203,13 @@ public:
 		_reactions.forEach(label, func);
 	}
 
+	template <typename F>
+	void
+	forEachTeam(const std::string& label, IndexType batchSize, const F& func)
+	{
+		_reactions.forEachTeam(label, batchSize, func);
+	}
+
 	template <typename TReaction, typename F>
 	void
 	forEachOn(const F& func)
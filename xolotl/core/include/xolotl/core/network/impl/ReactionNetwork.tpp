@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include <xolotl/core/Constants.h>
 #include <xolotl/core/network/detail/ReactionGenerator.h>
 #include <xolotl/core/network/detail/TupleUtility.h>
@@ -435,6 +437,7 @@ ReactionNetwork<TImpl>::initializeClusterMap(
 
 		isInSub.push_back(localIsInSub);
 		backMap.push_back(localBackMap);
+		subDOFs.push_back(subDOF);
 	}
 }
 
@@ -585,6 +588,105 @@ ReactionNetwork<TImpl>::computeAllPartials(ConcentrationsView concentrations,
 	Kokkos::fence();
 }
 
+template <typename TImpl>
+Kokkos::View<const typename ReactionNetwork<TImpl>::GridPoint*>
+ReactionNetwork<TImpl>::copyGridPoints(const std::vector<GridPoint>& points)
+{
+	const IndexType nPoints = points.size();
+	if (_gridPoints.extent(0) < nPoints) {
+		_gridPoints = Kokkos::View<GridPoint*>(
+			Kokkos::ViewAllocateWithoutInitializing("Grid Points"), nPoints);
+	}
+	auto dPoints = subview(_gridPoints, std::make_pair(IndexType{0}, nPoints));
+	Kokkos::View<const GridPoint*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+		hPoints(points.data(), nPoints);
+	deep_copy(dPoints, hPoints);
+	return dPoints;
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::computeGridFluxes(GridConcentrationsView concentrations,
+	GridFluxesView fluxes, const std::vector<GridPoint>& points)
+{
+	// The pre-processing can't be done for all the points at once
+	if (asDerived()->hasPointwisePreProcess()) {
+		for (auto&& point : points) {
+			computeAllFluxes(
+				subview(concentrations, point.concentrationRow, Kokkos::ALL),
+				subview(fluxes, point.outputOffset, Kokkos::ALL),
+				point.gridIndex, point.surfaceDepth, point.spacing);
+		}
+		return;
+	}
+
+	if (points.empty()) {
+		return;
+	}
+
+	auto dPoints = copyGridPoints(points);
+	_reactions.forEachTeam("ReactionNetwork::computeGridFluxes",
+		points.size(), DEVICE_LAMBDA(const IndexType p, auto&& reaction) {
+			const auto& point = dPoints(p);
+			reaction.contributeFlux(
+				subview(concentrations, point.concentrationRow, Kokkos::ALL),
+				subview(fluxes, point.outputOffset, Kokkos::ALL),
+				point.gridIndex);
+		});
+	Kokkos::fence();
+}
+
+template <typename TImpl>
+void
+ReactionNetwork<TImpl>::computeGridPartials(
+	GridConcentrationsView concentrations, Kokkos::View<double*> values,
+	const std::vector<GridPoint>& points)
+{
+	const IndexType nValues = values.extent(0);
+
+	// The pre-processing can't be done for all the points at once
+	if (asDerived()->hasPointwisePreProcess()) {
+		for (auto&& point : points) {
+			computeAllPartials(
+				subview(concentrations, point.concentrationRow, Kokkos::ALL),
+				subview(values, std::make_pair(point.outputOffset, nValues)),
+				point.gridIndex, point.surfaceDepth, point.spacing);
+		}
+		return;
+	}
+
+	if (points.empty()) {
+		return;
+	}
+
+	auto dPoints = copyGridPoints(points);
+	if (this->_enableReducedJacobian) {
+		_reactions.forEachTeam("ReactionNetwork::computeGridPartials",
+			points.size(), DEVICE_LAMBDA(const IndexType p, auto&& reaction) {
+				const auto& point = dPoints(p);
+				reaction.contributeReducedPartialDerivatives(
+					subview(
+						concentrations, point.concentrationRow, Kokkos::ALL),
+					subview(values, Kokkos::make_pair(point.outputOffset,
+										nValues)),
+					point.gridIndex);
+			});
+	}
+	else {
+		_reactions.forEachTeam("ReactionNetwork::computeGridPartials",
+			points.size(), DEVICE_LAMBDA(const IndexType p, auto&& reaction) {
+				const auto& point = dPoints(p);
+				reaction.contributePartialDerivatives(
+					subview(
+						concentrations, point.concentrationRow, Kokkos::ALL),
+					subview(values, Kokkos::make_pair(point.outputOffset,
+										nValues)),
+					point.gridIndex);
+			});
+	}
+	Kokkos::fence();
+}
+
 template <typename TImpl>
 void
 ReactionNetwork<TImpl>::computeConstantRates(ConcentrationsView concentrations,
@@ -604,16 +706,98 @@ ReactionNetwork<TImpl>::computeConstantRates(ConcentrationsView concentrations,
 
 template <typename TImpl>
 void
-ReactionNetwork<TImpl>::getConstantConnectivities(
-	ConnectivitiesView conns, IndexType subId)
+ReactionNetwork<TImpl>::computeGridConstantRates(
+	GridConcentrationsView concentrations, GridRatesView rates,
+	IndexType subId, const std::vector<GridPoint>& points)
+{
+	// The pre-processing can't be done for all the points at once
+	if (asDerived()->hasPointwisePreProcess()) {
+		for (auto&& point : points) {
+			computeConstantRates(
+				subview(concentrations, point.concentrationRow, Kokkos::ALL),
+				subview(rates, point.outputOffset, Kokkos::ALL), subId,
+				point.gridIndex, point.surfaceDepth, point.spacing);
+		}
+		return;
+	}
+
+	if (points.empty()) {
+		return;
+	}
+
+	auto dPoints = copyGridPoints(points);
+	auto localInSub = isInSub[subId];
+	_reactions.forEachTeam("ReactionNetwork::computeGridConstantRates",
+		points.size(), DEVICE_LAMBDA(const IndexType p, auto&& reaction) {
+			const auto& point = dPoints(p);
+			reaction.contributeConstantRates(
+				subview(concentrations, point.concentrationRow, Kokkos::ALL),
+				subview(rates, point.outputOffset, Kokkos::ALL), localInSub,
+				subId, point.gridIndex);
+		});
+	Kokkos::fence();
+}
+
+template <typename TImpl>
+typename ReactionNetwork<TImpl>::ConnectivitiesPair
+ReactionNetwork<TImpl>::getConstantConnectivities(IndexType subId)
 {
+	using RowMap = typename Connectivity::row_map_type;
+	using Entries = typename Connectivity::entries_type;
+
 	auto localInSub = isInSub[subId];
 	auto localBackMap = backMap[subId];
+	auto subDOF = subDOFs[subId];
+
+	// Count the entries of each row, duplicates included
+	Connectivity tmpConn;
+	tmpConn.row_map = RowMap("tmp constant counts", subDOF);
+	auto countConns = ConnectivitiesView(tmpConn, subDOF);
+	_reactions.forEach(DEVICE_LAMBDA(auto&& reaction) {
+		reaction.contributeConstantConnectivities(
+			countConns, localInSub, localBackMap);
+	});
+	Kokkos::fence();
+
+	// Get row map
+	auto counts = tmpConn.row_map;
+	auto nEntries =
+		Kokkos::get_crs_row_map_from_counts(tmpConn.row_map, counts);
+	counts = RowMap();
+
+	// Fill the entries (column ids), the duplicates are skipped
+	tmpConn.entries = Entries(
+		Kokkos::ViewAllocateWithoutInitializing("tmp constant entries"),
+		nEntries);
+	Kokkos::deep_copy(tmpConn.entries, this->invalidIndex());
+	auto fillConns = ConnectivitiesView(tmpConn, subDOF);
 	_reactions.forEach(DEVICE_LAMBDA(auto&& reaction) {
 		reaction.contributeConstantConnectivities(
-			conns, localInSub, localBackMap);
+			fillConns, localInSub, localBackMap);
 	});
 	Kokkos::fence();
+
+	// Shrink to fit on the host, with sorted rows
+	auto hRowMap = create_mirror_view(tmpConn.row_map);
+	deep_copy(hRowMap, tmpConn.row_map);
+	auto hEntries = create_mirror_view(tmpConn.entries);
+	deep_copy(hEntries, tmpConn.entries);
+	ConnectivitiesPair conns;
+	conns.first.reserve(subDOF + 1);
+	conns.first.push_back(0);
+	for (IndexType i = 0; i < subDOF; ++i) {
+		auto rowStart = conns.second.size();
+		for (auto j = hRowMap(i); j < hRowMap(i + 1); ++j) {
+			if (hEntries(j) == this->invalidIndex()) {
+				break;
+			}
+			conns.second.push_back(hEntries(j));
+		}
+		std::sort(conns.second.begin() + rowStart, conns.second.end());
+		conns.first.push_back(conns.second.size());
+	}
+
+	return conns;
 }
 
 template <typename TImpl>
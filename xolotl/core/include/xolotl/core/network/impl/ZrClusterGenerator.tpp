@@ -98,6 +98,17 @@ ZrClusterGenerator::select(const Region& region) const
 		region[Species::I].begin() > _maxI)
 		return false;
 
+	// Only the clusters starting in the size ranges of the options
+	auto loV = region[Species::V].begin();
+	auto loB = region[Species::Basal].begin();
+	auto loI = region[Species::I].begin();
+	if (loV > 0 && (loV < _minSelectV || loV > _maxSelectV))
+		return false;
+	if (loB > 0 && (loB < _minSelectB || loB > _maxSelectB))
+		return false;
+	if (loI > 0 && (loI < _minSelectI || loI > _maxSelectI))
+		return false;
+
 	return true;
 }
 
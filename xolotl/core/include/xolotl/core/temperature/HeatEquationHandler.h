@@ -48,6 +48,14 @@ public:
 	getTemperature(
 		const plsm::SpaceVector<double, 3>&, double time) const override;
 
+	/**
+	 * \see ITemperatureHandler.h
+	 */
+	void
+	getTemperatures(const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+		double time, network::IReactionNetwork::GridConcentrationsView solution,
+		std::vector<double>& temperatures) override;
+
 	/**
 	 * \see ITemperatureHandler.h
 	 */
@@ -102,6 +110,13 @@ public:
 		double* val, IdType* indices, double hxLeft, double hxRight, int xi,
 		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) override;
 
+	/**
+	 * \see ITemperatureHandler.h
+	 */
+	double
+	computeTemperatureRate(double currentTime, const double* temps,
+		double* val, double hxLeft, double hxRight, int xi) override;
+
 	/**
 	 * Get the heat flux at this time.
 	 *
@@ -215,6 +230,25 @@ private:
 	double
 	getDAlpha(int xi) const;
 
+	/**
+	 * Compute the partials of the heat equation along the depth.
+	 *
+	 * @param heatFlux The heat flux at this time
+	 * @param oldConc The temperature at the grid point
+	 * @param left The temperature at the left grid point
+	 * @param right The temperature at the right grid point
+	 * @param hxLeft The step size on the left side of the point
+	 * @param hxRight The step size on the right side of the point
+	 * @param xi The grid index
+	 * @param val The partials with respect to the middle, left, and right
+	 * temperatures
+	 * @return True if a boundary condition replaced the stencil
+	 */
+	bool
+	computeDepthPartials(double heatFlux, double oldConc, double left,
+		double right, double hxLeft, double hxRight, int xi,
+		double* val) const;
+
 	/**
 	 * Get the temperature derivative of Gamma.
 	 *
@@ -50,6 +50,21 @@ public:
 	getTemperature(const plsm::SpaceVector<double, 3>& fraction,
 		double currentTime) const = 0;
 
+	/**
+	 * This operation returns the temperatures at all the given positions
+	 * at once, one per row of the solution.
+	 *
+	 * @param fractions The position fractions on the grid, one per row
+	 * @param currentTime The time
+	 * @param solution The concentrations, one row per grid point
+	 * @param temperatures The vector that will contain the temperatures
+	 */
+	virtual void
+	getTemperatures(const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+		double currentTime,
+		network::IReactionNetwork::GridConcentrationsView solution,
+		std::vector<double>& temperatures) = 0;
+
 	/**
 	 * This operation sets the temperature given by the solver.
 	 *
@@ -139,6 +154,26 @@ public:
 		double* val, IdType* indices, double hxLeft, double hxRight, int xi,
 		double sy = 0.0, int iy = 0, double sz = 0.0, int iz = 0) = 0;
 
+	/**
+	 * Compute the rate due to the heat equation along the depth, and its
+	 * partials, from the temperatures alone. It is used when the temperature
+	 * is advanced separately from the clusters, in 1D.
+	 *
+	 * @param currentTime The current time
+	 * @param temps The temperatures at the middle, left, and right grid points
+	 * @param val The array that will contain the partials with respect to the
+	 * middle, left, and right temperatures
+	 * @param hxLeft The step size on the left side of the point in the x
+	 * direction
+	 * @param hxRight The step size on the right side of the point in the x
+	 * direction
+	 * @param xi The position on the x grid
+	 * @return The rate of the temperature
+	 */
+	virtual double
+	computeTemperatureRate(double currentTime, const double* temps,
+		double* val, double hxLeft, double hxRight, int xi) = 0;
+
 	/**
 	 * Get the heat flux at this time.
 	 *
@@ -72,6 +72,18 @@ public:
 	double
 	getTemperature(
 		const plsm::SpaceVector<double, 3>&, double currentTime) const override;
+
+	/**
+	 * This operation returns the temperatures at all the given positions.
+	 * The profile only depends on time so it is interpolated once.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	void
+	getTemperatures(const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+		double currentTime,
+		network::IReactionNetwork::GridConcentrationsView solution,
+		std::vector<double>& temperatures) override;
 };
 // end class ProfileHandler
 
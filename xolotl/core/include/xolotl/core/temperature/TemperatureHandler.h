@@ -21,6 +21,18 @@ public:
 	void
 	initialize(int dof) override;
 
+	/**
+	 * This operation returns the temperatures at all the given positions.
+	 * Calls getTemperature() at each position.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	void
+	getTemperatures(const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+		double currentTime,
+		network::IReactionNetwork::GridConcentrationsView solution,
+		std::vector<double>& temperatures) override;
+
 	/**
 	 * This operation sets the temperature given by the solver.
 	 * Don't do anything.
@@ -101,6 +113,22 @@ public:
 		return false;
 	}
 
+	/**
+	 * Compute the rate due to the heat equation.
+	 * Don't do anything.
+	 *
+	 * \see ITemperatureHandler.h
+	 */
+	double
+	computeTemperatureRate(double currentTime, const double* temps,
+		double* val, double hxLeft, double hxRight, int xi) override
+	{
+		val[0] = 0.0;
+		val[1] = 0.0;
+		val[2] = 0.0;
+		return 0.0;
+	}
+
 	/**
 	 * Get the heat flux at this time.
 	 *
@@ -6,6 +6,7 @@
 #include <mpi.h>
 
 #include <xolotl/core/flux/FluxHandler.h>
+#include <xolotl/util/MathUtils.h>
 
 namespace xolotl
 {
@@ -168,36 +169,7 @@ FluxHandler::initializeTimeProfile(const std::string& fileName)
 double
 FluxHandler::getProfileAmplitude(double currentTime) const
 {
-	// Initialize the amplitude to return
-	double f = 0.0;
-
-	// If the time is smaller than or equal than the first stored time
-	if (currentTime <= time[0]) {
-		return amplitudes[0];
-	}
-
-	// If the time is larger or equal to the last stored time
-	if (currentTime >= time[time.size() - 1]) {
-		return amplitudes[time.size() - 1];
-	}
-
-	// Else loop to determine the interval the time falls in
-	// i.e. time[k] < time < time[k + 1]
-	for (unsigned int k = 0; k < time.size() - 1; k++) {
-		if (currentTime < time[k])
-			continue;
-		if (currentTime > time[k + 1])
-			continue;
-
-		// Compute the amplitude following a linear interpolation between
-		// the two stored values
-		f = amplitudes[k] +
-			(amplitudes[k + 1] - amplitudes[k]) * (currentTime - time[k]) /
-				(time[k + 1] - time[k]);
-		break;
-	}
-
-	return f;
+	return util::interpolateTable(time, amplitudes, currentTime);
 }
 
 void
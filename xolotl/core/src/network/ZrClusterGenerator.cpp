@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <limits>
+
 #include <xolotl/core/network/ZrReactionNetwork.h>
 
 namespace xolotl
@@ -14,6 +17,7 @@ ZrClusterGenerator::ZrClusterGenerator(const options::IOptions& options) :
 	_groupingWidth(options.getGroupingWidthA()),
 	_transitionSize(options.getTransitionSize())
 {
+	setSizeRanges(options);
 }
 
 ZrClusterGenerator::ZrClusterGenerator(
@@ -26,6 +30,27 @@ ZrClusterGenerator::ZrClusterGenerator(
 	_groupingWidth(options.getGroupingWidthA()),
 	_transitionSize(options.getTransitionSize())
 {
+	setSizeRanges(options);
+}
+
+void
+ZrClusterGenerator::setSizeRanges(const options::IOptions& options)
+{
+	// The basal, vacancy, and interstitial sizes are the network parameters
+	// 0, 3, and 4
+	const auto& ranges = options.getNetworkSizeRanges();
+	auto readRange = [&ranges](std::size_t paramId, AmountType& minSize,
+						 AmountType& maxSize) {
+		minSize = 0;
+		maxSize = std::numeric_limits<AmountType>::max();
+		if (paramId < ranges.size()) {
+			minSize = ranges[paramId][0];
+			maxSize = std::min<IdType>(ranges[paramId][1], maxSize);
+		}
+	};
+	readRange(0, _minSelectB, _maxSelectB);
+	readRange(3, _minSelectV, _maxSelectV);
+	readRange(4, _minSelectI, _maxSelectI);
 }
 } // namespace network
 } // namespace core
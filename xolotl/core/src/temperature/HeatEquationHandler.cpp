@@ -143,6 +143,33 @@ HeatEquationHandler::getTemperature(
 		!util::equal(time, 0.0) * localTemperature;
 }
 
+void
+HeatEquationHandler::getTemperatures(
+	const std::vector<plsm::SpaceVector<double, 3>>& fractions, double time,
+	network::IReactionNetwork::GridConcentrationsView solution,
+	std::vector<double>& temperatures)
+{
+	if (zeroFlux || util::equal(time, 0.0)) {
+		temperatures.assign(fractions.size(), bulkTemperature);
+		return;
+	}
+
+	// Pack the strided temperature column on the device, then copy it to
+	// the host at once
+	const auto nPoints = fractions.size();
+	const auto dof = this->_dof;
+	Kokkos::View<double*> temps("Temperatures", nPoints);
+	Kokkos::parallel_for(
+		"HeatEquationHandler::getTemperatures", nPoints,
+		KOKKOS_LAMBDA(std::size_t i) { temps(i) = solution(i, dof); });
+	auto temps_h =
+		Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace{}, temps);
+	temperatures.resize(fractions.size());
+	for (std::size_t i = 0; i < fractions.size(); ++i) {
+		temperatures[i] = temps_h(i);
+	}
+}
+
 void
 HeatEquationHandler::setTemperature(Kokkos::View<const double*> solution)
 {
@@ -215,6 +242,82 @@ getDBeta(double temp) noexcept
 	return heatCond;
 }
 
+/**
+ * Get the rate of the heat equation along the depth at one grid point, which
+ * is the whole rate in 1D.
+ *
+ * @param oldConc The temperature at the grid point
+ * @param left The temperature at the left grid point
+ * @param right The temperature at the right grid point
+ * @param hxLeft The step size on the left side of the point
+ * @param hxRight The step size on the right side of the point
+ * @param alpha The spatially dependent part of the heat conductivity
+ * @param dAlpha Its spatial derivative
+ * @param htFlux The heat flux at the surface
+ * @param por The portion of heat lost in the bulk, negative when unused
+ * @param xi The grid index
+ * @param surfPos The surface position
+ * @param bulkPos The bulk position
+ * @return The rate
+ */
+KOKKOS_INLINE_FUNCTION
+double
+getDepthHeatRate(double oldConc, double left, double right, double hxLeft,
+	double hxRight, double alpha, double dAlpha, double htFlux, double por,
+	int xi, int surfPos, int bulkPos)
+{
+	double beta = getLocalHeatBeta(oldConc);
+	double gamma = getLocalHeatGamma(oldConc);
+	double dBeta = getDBeta(oldConc);
+	double rate = 0.0;
+
+	if (xi == surfPos) {
+		// Boundary condition with heat flux
+		rate += (2.0 * htFlux * gamma / hxLeft) +
+			(2.0 * alpha * beta * gamma) * (right - oldConc) /
+				(hxLeft * hxRight);
+		// Second term for temperature dependent conductivity
+		rate += -htFlux * dAlpha * gamma / alpha +
+			htFlux * htFlux * gamma * dBeta / (alpha * beta * beta);
+	}
+	else if (xi == bulkPos) {
+		if (por >= 0.0) {
+			rate += 2.0 * alpha * beta * gamma * (1.0 - por) *
+				(left - oldConc) / (hxLeft * (hxLeft + hxRight));
+			rate += dAlpha * beta * gamma * (1.0 + (hxRight * por) / hxLeft) *
+					(left - oldConc) / (hxLeft + hxRight) +
+				alpha * dBeta * gamma * (1.0 + (hxRight * por) / hxLeft) *
+					(1.0 + (hxRight * por) / hxLeft) * (left - oldConc) *
+					(left - oldConc) /
+					((hxLeft + hxRight) * (hxLeft + hxRight));
+		}
+		else {
+			// Boundary condition with heat flux
+			double bulkHeatFlux = getBulkHeatFlux(oldConc);
+			rate += -(2.0 * bulkHeatFlux * gamma / hxRight) +
+				(2.0 * alpha * beta * gamma) * (left - oldConc) /
+					(hxLeft * hxRight);
+			// Second term for temperature dependent conductivity
+			rate += -bulkHeatFlux * dAlpha * gamma / alpha +
+				bulkHeatFlux * bulkHeatFlux * gamma * dBeta /
+					(alpha * beta * beta);
+		}
+	}
+	else {
+		// Use a simple midpoint stencil to compute the concentration
+		rate += 2.0 * alpha * beta * gamma *
+			(left + (hxLeft / hxRight) * right -
+				(1.0 + (hxLeft / hxRight)) * oldConc) /
+			(hxLeft * (hxLeft + hxRight));
+		// Second term for temperature dependent conductivity
+		rate += dAlpha * beta * gamma * (right - left) / (hxLeft + hxRight) +
+			alpha * dBeta * gamma * (right - left) * (right - left) /
+				((hxLeft + hxRight) * (hxLeft + hxRight));
+	}
+
+	return rate;
+}
+
 double
 HeatEquationHandler::getDDBeta(double temp) const
 {
@@ -288,64 +391,15 @@ HeatEquationHandler::computeTemperature(double currentTime,
 			double oldConc = concVec[0][index];
 			double beta = getLocalHeatBeta(oldConc);
 			double gamma = getLocalHeatGamma(oldConc);
-			double dBeta = getDBeta(oldConc);
 			util::Array<double, 3, 2> oldBox;
 			for (int d = 0; d < dim; ++d) {
 				oldBox[d][0] = concVec[2 * d + 1][index];
 				oldBox[d][1] = concVec[2 * d + 2][index];
 			}
 
-			if (xi == surfPos) {
-				// Boundary condition with heat flux
-				updatedConcOffset[index] += (2.0 * htFlux * gamma / hxLeft) +
-					(2.0 * alpha * beta * gamma) * (oldBox[0][1] - oldConc) /
-						(hxLeft * hxRight);
-				// Second term for temperature dependent conductivity
-				updatedConcOffset[index] += -htFlux * dAlpha * gamma / alpha +
-					htFlux * htFlux * gamma * dBeta / (alpha * beta * beta);
-			}
-			else if (xi == bulkPos) {
-				if (por >= 0.0) {
-					updatedConcOffset[index] += 2.0 * alpha * beta * gamma *
-						(1.0 - por) * (oldBox[0][0] - oldConc) /
-						(hxLeft * (hxLeft + hxRight));
-					updatedConcOffset[index] += dAlpha * beta * gamma *
-							(1.0 + (hxRight * por) / hxLeft) *
-							(oldBox[0][0] - oldConc) / (hxLeft + hxRight) +
-						alpha * dBeta * gamma *
-							(1.0 + (hxRight * por) / hxLeft) *
-							(1.0 + (hxRight * por) / hxLeft) *
-							(oldBox[0][0] - oldConc) *
-							(oldBox[0][0] - oldConc) /
-							((hxLeft + hxRight) * (hxLeft + hxRight));
-				}
-				else {
-					// Boundary condition with heat flux
-					double bulkHeatFlux = getBulkHeatFlux(oldConc);
-					updatedConcOffset[index] +=
-						-(2.0 * bulkHeatFlux * gamma / hxRight) +
-						(2.0 * alpha * beta * gamma) *
-							(oldBox[0][0] - oldConc) / (hxLeft * hxRight);
-					// Second term for temperature dependent conductivity
-					updatedConcOffset[index] +=
-						-bulkHeatFlux * dAlpha * gamma / alpha +
-						bulkHeatFlux * bulkHeatFlux * gamma * dBeta /
-							(alpha * beta * beta);
-				}
-			}
-			else {
-				// Use a simple midpoint stencil to compute the concentration
-				updatedConcOffset[index] += 2.0 * alpha * beta * gamma *
-					(oldBox[0][0] + (hxLeft / hxRight) * oldBox[0][1] -
-						(1.0 + (hxLeft / hxRight)) * oldConc) /
-					(hxLeft * (hxLeft + hxRight));
-				// Second term for temperature dependent conductivity
-				updatedConcOffset[index] += dAlpha * beta * gamma *
-						(oldBox[0][1] - oldBox[0][0]) / (hxLeft + hxRight) +
-					alpha * dBeta * gamma * (oldBox[0][1] - oldBox[0][0]) *
-						(oldBox[0][1] - oldBox[0][0]) /
-						((hxLeft + hxRight) * (hxLeft + hxRight));
-			}
+			updatedConcOffset[index] += getDepthHeatRate(oldConc,
+				oldBox[0][0], oldBox[0][1], hxLeft, hxRight, alpha, dAlpha,
+				htFlux, por, xi, surfPos, bulkPos);
 
 			// Deal with the potential additional dimensions
 			for (int d = 1; d < dim; ++d) {
@@ -383,6 +437,53 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 
 	double s[3] = {0, sy, sz};
 
+	// Compute the partials along the depth
+	bool onBoundary = computeDepthPartials(heatFlux, oldConc, oldBox[0][0],
+		oldBox[0][1], hxLeft, hxRight, xi, val);
+
+	// Deal with the potential additional dimensions, the boundary conditions
+	// replace the whole diagonal
+	double alpha = getLocalHeatAlpha(xi);
+	double beta = getLocalHeatBeta(oldConc);
+	double gamma = getLocalHeatGamma(oldConc);
+	for (int d = 1; d < dimension; ++d) {
+		if (not onBoundary) {
+			val[0] -= 2.0 * alpha * beta * gamma * s[d];
+		}
+		val[2 * d + 1] = alpha * beta * gamma * s[d];
+		val[2 * d + 2] = alpha * beta * gamma * s[d];
+	}
+
+	return true;
+}
+
+double
+HeatEquationHandler::computeTemperatureRate(double currentTime,
+	const double* temps, double* val, double hxLeft, double hxRight, int xi)
+{
+	// Skip if the flux is 0
+	if (zeroFlux) {
+		val[0] = 0.0;
+		val[1] = 0.0;
+		val[2] = 0.0;
+		return 0.0;
+	}
+
+	auto heatFlux = getHeatFlux(currentTime);
+
+	computeDepthPartials(
+		heatFlux, temps[0], temps[1], temps[2], hxLeft, hxRight, xi, val);
+
+	return getDepthHeatRate(temps[0], temps[1], temps[2], hxLeft, hxRight,
+		getLocalHeatAlpha(xi), getDAlpha(xi), heatFlux, portion, xi,
+		surfacePosition, bulkPosition);
+}
+
+bool
+HeatEquationHandler::computeDepthPartials(double heatFlux, double oldConc,
+	double left, double right, double hxLeft, double hxRight, int xi,
+	double* val) const
+{
 	double alpha = getLocalHeatAlpha(xi);
 	double beta = getLocalHeatBeta(oldConc);
 	double gamma = getLocalHeatGamma(oldConc);
@@ -393,31 +494,23 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 
 	// Compute the partials along the depth
 	val[0] = -2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
-		alpha * (ddBeta * gamma + dGamma * dBeta) *
-			(oldBox[0][1] - oldBox[0][0]) * (oldBox[0][1] - oldBox[0][0]) /
-			((hxLeft + hxRight) * (hxLeft + hxRight)) +
+		alpha * (ddBeta * gamma + dGamma * dBeta) * (right - left) *
+			(right - left) / ((hxLeft + hxRight) * (hxLeft + hxRight)) +
 		2.0 * alpha * (dBeta * gamma + beta * dGamma) *
-			(oldBox[0][0] + (hxLeft / hxRight) * oldBox[0][1] -
+			(left + (hxLeft / hxRight) * right -
 				(1.0 + (hxLeft / hxRight)) * oldConc) /
 			((hxLeft + hxRight) * hxLeft) +
-		dAlpha * (dBeta * gamma + dGamma * beta) *
-			(oldBox[0][1] - oldBox[0][0]) / (hxLeft + hxRight);
+		dAlpha * (dBeta * gamma + dGamma * beta) * (right - left) /
+			(hxLeft + hxRight);
 	val[1] = 2.0 * alpha * beta * gamma / (hxLeft * (hxLeft + hxRight)) -
 		beta * dAlpha * gamma / (hxLeft + hxRight) +
-		2.0 * alpha * dBeta * gamma * (oldBox[0][0] - oldBox[0][1]) /
+		2.0 * alpha * dBeta * gamma * (left - right) /
 			((hxLeft + hxRight) * (hxLeft + hxRight));
 	val[2] = 2.0 * alpha * beta * gamma / (hxRight * (hxLeft + hxRight)) +
 		beta * dAlpha * gamma / (hxLeft + hxRight) +
-		2.0 * alpha * dBeta * gamma * (oldBox[0][1] - oldBox[0][0]) /
+		2.0 * alpha * dBeta * gamma * (right - left) /
 			((hxLeft + hxRight) * (hxLeft + hxRight));
 
-	// Deal with the potential additional dimensions
-	for (int d = 1; d < dimension; ++d) {
-		val[0] -= 2.0 * alpha * beta * gamma * s[d];
-		val[2 * d + 1] = alpha * beta * gamma * s[d];
-		val[2 * d + 2] = alpha * beta * gamma * s[d];
-	}
-
 	double x1 = xGrid[xi] - xGrid[surfacePosition + 1];
 	double x2 = xGrid[xi + 1] - xGrid[surfacePosition + 1];
 
@@ -426,7 +519,7 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 		val[0] = 2.0 * heatFlux * dGamma / hxLeft -
 			2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
 			2.0 * alpha * (dBeta * gamma + dGamma * beta) *
-				(oldBox[0][1] - oldConc) / (hxLeft * hxRight) -
+				(right - oldConc) / (hxLeft * hxRight) -
 			heatFlux * dGamma * dAlpha / alpha +
 			heatFlux * heatFlux * (gamma * ddBeta + dGamma * dBeta) /
 				(alpha * beta * beta) -
@@ -434,6 +527,7 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 				(alpha * beta * beta * beta);
 		val[1] = 0.0;
 		val[2] = 2.0 * alpha * beta * gamma / (hxLeft * hxRight);
+		return true;
 	}
 	else if (xi == bulkPosition) {
 		if (portion >= 0.0) {
@@ -443,8 +537,7 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 					(hxLeft + hxRight) +
 				2.0 * alpha * dBeta * gamma *
 					(1.0 + (hxRight * portion) / hxLeft) *
-					(1.0 + (hxRight * portion) / hxLeft) *
-					(oldConc - oldBox[0][0]) /
+					(1.0 + (hxRight * portion) / hxLeft) * (oldConc - left) /
 					((hxLeft + hxRight) * (hxLeft + hxRight));
 			val[1] = 2.0 * alpha * beta * gamma * (1.0 - portion) /
 					(hxLeft * (hxLeft + hxRight)) -
@@ -452,8 +545,7 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 					(hxLeft + hxRight) -
 				2.0 * alpha * dBeta * gamma *
 					(1.0 + (hxRight * portion) / hxLeft) *
-					(1.0 + (hxRight * portion) / hxLeft) *
-					(oldConc - oldBox[0][0]) /
+					(1.0 + (hxRight * portion) / hxLeft) * (oldConc - left) /
 					((hxLeft + hxRight) * (hxLeft + hxRight));
 			val[2] = 0.0;
 		}
@@ -463,7 +555,7 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 			val[0] = -2.0 * bulkHeatFlux * dGamma / hxRight -
 				2.0 * alpha * beta * gamma / (hxLeft * hxRight) +
 				2.0 * alpha * (dBeta * gamma + dGamma * beta) *
-					(oldBox[0][0] - oldConc) / (hxLeft * hxRight) -
+					(left - oldConc) / (hxLeft * hxRight) -
 				bulkHeatFlux * dAlpha * dGamma / alpha +
 				bulkHeatFlux * bulkHeatFlux *
 					(gamma * ddBeta + dGamma * dBeta) / (alpha * beta * beta) -
@@ -475,9 +567,10 @@ HeatEquationHandler::computePartialsForTemperature(double currentTime,
 			val[1] = 2.0 * alpha * beta * gamma / (hxLeft * hxRight);
 			val[2] = 0.0;
 		}
+		return true;
 	}
 
-	return true;
+	return false;
 }
 
 double
@@ -497,32 +590,7 @@ HeatEquationHandler::getHeatFlux(double currentTime)
 		return Qinter + Q0 * (1.0 + x * x) * x * x * exp(-x * x);
 	}
 
-	double f = 0.0;
-	// If the time is smaller than or equal than the first stored time
-	if (currentTime <= time[0])
-		return flux[0];
-
-	// If the time is larger or equal to the last stored time
-	if (currentTime >= time[time.size() - 1])
-		return flux[time.size() - 1];
-
-	// Else loop to determine the interval the time falls in
-	// i.e. time[k] < time < time[k + 1]
-	for (unsigned int k = 0; k < time.size() - 1; k++) {
-		if (currentTime < time[k])
-			continue;
-		if (currentTime > time[k + 1])
-			continue;
-
-		// Compute the amplitude following a linear interpolation between
-		// the two stored values
-		f = flux[k] +
-			(flux[k + 1] - flux[k]) * (currentTime - time[k]) /
-				(time[k + 1] - time[k]);
-		break;
-	}
-
-	return f;
+	return util::interpolateTable(time, flux, currentTime);
 }
 } // namespace temperature
 } // namespace core
@@ -4,6 +4,7 @@
 #include <xolotl/factory/temperature/TemperatureHandlerFactory.h>
 #include <xolotl/util/Log.h>
 #include <xolotl/util/MPIUtils.h>
+#include <xolotl/util/MathUtils.h>
 
 namespace xolotl
 {
@@ -63,34 +64,18 @@ double
 ProfileHandler::getTemperature(
 	const plsm::SpaceVector<double, 3>&, double currentTime) const
 {
-	// Initialize the value to return
-	double f = 0.0;
-
-	// If the time is smaller than or equal than the first stored time
-	if (currentTime <= time[0])
-		return temp[0];
-
-	// If the time is larger or equal to the last stored time
-	if (currentTime >= time[time.size() - 1])
-		return temp[time.size() - 1];
-
-	// Else loop to determine the interval the time falls in
-	// i.e. time[k] < time < time[k + 1]
-	for (unsigned int k = 0; k < time.size() - 1; k++) {
-		if (currentTime < time[k])
-			continue;
-		if (currentTime > time[k + 1])
-			continue;
-
-		// Compute the amplitude following a linear interpolation between
-		// the two stored values
-		f = temp[k] +
-			(temp[k + 1] - temp[k]) * (currentTime - time[k]) /
-				(time[k + 1] - time[k]);
-		break;
-	}
+	return util::interpolateTable(time, temp, currentTime);
+}
 
-	return f;
+void
+ProfileHandler::getTemperatures(
+	const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+	double currentTime,
+	network::IReactionNetwork::GridConcentrationsView solution,
+	std::vector<double>& temperatures)
+{
+	temperatures.assign(
+		fractions.size(), util::interpolateTable(time, temp, currentTime));
 }
 } // namespace temperature
 } // namespace core
@@ -22,6 +22,19 @@ TemperatureHandler::initialize(const int dof)
 {
 	_dof = dof;
 }
+
+void
+TemperatureHandler::getTemperatures(
+	const std::vector<plsm::SpaceVector<double, 3>>& fractions,
+	double currentTime,
+	network::IReactionNetwork::GridConcentrationsView solution,
+	std::vector<double>& temperatures)
+{
+	temperatures.resize(fractions.size());
+	for (std::size_t i = 0; i < fractions.size(); ++i) {
+		temperatures[i] = getTemperature(fractions[i], currentTime);
+	}
+}
 } // namespace temperature
 } // namespace core
 } // namespace xolotl
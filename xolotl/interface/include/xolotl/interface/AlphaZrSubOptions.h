@@ -1,21 +1,19 @@
 #pragma once
 
-#include <xolotl/interface/IMaterialSubOptions.h>
+#include <xolotl/interface/MaterialSubOptions.h>
 
 namespace xolotl
 {
 namespace interface
 {
-class AlphaZrSubOptions : public IMaterialSubOptions
+class AlphaZrSubOptions : public MaterialSubOptions
 {
 public:
 	AlphaZrSubOptions(const options::IOptions& options);
 
-	std::vector<std::shared_ptr<options::IOptions>>
-	getSubOptions() const override;
-
-private:
-	const options::IOptions& _options;
+protected:
+	std::vector<std::vector<std::size_t>>
+	getBlocks() const override;
 };
 } // namespace interface
 } // namespace xolotl
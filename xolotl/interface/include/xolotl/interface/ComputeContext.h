@@ -1,10 +1,15 @@
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <string>
 
 #include <mpi.h>
 
 #include <Kokkos_Core.hpp>
 
+#include <xolotl/options/Options.h>
 #include <xolotl/util/MPIUtils.h>
+#include <xolotl/util/Tokenizer.h>
 
 namespace xolotl
 {
@@ -20,7 +25,9 @@ public:
 				nullptr)
 	{
 		if (!initialized()) {
-			util::mpiInit(argc, argv);
+			// The asynchronous checkpoints make MPI calls from a background
+			// thread
+			util::mpiInit(argc, argv, asyncCheckpointRequested(argc, argv));
 			_mpiInitializedHere = true;
 		}
 	}
@@ -50,6 +57,26 @@ public:
 		return flag != 0;
 	}
 
+	/**
+	 * Whether the -async_checkpoint PETSc option is given, in the
+	 * PETSC_OPTIONS environment variable or in the PETSc arguments of the
+	 * parameter file. It is needed before the options are read, to
+	 * initialize MPI.
+	 */
+	static bool
+	asyncCheckpointRequested(int argc, const char* argv[])
+	{
+		std::string petscArgs;
+		if (auto env = std::getenv("PETSC_OPTIONS")) {
+			petscArgs = env;
+		}
+		petscArgs += " " + options::readPetscArgs(argc, argv);
+
+		auto tokens = util::Tokenizer<>{petscArgs, " \t\n"}();
+		return std::find(tokens.begin(), tokens.end(), "-async_checkpoint") !=
+			tokens.end();
+	}
+
 private:
 	bool _mpiInitializedHere{false};
 	std::unique_ptr<Kokkos::ScopeGuard> _kokkosContext;
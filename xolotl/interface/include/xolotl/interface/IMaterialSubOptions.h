@@ -12,12 +12,60 @@ namespace interface
 class IMaterialSubOptions
 {
 public:
+	//! The blocks of the phase space making each sub-instance
+	using Partition = std::vector<std::vector<std::size_t>>;
+
 	virtual ~IMaterialSubOptions()
 	{
 	}
 
+	/**
+	 * Get the options of the sub-instances with the default partition.
+	 */
 	virtual std::vector<std::shared_ptr<options::IOptions>>
 	getSubOptions() const = 0;
+
+	/**
+	 * Get the options of the sub-instances for the given partition.
+	 *
+	 * @param partition The blocks of each sub-instance
+	 */
+	virtual std::vector<std::shared_ptr<options::IOptions>>
+	getSubOptions(const Partition& partition) const = 0;
+
+	/**
+	 * Get the default partition, one species block per sub-instance.
+	 */
+	virtual Partition
+	getDefaultPartition() const = 0;
+
+	/**
+	 * Split the size range of the species blocks with a single network
+	 * parameter in sub-ranges with about the same number of degrees of
+	 * freedom. The partitions then use these finer blocks.
+	 *
+	 * @param nSubRanges The number of sub-ranges of each species block
+	 */
+	virtual void
+	splitSizeRanges(std::size_t nSubRanges) = 0;
+
+	/**
+	 * Choose the partition minimizing the largest estimated cost of a
+	 * sub-instance while keeping the coupling between the sub-instances
+	 * below the given fraction of the coupling of the default partition.
+	 *
+	 * @param maxCoupling The largest relative coupling
+	 */
+	virtual Partition
+	getBalancedPartition(double maxCoupling) const = 0;
+
+	/**
+	 * Get the estimated cost of each sub-instance of a partition.
+	 *
+	 * @param partition The blocks of each sub-instance
+	 */
+	virtual std::vector<double>
+	getCosts(const Partition& partition) const = 0;
 };
 } // namespace interface
 } // namespace xolotl
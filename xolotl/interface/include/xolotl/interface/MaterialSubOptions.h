@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <memory>
+
+#include <xolotl/interface/IMaterialSubOptions.h>
+
+namespace xolotl
+{
+namespace interface
+{
+/**
+ * Base class for the splits of the phase space into sub-instances. The phase
+ * space is made of species blocks, each one a set of network parameters. The
+ * species blocks with a single parameter can be split further in size
+ * ranges, and every sub-instance gets one or several of these blocks.
+ *
+ * The costs come from the Jacobian of the whole network: the cost of a
+ * sub-instance is the number of its entries between the clusters of the
+ * sub-instance, and the coupling between sub-instances the number of its
+ * entries between clusters of different sub-instances.
+ */
+class MaterialSubOptions : public IMaterialSubOptions
+{
+public:
+	MaterialSubOptions(const options::IOptions& options);
+
+	~MaterialSubOptions();
+
+	std::vector<std::shared_ptr<options::IOptions>>
+	getSubOptions() const override;
+
+	std::vector<std::shared_ptr<options::IOptions>>
+	getSubOptions(const Partition& partition) const override;
+
+	Partition
+	getDefaultPartition() const override;
+
+	void
+	splitSizeRanges(std::size_t nSubRanges) override;
+
+	Partition
+	getBalancedPartition(double maxCoupling) const override;
+
+	std::vector<double>
+	getCosts(const Partition& partition) const override;
+
+	/**
+	 * The coupling between the sub-instances of a partition.
+	 */
+	double
+	getCoupling(const Partition& partition) const;
+
+	/**
+	 * The largest cost of the sub-instances of a partition.
+	 */
+	double
+	getMaxCost(const Partition& partition) const;
+
+protected:
+	/**
+	 * Get the network parameters of each species block, the parameters that
+	 * are not in a sub-instance's blocks are set to 0 in its options.
+	 */
+	virtual std::vector<std::vector<std::size_t>>
+	getBlocks() const = 0;
+
+	const options::IOptions& _options;
+
+private:
+	//! A block of the partitions, a species block or a size range of it
+	struct Block
+	{
+		std::size_t speciesBlock;
+		//! The size range of the parameter of a split species block
+		bool split;
+		std::array<IdType, 2> sizeRange;
+	};
+
+	//! The clusters of the whole network, computed once
+	struct ClusterData;
+
+	/**
+	 * The blocks of the partitions.
+	 */
+	std::vector<Block>
+	getPartitionBlocks() const;
+
+	/**
+	 * Get the options of a sub-instance made of the given blocks.
+	 */
+	std::shared_ptr<options::IOptions>
+	makeSubOptions(const std::vector<Block>& blocks) const;
+
+	/**
+	 * Build the whole network and find the species block of its clusters.
+	 */
+	const ClusterData&
+	getClusterData() const;
+
+	/**
+	 * The number of Jacobian entries between each pair of blocks.
+	 */
+	std::vector<std::vector<double>>
+	getBlockEntries() const;
+
+	//! The blocks when the species blocks are split
+	std::vector<Block> _splitBlocks;
+
+	mutable std::unique_ptr<ClusterData> _clusterData;
+};
+} // namespace interface
+} // namespace xolotl
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <mpi.h>
+
 #include <memory>
+#include <string>
+#include <tuple>
 #include <vector>
 
 #include <xolotl/config.h>
@@ -10,10 +14,16 @@
 
 namespace xolotl
 {
+namespace perf
+{
+class IEventCounter;
+}
+
 namespace interface
 {
 class ComputeContext;
 class PetscContext;
+struct GroupContext;
 class XolotlInterface;
 
 class MultiXolotl : public IXolotlInterface
@@ -42,13 +52,28 @@ public:
 	void
 	solveStep();
 
+	/**
+	 * Read the state of the time stepper to restart from.
+	 *
+	 * @param restartFile The list of the checkpoint files of the instances,
+	 * or the checkpoint file shared by all of them
+	 * @return The last step solved, its time, and the next step size
+	 */
 	static std::tuple<std::size_t, double, double>
-	readStopData();
+	readStopData(const std::string& restartFile);
 
 private:
 	void
 	writeStopData();
 
+	/**
+	 * Write the coupling state and the concentrations of all the
+	 * sub-instances in a single file, with one group per sub-instance. All
+	 * the processes take part in a single collective pass.
+	 */
+	void
+	writeSharedCheckpoint();
+
 	void
 	startTimeStepper();
 
@@ -62,22 +87,103 @@ private:
 	SubInstanceData
 	getSubInstanceData();
 
+	/**
+	 * Share the exported concentrations of the sub-instances between the
+	 * process groups when they are solved concurrently. Each group first
+	 * gathers the whole grid of its sub-instance, then broadcasts it to the
+	 * other groups.
+	 *
+	 * @param nLocalPoints The number of grid points exported by this process
+	 * for each sub-instance it solves
+	 * @return The index of the first local grid point in the whole grid
+	 */
+	IdType
+	exchangeConcentrations(const std::vector<IdType>& nLocalPoints);
+
+	/**
+	 * Whether this process writes the output of the primary instance.
+	 */
+	bool
+	isOutputGroup() const;
+
+	/**
+	 * Compute the constant rates of the grid points that need it with the
+	 * primary instance and pass them to the sub-instances.
+	 */
 	void
-	updateTemperaturesAndRates(
-		std::size_t gridIndex, const SubInstanceData& data);
+	updateTemperaturesAndRates(const SubInstanceData& data);
+
+	/**
+	 * Select the grid points whose constant rates are refreshed at this step.
+	 * With a refresh tolerance, a grid point is only refreshed when the
+	 * relative change of its temperature or of the concentrations of one of
+	 * the sub-instances since its last refresh is above the tolerance. The
+	 * points are then checked less and less often while none of them changes,
+	 * up to the maximum refresh interval.
+	 *
+	 * @param conc The concentrations of each sub-instance, per grid point
+	 * @param temperatures The temperature at each grid point
+	 * @return The grid points to refresh
+	 */
+	std::vector<IdType>
+	selectRefreshRows(const std::vector<std::vector<std::vector<double>>>& conc,
+		const std::vector<double>& temperatures);
 
 private:
 	std::shared_ptr<ComputeContext> _computeContext;
 	std::shared_ptr<options::IOptions> _options;
 	util::TimeStepper _timeStepper;
 	std::unique_ptr<PetscContext> _petscContext;
+	//! The communicator of all the instances
+	MPI_Comm _worldComm;
+	//! The group of processes solving the same sub-instances
+	std::unique_ptr<GroupContext> _groupContext;
+	//! For each sub-instance, the rank of the first process of its group, it
+	//! is empty when all the processes solve all the sub-instances
+	std::vector<int> _groupRoots;
 	std::unique_ptr<XolotlInterface> _primaryInstance;
+	//! The sub-instances, null for the ones solved by another group
 	std::vector<std::unique_ptr<XolotlInterface>> _subInstances;
 	std::vector<IdType> _subDOFs;
+	//! The flat concentration buffers of the sub-instances
+	std::vector<std::vector<double>> _subConcs;
 	std::vector<std::shared_ptr<RatesCapsule>> _constantRates;
+
+	//! The relative change above which the constant rates of a grid point
+	//! are refreshed, they are refreshed at every step when it is 0
+	double _refreshTolerance{0.0};
+
+	//! The number of steps between two checks of the grid points, its upper
+	//! bound, and the number of steps since the last check
+	IdType _refreshInterval{1};
+	IdType _maxRefreshInterval{1};
+	IdType _stepsSinceCheck{0};
+
+	//! The coupling data of each grid point at its last refresh
+	std::vector<std::vector<std::vector<double>>> _refreshConcs;
+	std::vector<double> _refreshTemperatures;
+
+	//! Counts the grid points that were not refreshed
+	std::shared_ptr<perf::IEventCounter> _skippedRefreshCounter;
 	bool _restarting{false};
 	bool _checkpointing{false};
 	std::vector<std::string> _checkpointFiles;
+
+	//! The blocks of each sub-instance
+	std::vector<std::vector<std::size_t>> _partition;
+
+	//! The number of size ranges each block was split in, the block ids of
+	//! the partition depend on it
+	int _nSubRanges{1};
+
+	//! The number of steps between two writes of the shared checkpoint
+	//! file, it is not written when it is 0
+	IdType _sharedCheckpointStride{0};
+
+	//! The last step solved, its time and the next step size, and whether
+	//! the shared checkpoint file is up to date with it
+	std::tuple<std::size_t, double, double> _lastSolvedStep;
+	bool _sharedCheckpointCurrent{true};
 };
 } // namespace interface
 } // namespace xolotl
@@ -2,6 +2,7 @@
 
 #include <petscts.h>
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -26,6 +27,7 @@ class IReactionNetwork;
 namespace solver
 {
 class ISolver;
+struct BufferLayout;
 }
 namespace perf
 {
@@ -35,6 +37,7 @@ class IPerfHandler;
 namespace interface
 {
 class ComputeContext;
+struct ConcentrationsCapsule;
 
 /**
  * Class defining the method to be coupled to another code through MOOSEApps
@@ -73,6 +76,18 @@ private:
 	 */
 	std::vector<IdType> _subEntries;
 
+	/**
+	 * The device copy of the concentrations used to compute the constant
+	 * rates, kept from one call to the next
+	 */
+	std::shared_ptr<ConcentrationsCapsule> _constantConcs;
+
+	/**
+	 * The concentration buffer registered by the caller and its layout
+	 */
+	double* _concBuffer{nullptr};
+	std::shared_ptr<solver::BufferLayout> _concLayout;
+
 	/**
 	 * A (possibly) shared instance of the options object
 	 */
@@ -224,6 +239,72 @@ public:
 		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
 	getConcVector();
 
+	/**
+	 * Copy the first components of the local concentrations in a flat
+	 * buffer, one row of nComponents values per local grid point. It is
+	 * meant for the coupling between instances and does not allocate when
+	 * the buffer is reused.
+	 *
+	 * @param nComponents The number of values to copy per grid point
+	 * @param concs The buffer, only resized if it is too small
+	 * @return The number of grid points copied
+	 */
+	IdType
+	getConcentrations(IdType nComponents, std::vector<double>& concs);
+
+	/**
+	 * Register a buffer owned by the caller to exchange the local
+	 * concentrations without intermediate copies. The buffer must stay valid
+	 * until another one is registered. The value of the component ids[n] at
+	 * the local grid point (i, j, k) is read from or written to
+	 *     i * pointStrides[0] + j * pointStrides[1] + k * pointStrides[2]
+	 *         + n * componentStride
+	 * and the default layout is the one of the solution (see BufferLayout).
+	 *
+	 * @param buffer The buffer
+	 * @param ids The components stored in the buffer, all of them when empty
+	 * @param componentStride The distance between two components
+	 * @param pointStrides The distance between two grid points in each
+	 * direction, zero packing them after the previous direction
+	 */
+	void
+	registerConcentrationBuffer(double* buffer,
+		const std::vector<IdType>& ids = {}, IdType componentStride = 1,
+		const std::array<IdType, 3>& pointStrides = {0, 0, 0});
+
+	/**
+	 * Copy the local concentrations to the registered buffer.
+	 */
+	void
+	exportConcentrations();
+
+	/**
+	 * Set the local concentrations from the registered buffer.
+	 */
+	void
+	importConcentrations();
+
+	/**
+	 * Get the number of degrees of freedom of the network, the solution has
+	 * one more value at each grid point for the temperature.
+	 *
+	 * @return The number of degrees of freedom
+	 */
+	IdType
+	getDOF();
+
+	/**
+	 * Get the part of the grid owned by this process, in the (x, y, z)
+	 * order.
+	 *
+	 * @param start The first grid point we own
+	 * @param count The number of grid points we own in each direction
+	 * @param globalSize The number of grid points in each direction
+	 */
+	void
+	getLocalGridBox(std::array<IdType, 3>& start, std::array<IdType, 3>& count,
+		std::array<IdType, 3>& globalSize);
+
 	/**
 	 * Set the concentrations and their ids.
 	 *
@@ -291,6 +372,14 @@ public:
 	TS&
 	getTS();
 
+	/**
+	 * Get the perf handler of the solver.
+	 *
+	 * @return The perf handler
+	 */
+	std::shared_ptr<perf::IPerfHandler>
+	getPerfHandler();
+
 	/**
 	 * Get the grid information
 	 *
@@ -357,25 +446,35 @@ public:
 	makeRatesCapsule() const;
 
 	/**
-	 * Values for the rates to be set in constant reactions.
+	 * Values for the rates to be set in constant reactions, the rates stay
+	 * in device memory.
 	 *
-	 * @param rates All the rates
-	 * @param gridIndex The grid index
+	 * @param rates All the rates, one row per grid point
+	 * @param firstGridIndex The grid index of the first row
+	 * @param gridRows The rows to set
 	 */
 	void
-	setConstantRates(
-		const std::shared_ptr<RatesCapsule>& rates, IdType gridIndex);
+	setConstantRates(const std::shared_ptr<RatesCapsule>& rates,
+		IdType firstGridIndex, const std::vector<IdType>& gridRows);
 
 	/**
-	 * Compute the constant rates
+	 * Compute the constant rates of a set of grid points at once. The
+	 * concentrations are copied to the device in a single block and the
+	 * rate buffers are reused from one call to the next, the rows that are
+	 * not computed keep their previous rates.
 	 *
-	 * @param conc The concentration vector
-	 * @param gridIndex The grid index
+	 * @param conc The concentrations of each sub network, per grid point
+	 * @param temperatures The temperature at each grid point
+	 * @param depths The depth of each grid point
+	 * @param gridRows The grid points to compute
 	 * @param rates A vector containing the rates for each sub instance
 	 */
 	void
-	computeConstantRates(std::vector<std::vector<double>> conc,
-		IdType gridIndex, std::vector<std::shared_ptr<RatesCapsule>>& rates);
+	computeConstantRates(
+		const std::vector<std::vector<std::vector<double>>>& conc,
+		const std::vector<double>& temperatures,
+		const std::vector<double>& depths, const std::vector<IdType>& gridRows,
+		std::vector<std::shared_ptr<RatesCapsule>>& rates);
 
 	/**
 	 * Get the connectivity matrices
@@ -10,27 +10,21 @@ auto alphaZrSubOptionsRegistrations =
 		RegistrationCollection<AlphaZrSubOptions>({"AlphaZr"});
 
 AlphaZrSubOptions::AlphaZrSubOptions(const options::IOptions& options) :
-	_options(options)
+	MaterialSubOptions(options)
 {
 }
 
-std::vector<std::shared_ptr<options::IOptions>>
-AlphaZrSubOptions::getSubOptions() const
+std::vector<std::vector<std::size_t>>
+AlphaZrSubOptions::getBlocks() const
 {
-	std::vector<std::shared_ptr<options::IOptions>> ret;
+	// One block per species
+	std::vector<std::vector<std::size_t>> ret;
 	const auto& netParams = _options.getNetworkParameters();
-	auto tmpParams = netParams;
 	for (std::size_t i = 0; i < netParams.size(); ++i) {
 		if (netParams[i] == 0) {
 			continue;
 		}
-
-		tmpParams.assign(netParams.size(), 0);
-		tmpParams[i] = netParams[i];
-		auto subOpts = _options.makeCopy();
-		subOpts->setNetworkParameters(tmpParams);
-
-		ret.push_back(subOpts);
+		ret.push_back({i});
 	}
 	return ret;
 }
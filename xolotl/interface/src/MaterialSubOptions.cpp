@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+#include <xolotl/core/network/INetworkHandler.h>
+#include <xolotl/factory/network/NetworkHandlerFactory.h>
+#include <xolotl/interface/MaterialSubOptions.h>
+#include <xolotl/util/Log.h>
+
+namespace xolotl
+{
+namespace interface
+{
+namespace
+{
+/**
+ * Build the network described by the options.
+ */
+std::shared_ptr<core::network::IReactionNetwork>
+makeNetwork(const options::IOptions& options)
+{
+	return factory::network::NetworkHandlerFactory::get(
+		core::network::loadNetworkHandlers)
+		.generate(options)
+		->getNetwork();
+}
+
+//! The number of Jacobian entries between each pair of blocks
+using BlockEntries = std::vector<std::vector<double>>;
+
+/**
+ * The cost of the sub-instance made of the given blocks.
+ */
+double
+getInstanceCost(
+	const BlockEntries& entries, const std::vector<std::size_t>& blockIds)
+{
+	double cost = 0.0;
+	for (auto i : blockIds) {
+		for (auto j : blockIds) {
+			cost += entries[i][j];
+		}
+	}
+	return cost;
+}
+
+/**
+ * The coupling between the sub-instances, every entry not in one of them.
+ */
+double
+getPartitionCoupling(const BlockEntries& entries,
+	const IMaterialSubOptions::Partition& partition)
+{
+	double coupling = 0.0;
+	for (auto&& row : entries) {
+		coupling += std::accumulate(row.begin(), row.end(), 0.0);
+	}
+	for (auto&& blockIds : partition) {
+		coupling -= getInstanceCost(entries, blockIds);
+	}
+	return coupling;
+}
+} // namespace
+
+struct MaterialSubOptions::ClusterData
+{
+	//! The species block of each cluster, the number of species blocks when
+	//! it is in none of them
+	std::vector<std::size_t> speciesBlocks;
+	//! The smallest size of each cluster, on its axis
+	std::vector<IdType> starts;
+	//! The cluster of each degree of freedom
+	std::vector<std::size_t> dofClusters;
+	//! The Jacobian fill of the whole network
+	core::network::IReactionNetwork::SparseFillMap fillMap;
+};
+
+MaterialSubOptions::MaterialSubOptions(const options::IOptions& options) :
+	_options(options)
+{
+}
+
+MaterialSubOptions::~MaterialSubOptions()
+{
+}
+
+std::vector<std::shared_ptr<options::IOptions>>
+MaterialSubOptions::getSubOptions() const
+{
+	return getSubOptions(getDefaultPartition());
+}
+
+std::vector<std::shared_ptr<options::IOptions>>
+MaterialSubOptions::getSubOptions(const Partition& partition) const
+{
+	std::vector<std::shared_ptr<options::IOptions>> ret;
+	auto blocks = getPartitionBlocks();
+	for (auto&& blockIds : partition) {
+		std::vector<Block> subBlocks;
+		for (auto blockId : blockIds) {
+			if (blockId >= blocks.size()) {
+				XOLOTL_ERROR(std::runtime_error,
+					"MaterialSubOptions: The partition uses block " +
+						std::to_string(blockId) + " out of " +
+						std::to_string(blocks.size()));
+			}
+			subBlocks.push_back(blocks[blockId]);
+		}
+		ret.push_back(makeSubOptions(subBlocks));
+	}
+
+	return ret;
+}
+
+IMaterialSubOptions::Partition
+MaterialSubOptions::getDefaultPartition() const
+{
+	// The blocks of each species block together
+	Partition partition(getBlocks().size());
+	auto blocks = getPartitionBlocks();
+	for (std::size_t i = 0; i < blocks.size(); ++i) {
+		partition[blocks[i].speciesBlock].push_back(i);
+	}
+	return partition;
+}
+
+void
+MaterialSubOptions::splitSizeRanges(std::size_t nSubRanges)
+{
+	_splitBlocks.clear();
+	if (nSubRanges <= 1) {
+		return;
+	}
+
+	auto speciesBlocks = getBlocks();
+	const auto& data = getClusterData();
+	for (std::size_t s = 0; s < speciesBlocks.size(); ++s) {
+		// Only the size of a single parameter can be split
+		if (speciesBlocks[s].size() != 1) {
+			_splitBlocks.push_back({s, false, {0, 0}});
+			continue;
+		}
+
+		// The number of degrees of freedom at each size
+		std::map<IdType, double> dofs;
+		for (auto cluster : data.dofClusters) {
+			if (data.speciesBlocks[cluster] == s) {
+				dofs[data.starts[cluster]] += 1.0;
+			}
+		}
+		double total = 0.0;
+		for (auto&& [start, n] : dofs) {
+			total += n;
+		}
+
+		// Cut when the share of the next sub-range is reached, the sizes
+		// are the starts of the clusters so that none of them is cut
+		IdType minSize = 0;
+		double sum = 0.0;
+		std::size_t k = 1;
+		for (auto&& [start, n] : dofs) {
+			if (k < nSubRanges && sum > 0.0 && sum >= k * total / nSubRanges) {
+				_splitBlocks.push_back({s, true, {minSize, start - 1}});
+				minSize = start;
+				k = static_cast<std::size_t>(sum * nSubRanges / total) + 1;
+			}
+			sum += n;
+		}
+		_splitBlocks.push_back(
+			{s, true, {minSize, std::numeric_limits<IdType>::max()}});
+	}
+}
+
+IMaterialSubOptions::Partition
+MaterialSubOptions::getBalancedPartition(double maxCoupling) const
+{
+	auto blocks = getPartitionBlocks();
+	auto nBlocks = blocks.size();
+	auto entries = getBlockEntries();
+	double total = 0.0;
+	for (auto&& row : entries) {
+		total += std::accumulate(row.begin(), row.end(), 0.0);
+	}
+	auto defaultPartition = getDefaultPartition();
+	auto couplingLimit =
+		maxCoupling * getPartitionCoupling(entries, defaultPartition);
+
+	// The sizes ranges of a species block in a sub-instance must follow
+	// each other
+	auto canAdd = [&blocks](
+					  const std::vector<std::size_t>& blockIds, std::size_t b) {
+		if (!blocks[b].split) {
+			return true;
+		}
+		bool sameSpecies = false;
+		for (auto c : blockIds) {
+			if (blocks[c].speciesBlock == blocks[b].speciesBlock) {
+				if (c + 1 == b) {
+					return true;
+				}
+				sameSpecies = true;
+			}
+		}
+		return !sameSpecies;
+	};
+
+	// Go through the partitions of the blocks, the cost of a sub-instance
+	// only grows with its blocks so the partitions already more costly than
+	// the best one are skipped
+	Partition best = defaultPartition;
+	double bestCost = std::numeric_limits<double>::max();
+	double bestCoupling = std::numeric_limits<double>::max();
+	Partition current;
+	std::vector<double> costs;
+	std::function<void(std::size_t)> visit = [&](std::size_t b) {
+		if (b == nBlocks) {
+			auto coupling =
+				total - std::accumulate(costs.begin(), costs.end(), 0.0);
+			if (coupling > couplingLimit) {
+				return;
+			}
+			auto cost = *std::max_element(costs.begin(), costs.end());
+			if (cost < bestCost ||
+				(cost == bestCost && coupling < bestCoupling)) {
+				best = current;
+				bestCost = cost;
+				bestCoupling = coupling;
+			}
+			return;
+		}
+		// Add the block to each existing sub-instance, or to a new one
+		for (std::size_t k = 0; k < current.size(); ++k) {
+			if (!canAdd(current[k], b)) {
+				continue;
+			}
+			auto added = entries[b][b];
+			for (auto c : current[k]) {
+				added += entries[b][c] + entries[c][b];
+			}
+			if (costs[k] + added > bestCost) {
+				continue;
+			}
+			current[k].push_back(b);
+			costs[k] += added;
+			visit(b + 1);
+			costs[k] -= added;
+			current[k].pop_back();
+		}
+		if (entries[b][b] <= bestCost) {
+			current.push_back({b});
+			costs.push_back(entries[b][b]);
+			visit(b + 1);
+			costs.pop_back();
+			current.pop_back();
+		}
+	};
+	visit(0);
+
+	return best;
+}
+
+std::vector<double>
+MaterialSubOptions::getCosts(const Partition& partition) const
+{
+	auto entries = getBlockEntries();
+	std::vector<double> costs;
+	for (auto&& blockIds : partition) {
+		costs.push_back(getInstanceCost(entries, blockIds));
+	}
+	return costs;
+}
+
+double
+MaterialSubOptions::getCoupling(const Partition& partition) const
+{
+	return getPartitionCoupling(getBlockEntries(), partition);
+}
+
+double
+MaterialSubOptions::getMaxCost(const Partition& partition) const
+{
+	auto costs = getCosts(partition);
+	return costs.empty() ? 0.0 : *std::max_element(costs.begin(), costs.end());
+}
+
+auto
+MaterialSubOptions::getPartitionBlocks() const -> std::vector<Block>
+{
+	if (!_splitBlocks.empty()) {
+		return _splitBlocks;
+	}
+
+	// One block per species block
+	std::vector<Block> blocks;
+	auto nSpeciesBlocks = getBlocks().size();
+	for (std::size_t s = 0; s < nSpeciesBlocks; ++s) {
+		blocks.push_back({s, false, {0, 0}});
+	}
+	return blocks;
+}
+
+std::shared_ptr<options::IOptions>
+MaterialSubOptions::makeSubOptions(const std::vector<Block>& blocks) const
+{
+	const auto& netParams = _options.getNetworkParameters();
+	auto speciesBlocks = getBlocks();
+
+	// The parameters up to the last one in a species block are split
+	std::size_t nSplit = 0;
+	for (auto&& speciesBlock : speciesBlocks) {
+		for (auto paramId : speciesBlock) {
+			nSplit = std::max(nSplit, paramId + 1);
+		}
+	}
+	auto tmpParams = netParams;
+	std::fill(tmpParams.begin(), tmpParams.begin() + nSplit, 0);
+
+	// The size ranges of a parameter must follow each other
+	auto sortedBlocks = blocks;
+	std::sort(sortedBlocks.begin(), sortedBlocks.end(),
+		[](const Block& a, const Block& b) {
+			return std::tie(a.speciesBlock, a.sizeRange[0]) <
+				std::tie(b.speciesBlock, b.sizeRange[0]);
+		});
+	std::vector<std::array<IdType, 2>> sizeRanges;
+	for (auto&& block : sortedBlocks) {
+		for (auto paramId : speciesBlocks[block.speciesBlock]) {
+			tmpParams[paramId] = netParams[paramId];
+		}
+		if (!block.split) {
+			continue;
+		}
+
+		auto paramId = speciesBlocks[block.speciesBlock][0];
+		if (sizeRanges.empty()) {
+			sizeRanges.assign(
+				netParams.size(), {0, std::numeric_limits<IdType>::max()});
+		}
+		auto& sizeRange = sizeRanges[paramId];
+		if (sizeRange[0] == 0 &&
+			sizeRange[1] == std::numeric_limits<IdType>::max()) {
+			sizeRange = block.sizeRange;
+		}
+		else if (block.sizeRange[0] == sizeRange[1] + 1) {
+			sizeRange[1] = block.sizeRange[1];
+		}
+		else {
+			XOLOTL_ERROR(std::runtime_error,
+				"MaterialSubOptions: The size ranges of network parameter " +
+					std::to_string(paramId) +
+					" in a sub-instance do not follow each other");
+		}
+	}
+
+	auto subOpts = _options.makeCopy();
+	subOpts->setNetworkParameters(tmpParams);
+	if (!sizeRanges.empty()) {
+		subOpts->setNetworkSizeRanges(sizeRanges);
+	}
+	return subOpts;
+}
+
+auto
+MaterialSubOptions::getClusterData() const -> const ClusterData&
+{
+	if (_clusterData) {
+		return *_clusterData;
+	}
+
+	auto data = std::make_unique<ClusterData>();
+	auto network = makeNetwork(_options);
+	auto bounds = network->getAllClusterBounds();
+	auto momentIds = network->getAllMomentIdInfo();
+	auto nClusters = bounds.size();
+
+	// The clusters are on a single axis, their start is their largest lower
+	// bound
+	std::map<std::vector<core::network::IReactionNetwork::AmountType>,
+		std::size_t>
+		clusterIds;
+	data->starts.resize(nClusters);
+	data->dofClusters.resize(network->getDOF());
+	for (std::size_t i = 0; i < nClusters; ++i) {
+		clusterIds.emplace(bounds[i], i);
+		IdType start = 0;
+		for (std::size_t j = 0; j < bounds[i].size(); j += 2) {
+			start = std::max<IdType>(start, bounds[i][j]);
+		}
+		data->starts[i] = start;
+		data->dofClusters[i] = i;
+		for (auto momentId : momentIds[i]) {
+			data->dofClusters[momentId] = i;
+		}
+	}
+	network->getDiagonalFill(data->fillMap);
+	network.reset();
+
+	// Find the clusters of the network of each species block
+	auto speciesBlocks = getBlocks();
+	data->speciesBlocks.assign(nClusters, speciesBlocks.size());
+	for (std::size_t s = 0; s < speciesBlocks.size(); ++s) {
+		auto subNetwork = makeNetwork(*makeSubOptions({{s, false, {0, 0}}}));
+		for (auto&& clusterBounds : subNetwork->getAllClusterBounds()) {
+			if (auto it = clusterIds.find(clusterBounds);
+				it != clusterIds.end()) {
+				data->speciesBlocks[it->second] = s;
+			}
+		}
+	}
+
+	_clusterData = std::move(data);
+	return *_clusterData;
+}
+
+auto
+MaterialSubOptions::getBlockEntries() const -> std::vector<std::vector<double>>
+{
+	auto blocks = getPartitionBlocks();
+	auto nBlocks = blocks.size();
+	const auto& data = getClusterData();
+
+	// The block of each cluster
+	auto nClusters = data.starts.size();
+	std::vector<std::size_t> clusterBlocks(nClusters, nBlocks);
+	for (std::size_t i = 0; i < nClusters; ++i) {
+		for (std::size_t b = 0; b < nBlocks; ++b) {
+			if (blocks[b].speciesBlock == data.speciesBlocks[i] &&
+				(!blocks[b].split ||
+					(data.starts[i] >= blocks[b].sizeRange[0] &&
+						data.starts[i] <= blocks[b].sizeRange[1]))) {
+				clusterBlocks[i] = b;
+				break;
+			}
+		}
+	}
+
+	BlockEntries entries(nBlocks, std::vector<double>(nBlocks, 0.0));
+	for (auto&& [row, columns] : data.fillMap) {
+		auto rowBlock = clusterBlocks[data.dofClusters[row]];
+		if (rowBlock == nBlocks) {
+			continue;
+		}
+		for (auto column : columns) {
+			auto columnBlock = clusterBlocks[data.dofClusters[column]];
+			if (columnBlock != nBlocks) {
+				entries[rowBlock][columnBlock] += 1.0;
+			}
+		}
+	}
+	return entries;
+}
+} // namespace interface
+} // namespace xolotl
@@ -1,17 +1,24 @@
 #include <petsc.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <fstream>
+#include <numeric>
+#include <sstream>
 
 #include <xolotl/factory/interface/MaterialSubOptionsFactory.h>
 #include <xolotl/interface/IMaterialSubOptions.h>
 #include <xolotl/interface/MultiXolotl.h>
 #include <xolotl/interface/XolotlInterface.h>
 #include <xolotl/io/XFile.h>
+#include <xolotl/perf/IPerfHandler.h>
+#include <xolotl/util/Filesystem.h>
 #include <xolotl/util/GrowthFactorStepSequence.h>
 #include <xolotl/util/LinearStepSequence.h>
 #include <xolotl/util/Log.h>
+#include <xolotl/util/MPIUtils.h>
 #include <xolotl/util/MathUtils.h>
 
 namespace xolotl
@@ -34,8 +41,123 @@ struct PetscContext
 	}
 };
 
+struct GroupContext
+{
+	GroupContext(MPI_Comm groupComm, bool isSplit) :
+		comm(groupComm),
+		split(isSplit)
+	{
+	}
+
+	~GroupContext()
+	{
+		if (split) {
+			MPI_Comm_free(&comm);
+		}
+	}
+
+	MPI_Comm comm;
+	bool split;
+};
+
+/**
+ * Split the processes between the sub-instances proportionally to their
+ * cost, each one getting at least one process.
+ */
+std::vector<int>
+splitProcesses(const std::vector<double>& costs, int nProcs)
+{
+	auto nInstances = costs.size();
+	auto totalCost = std::accumulate(costs.begin(), costs.end(), 0.0);
+	int spare = nProcs - nInstances;
+	std::vector<int> counts(nInstances, 1);
+	std::vector<double> remainders(nInstances, 0.0);
+	int given = 0;
+	for (std::size_t i = 0; i < nInstances; ++i) {
+		auto share = spare * costs[i] / totalCost;
+		auto n = static_cast<int>(std::floor(share));
+		counts[i] += n;
+		given += n;
+		remainders[i] = share - n;
+	}
+
+	// The largest remainders get the processes left
+	std::vector<std::size_t> order(nInstances);
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(),
+		[&](auto a, auto b) { return remainders[a] > remainders[b]; });
+	for (std::size_t k = 0; given < spare; ++k, ++given) {
+		++counts[order[k % nInstances]];
+	}
+
+	return counts;
+}
+
+/**
+ * The relative change between two sets of values, in the L2 norm.
+ */
+double
+relativeChange(
+	const std::vector<double>& current, const std::vector<double>& reference)
+{
+	double diff = 0.0, norm = 0.0;
+	for (std::size_t k = 0; k < current.size(); ++k) {
+		diff += (current[k] - reference[k]) * (current[k] - reference[k]);
+		norm += reference[k] * reference[k];
+	}
+	return std::sqrt(diff) / std::max(std::sqrt(norm), 1.0e-300);
+}
+
+/**
+ * Broadcast a vector of vectors, the receivers don't need to know its shape.
+ */
+template <typename T>
+void
+broadcastNested(std::vector<std::vector<T>>& data, int root, MPI_Comm comm)
+{
+	int rank;
+	MPI_Comm_rank(comm, &rank);
+
+	// Flatten it with the size of each entry
+	std::vector<std::uint64_t> sizes;
+	std::vector<T> flat;
+	if (rank == root) {
+		for (auto&& entry : data) {
+			sizes.push_back(entry.size());
+			flat.insert(flat.end(), entry.begin(), entry.end());
+		}
+	}
+	std::array<std::uint64_t, 2> lengths{sizes.size(), flat.size()};
+	MPI_Bcast(lengths.data(), 2, MPI_UINT64_T, root, comm);
+	sizes.resize(lengths[0]);
+	flat.resize(lengths[1]);
+	MPI_Bcast(sizes.data(), lengths[0], MPI_UINT64_T, root, comm);
+	MPI_Bcast(flat.data(), lengths[1] * sizeof(T), MPI_BYTE, root, comm);
+
+	if (rank != root) {
+		data.clear();
+		auto first = flat.begin();
+		for (auto size : sizes) {
+			data.emplace_back(first, first + size);
+			first += size;
+		}
+	}
+}
+
+//! The first word of the line recording the partition in the restart file
+inline constexpr auto partitionKey = "partition";
+
+//! The first word of the line recording the number of size ranges
+inline constexpr auto subRangesKey = "subRanges";
+
+/**
+ * Read the restart file, the checkpoint file of each instance and the
+ * partition of the sub-instances with its number of size ranges when they
+ * were recorded.
+ */
 auto
-readRestartFile(const std::string& fileName)
+readRestartFile(const std::string& fileName,
+	IMaterialSubOptions::Partition& partition, int& nSubRanges)
 {
 	auto ret = std::vector<std::string>{};
 	if (fileName.empty()) {
@@ -49,6 +171,26 @@ readRestartFile(const std::string& fileName)
 
 	std::string line;
 	while (std::getline(ifs, line)) {
+		auto iss = std::istringstream(line);
+		std::string key;
+		if (iss >> key && key == partitionKey) {
+			// The blocks of each sub-instance, separated by commas
+			std::string group;
+			while (iss >> group) {
+				auto& blockIds = partition.emplace_back();
+				std::replace(group.begin(), group.end(), ',', ' ');
+				auto gss = std::istringstream(group);
+				std::size_t blockId;
+				while (gss >> blockId) {
+					blockIds.push_back(blockId);
+				}
+			}
+			continue;
+		}
+		if (key == subRangesKey) {
+			iss >> nSubRanges;
+			continue;
+		}
 		ret.push_back(line);
 	}
 
@@ -56,7 +198,8 @@ readRestartFile(const std::string& fileName)
 }
 
 void
-writeRestartFile(const std::vector<std::string>& fileNames)
+writeRestartFile(const std::vector<std::string>& fileNames,
+	const IMaterialSubOptions::Partition& partition, int nSubRanges)
 {
 	std::string name = "xolotlRestart.txt";
 	auto ofs = std::ofstream(name);
@@ -66,13 +209,85 @@ writeRestartFile(const std::vector<std::string>& fileNames)
 	for (auto&& name : fileNames) {
 		ofs << name << '\n';
 	}
+	ofs << partitionKey;
+	for (auto&& blockIds : partition) {
+		for (std::size_t k = 0; k < blockIds.size(); ++k) {
+			ofs << (k == 0 ? ' ' : ',') << blockIds[k];
+		}
+	}
+	ofs << '\n';
+	ofs << subRangesKey << ' ' << nSubRanges << '\n';
 	ofs.close();
 	XOLOTL_LOG << "MultiXolotl: Restart file written to: " << name;
 }
 
+//! The checkpoint file shared by all the instances
+inline constexpr auto sharedCheckpointName = "xolotlStop_multi.h5";
+
+//! The file the shared checkpoint is written to before replacing the
+//! previous one
+inline constexpr auto sharedCheckpointTmpName = "xolotlStop_multi.h5.tmp";
+
+/**
+ * Whether the restart file is a checkpoint shared by all the instances rather
+ * than the list of their checkpoint files.
+ */
+bool
+isSharedCheckpoint(const std::string& fileName)
+{
+	return fs::path(fileName).extension() == ".h5";
+}
+
+/**
+ * Open the MultiXolotl group of a shared checkpoint file.
+ */
+std::unique_ptr<io::XFile::MultiGroup>
+openMultiGroup(const io::XFile& xfile, const std::string& fileName)
+{
+	auto multiGroup = xfile.getGroup<io::XFile::MultiGroup>();
+	if (!multiGroup) {
+		throw std::runtime_error(
+			"No MultiXolotl group in the restart file: " + fileName);
+	}
+	return multiGroup;
+}
+
+/**
+ * Convert a box of grid points to the type of the HDF5 file.
+ */
+io::XFile::MultiGroup::GridBox
+toGridBox(const std::array<IdType, 3>& box)
+{
+	return {static_cast<int>(box[0]), static_cast<int>(box[1]),
+		static_cast<int>(box[2])};
+}
+
+/**
+ * Read the value of an option from the PETSc arguments, they are not known
+ * to PETSc yet when the instances are set up.
+ */
+template <typename T>
+bool
+readPetscArg(const std::string& petscArg, const std::string& name, T& value)
+{
+	auto iss = std::istringstream(petscArg);
+	std::string token;
+	while (iss >> token) {
+		if (token == name) {
+			return bool(iss >> value);
+		}
+	}
+	return false;
+}
+
 std::tuple<std::size_t, double, double>
-MultiXolotl::readStopData()
+MultiXolotl::readStopData(const std::string& restartFile)
 {
+	if (isSharedCheckpoint(restartFile)) {
+		io::XFile xfile(restartFile, util::getMPIComm());
+		return openMultiGroup(xfile, restartFile)->readTimes();
+	}
+
 	std::string name = "xolotlStop_data.txt";
 	auto ifs = std::ifstream(name);
 	if (!ifs) {
@@ -94,7 +309,7 @@ MultiXolotl::writeStopData()
 	}
 	auto lastStep = currentStep() - 1;
 
-	io::XFile xfile(_checkpointFiles[1]);
+	io::XFile xfile(_checkpointFiles[1], _groupContext->comm);
 	auto concGroup = xfile.getGroup<io::XFile::ConcentrationGroup>();
 	double lhTime{};
 	double lhDt{};
@@ -126,7 +341,8 @@ makeTimeStepper(const options::IOptions& options)
 
 	auto restarting = (!options.getRestartFilePath().empty());
 	if (restarting) {
-		std::tie(step, startTime, initDt) = MultiXolotl::readStopData();
+		std::tie(step, startTime, initDt) =
+			MultiXolotl::readStopData(options.getRestartFilePath());
 	}
 
 	auto sequence = std::make_unique<util::GrowthFactorStepSequence>(
@@ -144,6 +360,7 @@ MultiXolotl::MultiXolotl(const std::shared_ptr<ComputeContext>& context,
 	_options(options),
 	_timeStepper(makeTimeStepper(*options)),
 	_petscContext(std::make_unique<PetscContext>()),
+	_worldComm(util::getMPIComm()),
 	_restarting(!_options->getRestartFilePath().empty())
 {
 	// Check for restart
@@ -154,65 +371,190 @@ MultiXolotl::MultiXolotl(const std::shared_ptr<ComputeContext>& context,
 		(_options->getPetscArg().find("-start_stop") != std::string::npos);
 	_checkpointFiles.emplace_back("xolotlStop_0.h5");
 
-	// Create primary (whole) network interface
-	auto primaryOpts = _options->makeCopy();
-	primaryOpts->setCheckpointFilePath(_checkpointFiles[0]); // don't need one?
-	primaryOpts->addProcess("noSolve");
-	_primaryInstance = std::make_unique<XolotlInterface>(context, primaryOpts);
+	// Get restart files, or the shared checkpoint file
+	IMaterialSubOptions::Partition partition;
+	int restartSubRanges = 0;
+	std::vector<std::string> restartFiles;
+	std::unique_ptr<io::XFile> sharedFile;
+	std::unique_ptr<io::XFile::MultiGroup> sharedGroup;
+	std::vector<int> sharedSubDOFs;
+	std::vector<double> sharedSubDts;
+	if (_restarting && isSharedCheckpoint(restartFile)) {
+		sharedFile = std::make_unique<io::XFile>(restartFile, _worldComm);
+		sharedGroup = openMultiGroup(*sharedFile, restartFile);
+		for (auto&& blockIds : sharedGroup->readInstances(
+				 restartSubRanges, sharedSubDOFs, sharedSubDts)) {
+			partition.emplace_back(blockIds.begin(), blockIds.end());
+		}
+	}
+	else {
+		restartFiles =
+			readRestartFile(restartFile, partition, restartSubRanges);
+	}
+
+	// Partition the phase space in sub-instances, a restart keeps the
+	// partition and the size ranges of the run it continues
+	auto materialSubOptions =
+		factory::interface::MaterialSubOptionsFactory::get().generate(
+			*_options);
+	int nSubRanges = 1;
+	auto split = readPetscArg(
+		_options->getPetscArg(), "-multi_sub_ranges", nSubRanges);
+	nSubRanges = std::max(nSubRanges, 1);
+	if (restartSubRanges > 0) {
+		// The block ids of the recorded partition depend on the size ranges
+		if (split && nSubRanges != restartSubRanges) {
+			auto msgstrm = std::stringstream()
+				<< "MultiXolotl: -multi_sub_ranges (" << nSubRanges
+				<< ") must match the number of size ranges of the restart ("
+				<< restartSubRanges << ")";
+			XOLOTL_ERROR(std::runtime_error, msgstrm.str());
+		}
+		nSubRanges = restartSubRanges;
+	}
+	_nSubRanges = nSubRanges;
+	if (_nSubRanges > 1) {
+		materialSubOptions->splitSizeRanges(_nSubRanges);
+	}
+	if (partition.empty()) {
+		partition = materialSubOptions->getDefaultPartition();
+		double maxCoupling = 1.0;
+		auto balanced = readPetscArg(
+			_options->getPetscArg(), "-multi_max_coupling", maxCoupling);
+		if (!_restarting && balanced) {
+			partition = materialSubOptions->getBalancedPartition(maxCoupling);
+		}
+	}
+	if (util::getMPIRank() == 0) {
+		auto msgstrm = std::stringstream() << "MultiXolotl: Partition";
+		for (auto&& blockIds : partition) {
+			msgstrm << " {";
+			for (auto blockId : blockIds) {
+				msgstrm << " " << blockId;
+			}
+			msgstrm << " }";
+		}
+		XOLOTL_LOG << msgstrm.str();
+	}
 
 	// Generate suboptions
-	auto subOptions = factory::interface::MaterialSubOptionsFactory::get()
-						  .generate(*_options)
-						  ->getSubOptions();
+	auto subOptions = materialSubOptions->getSubOptions(partition);
+	_partition = partition;
+
+	// Split the processes in groups solving the sub-instances concurrently,
+	// the size of each group follows the estimated cost of its sub-instance
+	int worldRank, worldSize;
+	MPI_Comm_rank(_worldComm, &worldRank);
+	MPI_Comm_size(_worldComm, &worldSize);
+	auto concurrent = (_options->getPetscArg().find("-multi_concurrent") !=
+		std::string::npos);
+	int myInstance = -1;
+	if (concurrent && subOptions.size() > 1 && worldSize >= subOptions.size()) {
+		auto costs = materialSubOptions->getCosts(partition);
+		auto counts = splitProcesses(costs, worldSize);
+		int first = 0;
+		for (int id = 0; id < subOptions.size(); ++id) {
+			_groupRoots.push_back(first);
+			if (worldRank >= first && worldRank < first + counts[id]) {
+				myInstance = id;
+			}
+			first += counts[id];
+		}
+		MPI_Comm groupComm;
+		MPI_Comm_split(_worldComm, myInstance, worldRank, &groupComm);
+		_groupContext = std::make_unique<GroupContext>(groupComm, true);
+		if (worldRank == 0) {
+			auto msgstrm = std::stringstream()
+				<< "MultiXolotl: Solving the sub-instances concurrently with";
+			for (auto count : counts) {
+				msgstrm << " " << count;
+			}
+			msgstrm << " process(es)";
+			XOLOTL_LOG << msgstrm.str();
+		}
+	}
+	else {
+		if (concurrent && worldRank == 0) {
+			XOLOTL_LOG << "MultiXolotl: Not enough processes to solve the "
+						  "sub-instances concurrently";
+		}
+		_groupContext = std::make_unique<GroupContext>(_worldComm, false);
+	}
+	auto groupComm = _groupContext->comm;
 
-	// Get restart files
-	auto restartFiles = readRestartFile(restartFile);
-	if (_restarting && restartFiles.size() != (subOptions.size() + 1)) {
+	// Create primary (whole) network interface, each group has one
+	auto primaryOpts = _options->makeCopy();
+	primaryOpts->setCheckpointFilePath(_checkpointFiles[0]); // don't need one?
+	primaryOpts->addProcess("noSolve");
+	_primaryInstance =
+		std::make_unique<XolotlInterface>(context, primaryOpts, groupComm);
+
+	// Check the restart files
+	if (sharedFile) {
+		// The instances start from scratch and get the concentrations of
+		// the shared file once their solver is initialized
+		primaryOpts->setRestartFilePath("");
+	}
+	else if (_restarting && restartFiles.size() != (subOptions.size() + 1)) {
 		auto msgstrm = std::stringstream()
 			<< "MultiXolotl: Number of restart files (" << restartFiles.size()
 			<< ") must match number of instances (" << (subOptions.size() + 1)
 			<< ")";
 		XOLOTL_ERROR(std::runtime_error, msgstrm.str());
 	}
-	if (_restarting) {
+	if (_restarting && !sharedFile) {
 		primaryOpts->setRestartFilePath(restartFiles[0]);
 	}
 
 	// Create subinstances
-	std::vector<std::vector<std::vector<std::uint32_t>>> allBounds;
-	std::vector<std::vector<std::vector<xolotl::IdType>>> allMomIdInfo;
+	std::vector<std::vector<std::vector<std::uint32_t>>> allBounds(
+		subOptions.size());
+	std::vector<std::vector<std::vector<xolotl::IdType>>> allMomIdInfo(
+		subOptions.size());
 	for (int id = 0; id < subOptions.size(); ++id) {
 		auto& subOpts = subOptions[id];
 
 		// Handle restart and checkpoint files
-		if (_restarting) {
+		if (sharedFile) {
+			subOpts->setRestartFilePath("");
+		}
+		else if (_restarting) {
 			subOpts->setRestartFilePath(restartFiles[id + 1]);
 		}
 		const auto& ckFile = _checkpointFiles.emplace_back(
 			"xolotlStop_" + std::to_string(id + 1) + ".h5");
 		subOpts->setCheckpointFilePath(ckFile);
 
+		// Constant rate capsules
+		_constantRates.push_back(_primaryInstance->makeRatesCapsule());
+
+		// Only the sub-instances of our group are constructed here
+		auto& sub = _subInstances.emplace_back();
+		if (!_groupRoots.empty() && id != myInstance) {
+			continue;
+		}
+
 		// Construct subinstance
 		subOpts->addProcess("constant");
-		auto& sub = _subInstances.emplace_back(
-			std::make_unique<XolotlInterface>(context, subOpts));
-
-		// Bounds
-		auto bounds = sub->getAllClusterBounds();
-		allBounds.push_back(bounds);
-		_subDOFs.push_back(bounds.size());
+		sub = std::make_unique<XolotlInterface>(context, subOpts, groupComm);
 
-		// Moment Ids
-		auto momIdInfo = sub->getAllMomentIdInfo();
-		allMomIdInfo.push_back(momIdInfo);
+		// Bounds and moment Ids
+		allBounds[id] = sub->getAllClusterBounds();
+		allMomIdInfo[id] = sub->getAllMomentIdInfo();
+	}
 
-		// Constant rate capsules
-		_constantRates.push_back(sub->makeRatesCapsule());
+	// Share the network description between the groups
+	for (int id = 0; id < _groupRoots.size(); ++id) {
+		broadcastNested(allBounds[id], _groupRoots[id], _worldComm);
+		broadcastNested(allMomIdInfo[id], _groupRoots[id], _worldComm);
+	}
+	for (auto&& bounds : allBounds) {
+		_subDOFs.push_back(bounds.size());
 	}
 
 	// Write restart file
 	if (_checkpointing) {
-		writeRestartFile(_checkpointFiles);
+		writeRestartFile(_checkpointFiles, partition, _nSubRanges);
 	}
 
 	// Pass data to primary
@@ -224,75 +566,257 @@ MultiXolotl::MultiXolotl(const std::shared_ptr<ComputeContext>& context,
 	_primaryInstance->initializeRateEntries(connectivities);
 	for (IdType i = 0; i < _subInstances.size(); ++i) {
 		auto& sub = _subInstances[i];
+		if (!sub) {
+			continue;
+		}
 		sub->setConstantConnectivities(connectivities[i]);
 		sub->initializeReactions();
 		sub->initializeSolver();
 	}
 
+	// Restart from the shared checkpoint file
+	if (sharedFile) {
+		std::vector<int> subDOFs(_subDOFs.begin(), _subDOFs.end());
+		if (sharedSubDOFs != subDOFs) {
+			XOLOTL_ERROR(std::runtime_error,
+				"MultiXolotl: The sub-instances of the restart file do not "
+				"match the ones of this run");
+		}
+		auto time = std::get<1>(sharedGroup->readTimes());
+		for (int id = 0; id < _subInstances.size(); ++id) {
+			// All the processes take part in the read
+			auto& sub = _subInstances[id];
+			std::array<IdType, 3> start{}, count{}, globalSize{};
+			if (sub) {
+				sub->getLocalGridBox(start, count, globalSize);
+			}
+			int nValues = 0;
+			auto concs = sharedGroup->readConcentrations(
+				id, toGridBox(start), toGridBox(count), nValues);
+			if (!sub) {
+				continue;
+			}
+			if (nValues != sub->getDOF() + 1) {
+				XOLOTL_ERROR(std::runtime_error,
+					"MultiXolotl: Wrong number of values per grid point in "
+					"the restart file");
+			}
+			sub->registerConcentrationBuffer(concs.data());
+			sub->importConcentrations();
+			sub->registerConcentrationBuffer(nullptr);
+			sub->setCurrentTimes(time, sharedSubDts[id]);
+		}
+	}
+
 	// Fluxes
 	auto fluxVector = _primaryInstance->getImplantedFlux();
 	for (IdType i = 0; i < _subInstances.size(); ++i) {
-		_subInstances[i]->setImplantedFlux(fluxVector[i]);
+		if (_subInstances[i]) {
+			_subInstances[i]->setImplantedFlux(fluxVector[i]);
+		}
 	}
+
+	// Refresh policy of the constant rates
+	PetscReal refreshTolerance = 0.0;
+	PetscInt maxRefreshInterval = 1;
+	PetscCallVoid(PetscOptionsGetReal(
+		NULL, NULL, "-multi_refresh_tol", &refreshTolerance, NULL));
+	PetscCallVoid(PetscOptionsGetInt(
+		NULL, NULL, "-multi_refresh_max_interval", &maxRefreshInterval, NULL));
+	_refreshTolerance = refreshTolerance;
+	_maxRefreshInterval = std::max<PetscInt>(maxRefreshInterval, 1);
+	_skippedRefreshCounter =
+		_primaryInstance->getPerfHandler()->getEventCounter(
+			"multi_skipped_refreshes");
+
+	// Shared checkpoint file
+	PetscInt sharedCheckpointStride = 0;
+	PetscCallVoid(PetscOptionsGetInt(NULL, NULL, "-multi_shared_checkpoint",
+		&sharedCheckpointStride, NULL));
+	_sharedCheckpointStride = std::max<PetscInt>(sharedCheckpointStride, 0);
 }
 
 MultiXolotl::SubInstanceData
 MultiXolotl::getSubInstanceData()
 {
+	// The temperature is the same in all the sub-instances
+	auto firstSub = std::find_if(_subInstances.begin(), _subInstances.end(),
+		[](auto&& sub) { return bool(sub); });
+	assert(firstSub != _subInstances.end());
 	std::vector<double> temperatures;
 	std::vector<double> depths;
-	_subInstances[0]->getNetworkTemperature(temperatures, depths);
-	// Loop on the grid points
-	std::vector<std::vector<std::vector<double>>> fullConc;
-	// 0D
-	if (temperatures.size() < 2) {
-		std::vector<std::vector<double>> conc;
-		// Loop on the sub interfaces to get all the concentrations
-		for (auto i = 0; i < _subInstances.size(); i++) {
-			auto sparseConc = _subInstances[i]->getConcVector();
-			std::vector<double> subConc(_subDOFs[i], 0.0);
-			for (auto pair : sparseConc[0][0][0]) {
-				if (pair.first < _subDOFs[i])
-					subConc[pair.first] = pair.second;
-			}
-			conc.push_back(subConc);
+	(*firstSub)->getNetworkTemperature(temperatures, depths);
+
+	// Export the concentrations of each sub-instance once, the buffers are
+	// reused from one step to the next
+	_subConcs.resize(_subInstances.size());
+	std::vector<IdType> nLocalPoints(_subInstances.size(), 0);
+	for (auto i = 0; i < _subInstances.size(); i++) {
+		if (_subInstances[i]) {
+			nLocalPoints[i] =
+				_subInstances[i]->getConcentrations(_subDOFs[i], _subConcs[i]);
+		}
+	}
+
+	// Get the other sub-instances from the other groups
+	IdType nGrid = (temperatures.size() < 2) ? 1 : temperatures.size() - 2;
+	IdType offset = 0;
+	if (!_groupRoots.empty()) {
+		offset = exchangeConcentrations(nLocalPoints);
+		// 0D
+		if (temperatures.size() < 2) {
+			offset = 0;
 		}
-		fullConc.push_back(conc);
 	}
-	// 1D
-	else {
-		// Loop on the grid points
-		for (auto j = 0; j < temperatures.size() - 2; j++) {
-			std::vector<std::vector<double>> conc;
-			// Loop on the sub interfaces to get all the concentrations
-			for (auto i = 0; i < _subInstances.size(); i++) {
-				auto sparseConc = _subInstances[i]->getConcVector();
-				std::vector<double> subConc(_subDOFs[i], 0.0);
-				for (auto pair : sparseConc[0][0][j]) {
-					if (pair.first < _subDOFs[i]) {
-						subConc[pair.first] = pair.second;
-					}
-				}
-				conc.push_back(subConc);
-			}
 
-			fullConc.push_back(conc);
+	// Split them by grid point (a single one in 0D)
+	std::vector<std::vector<std::vector<double>>> fullConc(nGrid);
+	for (IdType j = 0; j < nGrid; j++) {
+		auto& conc = fullConc[j];
+		conc.reserve(_subInstances.size());
+		for (auto i = 0; i < _subInstances.size(); i++) {
+			auto first = _subConcs[i].begin() + (offset + j) * _subDOFs[i];
+			conc.emplace_back(first, first + _subDOFs[i]);
 		}
 	}
 	return {temperatures, depths, fullConc};
 }
 
+IdType
+MultiXolotl::exchangeConcentrations(const std::vector<IdType>& nLocalPoints)
+{
+	auto groupComm = _groupContext->comm;
+	int groupRank, groupSize;
+	MPI_Comm_rank(groupComm, &groupRank);
+	MPI_Comm_size(groupComm, &groupSize);
+
+	// Gather the whole grid of our sub-instance, the local grids follow the
+	// rank order
+	IdType offset = 0;
+	for (auto i = 0; i < _subInstances.size(); i++) {
+		if (!_subInstances[i]) {
+			continue;
+		}
+		int myCount = nLocalPoints[i] * _subDOFs[i];
+		std::vector<int> counts(groupSize, 0), displs(groupSize, 0);
+		MPI_Allgather(
+			&myCount, 1, MPI_INT, counts.data(), 1, MPI_INT, groupComm);
+		std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+		offset = displs[groupRank] / _subDOFs[i];
+
+		std::vector<double> wholeGrid(displs.back() + counts.back());
+		MPI_Allgatherv(_subConcs[i].data(), myCount, MPI_DOUBLE,
+			wholeGrid.data(), counts.data(), displs.data(), MPI_DOUBLE,
+			groupComm);
+		_subConcs[i] = std::move(wholeGrid);
+	}
+
+	// Broadcast each of them from its group
+	for (auto i = 0; i < _subInstances.size(); i++) {
+		std::uint64_t size = _subConcs[i].size();
+		MPI_Bcast(&size, 1, MPI_UINT64_T, _groupRoots[i], _worldComm);
+		_subConcs[i].resize(size);
+		MPI_Bcast(_subConcs[i].data(), size, MPI_DOUBLE, _groupRoots[i],
+			_worldComm);
+	}
+
+	return offset;
+}
+
+void
+MultiXolotl::writeSharedCheckpoint()
+{
+	auto nInstances = _subInstances.size();
+
+	// Export the concentrations of our sub-instances, every process needs
+	// the size of all of them and the time step of their solver
+	std::vector<std::array<IdType, 3>> starts(nInstances), counts(nInstances);
+	std::vector<std::uint64_t> sizes(4 * nInstances, 0);
+	std::vector<double> subDts(nInstances, 0.0);
+	std::vector<std::vector<double>> blocks(nInstances);
+	for (auto i = 0; i < nInstances; i++) {
+		auto& sub = _subInstances[i];
+		if (!sub) {
+			continue;
+		}
+		std::array<IdType, 3> globalSize;
+		sub->getLocalGridBox(starts[i], counts[i], globalSize);
+		std::copy(globalSize.begin(), globalSize.end(), &sizes[4 * i]);
+		sizes[4 * i + 3] = sub->getDOF() + 1;
+		subDts[i] = sub->getCurrentDt();
+		blocks[i].resize(
+			counts[i][0] * counts[i][1] * counts[i][2] * sizes[4 * i + 3]);
+		sub->registerConcentrationBuffer(blocks[i].data());
+		sub->exportConcentrations();
+		sub->registerConcentrationBuffer(nullptr);
+	}
+	if (!_groupRoots.empty()) {
+		MPI_Allreduce(MPI_IN_PLACE, sizes.data(), sizes.size(), MPI_UINT64_T,
+			MPI_MAX, _worldComm);
+		MPI_Allreduce(MPI_IN_PLACE, subDts.data(), subDts.size(), MPI_DOUBLE,
+			MPI_MAX, _worldComm);
+	}
+
+	// Write everything in a single collective pass, to a temporary file so
+	// that the previous checkpoint stays valid until this one is complete
+	{
+		io::XFile xfile(sharedCheckpointTmpName, 0, _worldComm);
+		io::XFile::MultiGroup multiGroup(xfile, true);
+		auto [step, time, dt] = _lastSolvedStep;
+		multiGroup.writeTimes(step, time, dt);
+		io::XFile::MultiGroup::Partition partition;
+		for (auto&& blockIds : _partition) {
+			partition.emplace_back(blockIds.begin(), blockIds.end());
+		}
+		multiGroup.writeInstances(partition, _nSubRanges,
+			std::vector<int>(_subDOFs.begin(), _subDOFs.end()), subDts);
+		for (auto i = 0; i < nInstances; i++) {
+			auto size = &sizes[4 * i];
+			io::XFile::MultiGroup::GridBox globalSize{static_cast<int>(size[0]),
+				static_cast<int>(size[1]), static_cast<int>(size[2])};
+			multiGroup.writeConcentrations(i, globalSize, toGridBox(starts[i]),
+				toGridBox(counts[i]), size[3], blocks[i].data());
+		}
+	}
+
+	// Replace the previous checkpoint once the file is closed
+	MPI_Barrier(_worldComm);
+	int worldRank;
+	MPI_Comm_rank(_worldComm, &worldRank);
+	if (worldRank == 0) {
+		fs::rename(sharedCheckpointTmpName, sharedCheckpointName);
+	}
+	MPI_Barrier(_worldComm);
+	_sharedCheckpointCurrent = true;
+
+	if (util::getMPIRank() == 0) {
+		XOLOTL_LOG << "MultiXolotl: Shared checkpoint written to: "
+				   << sharedCheckpointName;
+	}
+}
+
+bool
+MultiXolotl::isOutputGroup() const
+{
+	return _groupRoots.empty() || _subInstances[0];
+}
+
 MultiXolotl::~MultiXolotl()
 {
-	// Print the result
+	// Print the result, only one group writes it
 	auto data = getSubInstanceData();
-	_primaryInstance->outputData(previousTime(), data.fullConc,
-		std::max((int)data.temperatures.size() - 2, 1));
+	if (isOutputGroup()) {
+		_primaryInstance->outputData(previousTime(), data.fullConc,
+			std::max((int)data.temperatures.size() - 2, 1));
+	}
 
 	// Write stop data
-	if (_checkpointing) {
+	if (_checkpointing && isOutputGroup()) {
 		writeStopData();
 	}
+	if (_sharedCheckpointStride > 0 && !_sharedCheckpointCurrent) {
+		writeSharedCheckpoint();
+	}
 }
 
 double
@@ -337,48 +861,113 @@ MultiXolotl::solveXolotl()
 }
 
 void
-MultiXolotl::updateTemperaturesAndRates(
-	std::size_t gridIndex, const SubInstanceData& data)
+MultiXolotl::updateTemperaturesAndRates(const SubInstanceData& data)
 {
-	std::vector<double> temperature = {data.temperatures[gridIndex]};
-	std::vector<double> depth = {data.depths[gridIndex]};
-	_primaryInstance->setNetworkTemperature(temperature, depth);
+	// Skip the ghost points in 1D
+	std::vector<double> temperatures = data.temperatures;
+	std::vector<double> depths = data.depths;
+	IdType firstGridIndex = 0;
+	if (temperatures.size() >= 2) {
+		temperatures = std::vector<double>(
+			data.temperatures.begin() + 1, data.temperatures.end() - 1);
+		depths = std::vector<double>(
+			data.depths.begin() + 1, data.depths.end() - 1);
+		firstGridIndex = 1;
+	}
 
-	// TODO: Just include (empty) ghost entries so the indices will line up
-	//       (This would require more extensive refactoring)
-	const auto& conc = data.fullConc.size() == 1 ? data.fullConc[0] :
-												   data.fullConc[gridIndex - 1];
-	_primaryInstance->computeConstantRates(conc, 0, _constantRates);
+	// The grid points are computed at once
+	auto gridRows = selectRefreshRows(data.fullConc, temperatures);
+	if (gridRows.empty()) {
+		return;
+	}
+	_primaryInstance->computeConstantRates(
+		data.fullConc, temperatures, depths, gridRows, _constantRates);
 
 	// Update sub-instances
 	for (auto i = 0; i < _subInstances.size(); i++) {
-		_subInstances[i]->setConstantRates(_constantRates[i], gridIndex);
+		if (_subInstances[i]) {
+			_subInstances[i]->setConstantRates(
+				_constantRates[i], firstGridIndex, gridRows);
+		}
 	}
 }
 
+std::vector<IdType>
+MultiXolotl::selectRefreshRows(
+	const std::vector<std::vector<std::vector<double>>>& conc,
+	const std::vector<double>& temperatures)
+{
+	IdType nGrid = conc.size();
+	std::vector<IdType> gridRows;
+
+	// Every grid point at every step by default
+	if (_refreshTolerance <= 0.0) {
+		gridRows.resize(nGrid);
+		std::iota(gridRows.begin(), gridRows.end(), 0);
+		return gridRows;
+	}
+
+	// Every grid point the first time
+	bool refreshAll = (_refreshConcs.size() != nGrid);
+	if (refreshAll) {
+		_refreshConcs.resize(nGrid);
+		_refreshTemperatures.resize(nGrid);
+		_refreshInterval = 1;
+		_stepsSinceCheck = 0;
+	}
+	// Otherwise the grid points are only checked once per interval
+	else if (++_stepsSinceCheck < _refreshInterval) {
+		_skippedRefreshCounter->increment(nGrid);
+		return gridRows;
+	}
+	_stepsSinceCheck = 0;
+
+	for (IdType j = 0; j < nGrid; j++) {
+		bool refresh = refreshAll ||
+			std::fabs(temperatures[j] - _refreshTemperatures[j]) >
+				_refreshTolerance * std::fabs(_refreshTemperatures[j]);
+		for (auto i = 0; !refresh && i < conc[j].size(); i++) {
+			refresh = relativeChange(conc[j][i], _refreshConcs[j][i]) >
+				_refreshTolerance;
+		}
+
+		if (refresh) {
+			gridRows.push_back(j);
+			_refreshConcs[j] = conc[j];
+			_refreshTemperatures[j] = temperatures[j];
+		}
+	}
+	_skippedRefreshCounter->increment(nGrid - gridRows.size());
+
+	// Check less often while nothing changes
+	if (gridRows.empty()) {
+		_refreshInterval = std::min(2 * _refreshInterval, _maxRefreshInterval);
+	}
+	else {
+		_refreshInterval = 1;
+	}
+
+	return gridRows;
+}
+
 void
 MultiXolotl::solveStep()
 {
 	// Transfer the temperature to the full network
 	auto subInstanceData = getSubInstanceData();
-	// 0D
-	if (subInstanceData.temperatures.size() < 2) {
-		updateTemperaturesAndRates(0, subInstanceData);
-	}
-	// 1D
-	else {
-		// Loop on the grid points
-		for (auto j = 0; j < subInstanceData.temperatures.size() - 2; j++) {
-			updateTemperaturesAndRates(j + 1, subInstanceData);
-		}
-	}
+	updateTemperaturesAndRates(subInstanceData);
 
 	// Print the result
-	_primaryInstance->outputData(previousTime(), subInstanceData.fullConc,
-		std::max((int)subInstanceData.temperatures.size() - 2, 1));
+	if (isOutputGroup()) {
+		_primaryInstance->outputData(previousTime(), subInstanceData.fullConc,
+			std::max((int)subInstanceData.temperatures.size() - 2, 1));
+	}
 
-	// Solve
+	// Solve, the groups advance concurrently until the next exchange
 	for (auto&& sub : _subInstances) {
+		if (!sub) {
+			continue;
+		}
 		// Set the time we want to reach
 		sub->setTimes(currentTime(), currentDt());
 		// Provide our current step as the external control step
@@ -386,6 +975,15 @@ MultiXolotl::solveStep()
 		// Run the solver
 		sub->solveXolotl();
 	}
+
+	// Checkpoint the state reached
+	if (_sharedCheckpointStride > 0) {
+		_lastSolvedStep = {currentStep(), currentTime(), currentDt()};
+		_sharedCheckpointCurrent = false;
+		if (currentStep() % _sharedCheckpointStride == 0) {
+			writeSharedCheckpoint();
+		}
+	}
 }
 } // namespace interface
 } // namespace xolotl
@@ -11,6 +11,7 @@
 #include <xolotl/interface/XolotlInterface.h>
 #include <xolotl/options/Options.h>
 #include <xolotl/perf/IPerfHandler.h>
+#include <xolotl/solver/BufferLayout.h>
 #include <xolotl/solver/Solver.h>
 #include <xolotl/solver/handler/ISolverHandler.h>
 #include <xolotl/util/Log.h>
@@ -248,6 +249,62 @@ XolotlInterface::getConcVector() TRY
 }
 CATCH
 
+IdType
+XolotlInterface::getConcentrations(
+	IdType nComponents, std::vector<double>& concs) TRY
+{
+	return solver->getConcentrations(nComponents, concs);
+}
+CATCH
+
+void
+XolotlInterface::registerConcentrationBuffer(double* buffer,
+	const std::vector<IdType>& ids, IdType componentStride,
+	const std::array<IdType, 3>& pointStrides) TRY
+{
+	_concBuffer = buffer;
+	_concLayout = std::make_shared<solver::BufferLayout>(
+		solver::BufferLayout{ids, componentStride, pointStrides});
+}
+CATCH
+
+void
+XolotlInterface::exportConcentrations() TRY
+{
+	if (!_concBuffer) {
+		throw std::runtime_error(
+			"No concentration buffer was registered to export to.");
+	}
+	solver->getConcentrations(*_concLayout, _concBuffer);
+}
+CATCH
+
+void
+XolotlInterface::importConcentrations() TRY
+{
+	if (!_concBuffer) {
+		throw std::runtime_error(
+			"No concentration buffer was registered to import from.");
+	}
+	solver->setConcentrations(*_concLayout, _concBuffer);
+}
+CATCH
+
+IdType
+XolotlInterface::getDOF() TRY
+{
+	return solverCast(solver)->getSolverHandler()->getNetwork().getDOF();
+}
+CATCH
+
+void
+XolotlInterface::getLocalGridBox(std::array<IdType, 3>& start,
+	std::array<IdType, 3>& count, std::array<IdType, 3>& globalSize) TRY
+{
+	solver->getLocalGridBox(start, count, globalSize);
+}
+CATCH
+
 void
 XolotlInterface::setConcVector(std::vector<
 	std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
@@ -308,6 +365,13 @@ XolotlInterface::getTS() TRY
 }
 CATCH
 
+std::shared_ptr<perf::IPerfHandler>
+XolotlInterface::getPerfHandler() TRY
+{
+	return solverCast(solver)->getSolverHandler()->getPerfHandler();
+}
+CATCH
+
 std::vector<double>
 XolotlInterface::getGridInfo(double& hy, double& hz) TRY
 {
@@ -419,7 +483,12 @@ CATCH
 
 struct RatesCapsule
 {
-	core::network::IReactionNetwork::RatesView view;
+	core::network::IReactionNetwork::GridRatesView view;
+};
+
+struct ConcentrationsCapsule
+{
+	Kokkos::View<double**, Kokkos::LayoutRight> view;
 };
 
 std::shared_ptr<RatesCapsule>
@@ -430,45 +499,77 @@ XolotlInterface::makeRatesCapsule() const TRY
 CATCH
 
 void
-XolotlInterface::setConstantRates(
-	const std::shared_ptr<RatesCapsule>& rates, IdType gridIndex) TRY
+XolotlInterface::setConstantRates(const std::shared_ptr<RatesCapsule>& rates,
+	IdType firstGridIndex, const std::vector<IdType>& gridRows) TRY
 {
 	// Get the network
 	auto& network = solverCast(solver)->getSolverHandler()->getNetwork();
-	network.setConstantRates(rates->view, gridIndex);
+	for (auto j : gridRows) {
+		network.setConstantRates(
+			subview(rates->view, j, Kokkos::ALL), firstGridIndex + j);
+	}
 }
 CATCH
 
 void
-XolotlInterface::computeConstantRates(std::vector<std::vector<double>> conc,
-	IdType gridIndex, std::vector<std::shared_ptr<RatesCapsule>>& rates) TRY
+XolotlInterface::computeConstantRates(
+	const std::vector<std::vector<std::vector<double>>>& conc,
+	const std::vector<double>& temperatures, const std::vector<double>& depths,
+	const std::vector<IdType>& gridRows,
+	std::vector<std::shared_ptr<RatesCapsule>>& rates) TRY
 {
 	assert(rates.size() == fromSubNetwork.size());
+	assert(temperatures.size() == conc.size());
 
 	// Get the network
 	auto& network = solverCast(solver)->getSolverHandler()->getNetwork();
 	const auto dof = network.getDOF();
+	const IdType nGrid = conc.size();
 
-	// Construct the full concentration vector first
-	std::vector<double> fullConc(dof, 0.0);
-	for (auto i = 0; i < conc.size(); i++) {
-		for (auto j = 0; j < conc[i].size(); j++) {
-			fullConc[fromSubNetwork[i][j]] = conc[i][j];
-		}
+	// The network holds the rates of every grid point
+	if (network.getGridSize() != nGrid) {
+		network.setGridSize(nGrid);
 	}
+	network.setTemperatures(temperatures, depths);
 
-	auto hConcs =
-		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>(
-			fullConc.data(), dof);
-	auto dConcs = Kokkos::View<double*>("Concentrations", dof);
+	// Construct the full concentrations of the grid points first
+	if (!_constantConcs) {
+		_constantConcs = std::make_shared<ConcentrationsCapsule>();
+	}
+	auto& dConcs = _constantConcs->view;
+	if (dConcs.extent(0) != nGrid || dConcs.extent(1) != dof) {
+		dConcs = Kokkos::View<double**, Kokkos::LayoutRight>(
+			"Concentrations", nGrid, dof);
+	}
+	auto hConcs = create_mirror_view(dConcs);
+	Kokkos::deep_copy(hConcs, 0.0);
+	std::vector<core::network::IReactionNetwork::GridPoint> points;
+	for (auto j : gridRows) {
+		for (auto i = 0; i < conc[j].size(); i++) {
+			for (auto k = 0; k < conc[j][i].size(); k++) {
+				hConcs(j, fromSubNetwork[i][k]) = conc[j][i][k];
+			}
+		}
+		points.push_back({j, j, j, 0.0, 0.0});
+	}
 	deep_copy(dConcs, hConcs);
 
-	// Loop on the sub network maps
+	// Loop on the sub network maps, the rate buffers are allocated once
 	for (auto l = 0; l < fromSubNetwork.size(); l++) {
-		// TODO: should this allocation happen only once (in makeRatesCapsule)?
-		//       (we'd still need to zero out the data here)
-		rates[l]->view = Kokkos::View<double*>("dRates", _subEntries[l]);
-		network.computeConstantRates(dConcs, rates[l]->view, l, gridIndex);
+		auto& view = rates[l]->view;
+		if (view.extent(0) != nGrid || view.extent(1) != _subEntries[l]) {
+			view = core::network::IReactionNetwork::GridRatesView(
+				"dRates", nGrid, _subEntries[l]);
+		}
+		else if (gridRows.size() == nGrid) {
+			Kokkos::deep_copy(view, 0.0);
+		}
+		else {
+			for (auto j : gridRows) {
+				Kokkos::deep_copy(subview(view, j, Kokkos::ALL), 0.0);
+			}
+		}
+		network.computeGridConstantRates(dConcs, view, l, points);
 	}
 }
 CATCH
@@ -482,31 +583,10 @@ XolotlInterface::getConstantConnectivities() TRY
 	// Loop on the sub network maps
 	std::vector<std::pair<std::vector<IdType>, std::vector<IdType>>> toReturn;
 	for (auto l = 0; l < fromSubNetwork.size(); l++) {
-		// Get the sub DOF and initialize the connectivity map
-		auto subDOF = fromSubNetwork[l].size();
-		std::vector<IdType> rows;
-		std::vector<IdType> entries;
-		auto dConns = Kokkos::View<bool**>("dConns", subDOF, subDOF + 1);
-		auto hConns = Kokkos::create_mirror_view(dConns);
-		network.getConstantConnectivities(dConns, l);
-
-		deep_copy(hConns, dConns);
-		// Create the sparse connectivity
-		rows.push_back(0);
-		for (auto i = 0; i < hConns.extent(0); i++) {
-			IdType count = 0;
-			for (auto j = 0; j < hConns.extent(1); j++) {
-				if (hConns(i, j)) {
-					entries.push_back(j);
-					count++;
-				}
-			}
-			rows.push_back(rows.back() + count);
-		}
-		_subEntries.push_back(entries.size());
-		toReturn.push_back(
-			std::make_pair<std::vector<IdType>, std::vector<IdType>>(
-				std::move(rows), std::move(entries)));
+		// Get the sparse connectivity of this sub network
+		auto conns = network.getConstantConnectivities(l);
+		_subEntries.push_back(conns.second.size());
+		toReturn.push_back(std::move(conns));
 	}
 
 	return toReturn;
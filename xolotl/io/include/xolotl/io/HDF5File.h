@@ -3,6 +3,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <mpi.h>
@@ -229,6 +230,11 @@ public:
 		DataSetTBase(const HDF5Object& loc, std::string dsetName,
 			const DataSpace& dspace);
 
+		// Create data set with the given creation properties
+		// (chunking, filters, ...).
+		DataSetTBase(const HDF5Object& loc, std::string dsetName,
+			const DataSpace& dspace, const PropertyList& createProps);
+
 		// Open existing data set.
 		DataSetTBase(const HDF5Object& loc, std::string dsetName);
 	};
@@ -250,6 +256,13 @@ public:
 		{
 		}
 
+		// Create data set with the given creation properties.
+		DataSet(const HDF5Object& loc, std::string dsetName,
+			const DataSpace& dspace, const PropertyList& createProps) :
+			DataSetTBase<T>(loc, dsetName, dspace, createProps)
+		{
+		}
+
 		// Open existing data set.
 		DataSet(const HDF5Object& loc, std::string dsetName) :
 			DataSetTBase<T>(loc, dsetName)
@@ -299,6 +312,10 @@ public:
 	// Common base for all ragged data set classes.
 	class RaggedDataSetBase
 	{
+	public:
+		/// A range of rows: the first row and the number of rows.
+		using RowRange = std::pair<uint32_t, uint32_t>;
+
 	protected:
 		/// Concise name for type of flattened index metadata.
 		using FlatStartingIndicesType = std::vector<uint32_t>;
@@ -324,6 +341,29 @@ public:
 		RaggedDataSetBase(MPI_Comm _comm) : comm(_comm)
 		{
 		}
+
+		/**
+		 * Merge the ranges that follow each other and drop the empty
+		 * ones, so that they are read or written with as few contiguous
+		 * requests as possible.
+		 *
+		 * @param ranges The ranges, sorted by first row and disjoint.
+		 * @return The merged ranges.
+		 */
+		static std::vector<RowRange>
+		mergeRanges(const std::vector<RowRange>& ranges);
+
+		/**
+		 * Select the union of the given (offset, count) blocks in a 1D
+		 * dataspace, or nothing if there are none.
+		 *
+		 * @param spaceId The dataspace.
+		 * @param blocks The blocks, disjoint and sorted by offset.
+		 * @return The total number of selected elements.
+		 */
+		static uint32_t
+		selectBlocks(
+			hid_t spaceId, const std::vector<std::array<hsize_t, 2>>& blocks);
 	};
 
 	// A DataSet for "Ragged" 2D data.  (I.e., 2D data where the
@@ -337,10 +377,11 @@ public:
 		/// Concise name for Ragged data type.
 		using Ragged2DType = std::vector<std::vector<T>>;
 
-	private:
 		/// Concise name for type of flattened data.
 		using FlatType = std::vector<T>;
 
+	private:
+
 		/**
 		 * Determine the number of values per grid point.
 		 *
@@ -434,6 +475,22 @@ public:
 		RaggedDataSet2D(MPI_Comm comm, const HDF5Object& loc,
 			std::string dsetName, int baseX, const Ragged2DType& data);
 
+		/**
+		 * Create and write the data set when the rows we own are not
+		 * contiguous, for instance the rows of a 2D or 3D DMDA block in
+		 * the natural ordering. The ranges of every process are gathered
+		 * to place our items in the flattened data set.
+		 *
+		 * @param comm The MPI communicator used to access the file.
+		 * @param loc The location (e.g., group) that contains our dataset.
+		 * @param dsetName The name of the dataset.
+		 * @param rowRanges The ranges of rows we own, sorted and disjoint.
+		 * @param data The data to be written, one entry per row we own.
+		 */
+		RaggedDataSet2D(MPI_Comm comm, const HDF5Object& loc,
+			std::string dsetName, const std::vector<RowRange>& rowRanges,
+			const Ragged2DType& data);
+
 		/**
 		 * Open an existing data set.
 		 *
@@ -453,6 +510,34 @@ public:
 		 */
 		Ragged2DType
 		read(int baseX, int numX) const;
+
+		/**
+		 * Read the given rows from an existing data set, whatever the
+		 * decomposition used to write it. Only our part of the indexing
+		 * metadata and of the data is read, with one collective request
+		 * for each.
+		 *
+		 * @param rowRanges The ranges of rows to read, sorted and disjoint.
+		 * @return The data associated with the rows, in order.
+		 */
+		Ragged2DType
+		read(const std::vector<RowRange>& rowRanges) const;
+
+		/**
+		 * Read the given rows from an existing data set into a flat
+		 * buffer, with one request for the indexing metadata and one for
+		 * the data.
+		 *
+		 * @param rowRanges The ranges of rows to read, sorted and disjoint.
+		 * @param offsets The position of the first item of each row in the
+		 *              returned buffer, plus one past the last row.
+		 * @param collective Whether all the processes take part in the
+		 *              read.
+		 * @return The items of the rows, in order.
+		 */
+		FlatType
+		readFlat(const std::vector<RowRange>& rowRanges,
+			std::vector<uint32_t>& offsets, bool collective = true) const;
 	};
 
 #if READY
@@ -741,9 +826,11 @@ protected:
 	 * @param _mode Access mode for creating/opening the file.
 	 * @param _comm Communicator to use for accessing the file.
 	 * @param par Whether to access the file using parallel I/O.
+	 * @param reuseSpace Whether a created file tracks its free space
 	 */
 	void
-	Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par);
+	Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par,
+		bool reuseSpace);
 
 public:
 	/**
@@ -752,15 +839,24 @@ public:
 	 * @param _path Path of file to create or open.
 	 * @param _mode Access mode for creating/opening the file.
 	 * @param par Whether to access the file with parallel I/O.
+	 * @param reuseSpace Whether a created file keeps track of the space
+	 *              freed by deleted objects, across closing and reopening
+	 *              it, so that it can be reused for new ones.
 	 */
 	HDF5File(fs::path _path, AccessMode _mode, MPI_Comm _comm = MPI_COMM_WORLD,
-		bool par = true) :
+		bool par = true, bool reuseSpace = false) :
 		HDF5Object("/"),
 		comm(_comm)
 	{
-		Open(_path, _mode, _comm, par);
+		Open(_path, _mode, _comm, par, reuseSpace);
 	}
 
+	/**
+	 * Flush the buffers of the file to disk, collective in parallel.
+	 */
+	void
+	flush(void) const;
+
 	/**
 	 * Close the file if open and destroy the in-memory object.
 	 */
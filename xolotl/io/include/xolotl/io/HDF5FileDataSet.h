@@ -1,6 +1,8 @@
 #ifndef XCORE_HDF5FILE_DATASET_H
 #define XCORE_HDF5FILE_DATASET_H
 
+#include <cassert>
+#include <map>
 #include <numeric>
 
 #include <boost/range/counting_range.hpp>
@@ -25,6 +27,21 @@ HDF5File::DataSetTBase<T>::DataSetTBase(
 	}
 }
 
+template <typename T>
+HDF5File::DataSetTBase<T>::DataSetTBase(const HDF5Object& loc,
+	std::string dsetName, const DataSpace& dspace,
+	const PropertyList& createProps) :
+	DataSetBase(loc, dsetName)
+{
+	setId(H5Dcreate(loc.getId(), dsetName.c_str(), TypeInFile<T>().getId(),
+		dspace.getId(), H5P_DEFAULT, createProps.getId(), H5P_DEFAULT));
+	if (getId() < 0) {
+		std::ostringstream estr;
+		estr << "Failed to create dataset " << getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
 template <typename T>
 HDF5File::DataSetTBase<T>::DataSetTBase(
 	const HDF5Object& loc, std::string dsetName) :
@@ -171,6 +188,120 @@ HDF5File::RaggedDataSet2D<T>::RaggedDataSet2D(MPI_Comm _comm,
 	writeData(globalBaseIdx, myNumItems, data);
 }
 
+template <typename T>
+HDF5File::RaggedDataSet2D<T>::RaggedDataSet2D(MPI_Comm _comm,
+	const HDF5Object& loc, std::string dsetName,
+	const std::vector<RowRange>& rowRanges, const Ragged2DType& data) :
+	RaggedDataSetBase(_comm),
+	DataSetTBase<T>(loc, dsetName, *(buildDataSpace(_comm, data)))
+{
+	auto ranges = mergeRanges(rowRanges);
+
+	// Describe each of our ranges by (first row, number of rows, number
+	// of items)
+	auto myNumItemsByPoint = findNumItemsByPoint(data);
+	std::vector<uint32_t> myRanges;
+	auto point = myNumItemsByPoint.begin();
+	for (auto const& range : ranges) {
+		uint32_t numItems =
+			std::accumulate(point, point + range.second, (uint32_t)0);
+		myRanges.insert(myRanges.end(), {range.first, range.second, numItems});
+		point += range.second;
+	}
+	assert(point == myNumItemsByPoint.end());
+
+	// Gather the ranges of every process
+	int commSize;
+	MPI_Comm_size(comm, &commSize);
+	int mySize = myRanges.size();
+	std::vector<int> sizes(commSize);
+	MPI_Allgather(&mySize, 1, MPI_INT, sizes.data(), 1, MPI_INT, comm);
+	std::vector<int> displs(commSize + 1, 0);
+	std::partial_sum(sizes.begin(), sizes.end(), displs.begin() + 1);
+	std::vector<uint32_t> allRanges(displs.back());
+	MPI_Allgatherv(myRanges.data(), mySize, MPI_UNSIGNED, allRanges.data(),
+		sizes.data(), displs.data(), MPI_UNSIGNED, comm);
+
+	// Ordering them by first row gives the position of the first item of
+	// each range in the flattened data set
+	std::map<uint32_t, std::array<uint32_t, 2>> rangeItems;
+	for (auto i = 0; i < allRanges.size(); i += 3) {
+		rangeItems[allRanges[i]] = {allRanges[i + 1], allRanges[i + 2]};
+	}
+	uint32_t totalNumPoints = 0;
+	uint32_t totalNumItems = 0;
+	std::map<uint32_t, uint32_t> globalBaseIdx;
+	for (auto const& [first, counts] : rangeItems) {
+		globalBaseIdx[first] = totalNumItems;
+		totalNumPoints += counts[0];
+		totalNumItems += counts[1];
+	}
+
+	// Compute the global starting indices of our rows, the range that
+	// ends the data set also writes the total number of items
+	FlatStartingIndicesType myStartingIndices;
+	std::vector<std::array<hsize_t, 2>> indexBlocks, dataBlocks;
+	point = myNumItemsByPoint.begin();
+	for (auto const& range : ranges) {
+		auto baseIdx = globalBaseIdx[range.first];
+		auto idx = baseIdx;
+		for (auto i = 0; i < range.second; ++i, ++point) {
+			myStartingIndices.push_back(idx);
+			idx += *point;
+		}
+		hsize_t numIndices = range.second;
+		if (range.first + range.second == totalNumPoints) {
+			myStartingIndices.push_back(idx);
+			++numIndices;
+		}
+		indexBlocks.push_back({range.first, numIndices});
+		dataBlocks.push_back({baseIdx, idx - baseIdx});
+	}
+
+	// Create the index dataset and write our part using a collective write.
+	std::ostringstream indexDatasetNameStr;
+	indexDatasetNameStr << this->getName() << startIndicesDatasetNameSuffix;
+	SimpleDataSpace<1>::Dimensions globalIndexDims{totalNumPoints + 1};
+	SimpleDataSpace<1> indexDataSpace(globalIndexDims);
+	DataSet<uint32_t> indexDataset(
+		this->getLocation(), indexDatasetNameStr.str(), indexDataSpace);
+	SimpleDataSpace<1> indexFilespace(indexDataset);
+	auto numIndices = selectBlocks(indexFilespace.getId(), indexBlocks);
+	SimpleDataSpace<1>::Dimensions indexCounts{numIndices};
+	SimpleDataSpace<1> indexMemspace(indexCounts);
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE);
+	TypeInMemory<uint32_t> indexMemType;
+	auto status = H5Dwrite(indexDataset.getId(), indexMemType.getId(),
+		indexMemspace.getId(), indexFilespace.getId(), plist.getId(),
+		myStartingIndices.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << indexDataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	// Flatten and write our data using a collective write.
+	FlatType flatData;
+	for (auto const& currItems : data) {
+		std::copy(
+			currItems.begin(), currItems.end(), std::back_inserter(flatData));
+	}
+	SimpleDataSpace<1> dataFileSpace(*this);
+	auto numItems = selectBlocks(dataFileSpace.getId(), dataBlocks);
+	assert(numItems == flatData.size());
+	SimpleDataSpace<1>::Dimensions dataCounts{numItems};
+	SimpleDataSpace<1> dataMemSpace(dataCounts);
+	TypeInMemory<T> memType;
+	status = H5Dwrite(this->getId(), memType.getId(), dataMemSpace.getId(),
+		dataFileSpace.getId(), plist.getId(), flatData.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << this->getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
 template <typename T>
 HDF5File::RaggedDataSet2D<T>::RaggedDataSet2D(
 	MPI_Comm _comm, const HDF5Object& loc, std::string dsetName) :
@@ -476,6 +607,90 @@ HDF5File::RaggedDataSet2D<T>::read(int baseX, int numX) const
 	return ret;
 }
 
+template <typename T>
+typename HDF5File::RaggedDataSet2D<T>::Ragged2DType
+HDF5File::RaggedDataSet2D<T>::read(const std::vector<RowRange>& rowRanges) const
+{
+	std::vector<uint32_t> offsets;
+	auto flatData = readFlat(rowRanges, offsets);
+
+	// Convert from flat representation to ragged 2D representation.
+	Ragged2DType ret;
+	for (auto i = 0; i + 1 < offsets.size(); ++i) {
+		ret.emplace_back(
+			flatData.begin() + offsets[i], flatData.begin() + offsets[i + 1]);
+	}
+
+	return ret;
+}
+
+template <typename T>
+typename HDF5File::RaggedDataSet2D<T>::FlatType
+HDF5File::RaggedDataSet2D<T>::readFlat(const std::vector<RowRange>& rowRanges,
+	std::vector<uint32_t>& offsets, bool collective) const
+{
+	auto ranges = mergeRanges(rowRanges);
+
+	// Read the starting indices of our rows, plus one past the end of each
+	// range to know its number of items.
+	std::ostringstream indexDatasetNameStr;
+	indexDatasetNameStr << this->getName() << startIndicesDatasetNameSuffix;
+	DataSet<uint32_t> indexDataset(
+		this->getLocation(), indexDatasetNameStr.str());
+	std::vector<std::array<hsize_t, 2>> indexBlocks;
+	for (auto const& range : ranges) {
+		indexBlocks.push_back({range.first, (hsize_t)range.second + 1});
+	}
+	SimpleDataSpace<1> indexFilespace(indexDataset);
+	auto numIndices = selectBlocks(indexFilespace.getId(), indexBlocks);
+	SimpleDataSpace<1>::Dimensions indexCounts{numIndices};
+	SimpleDataSpace<1> indexMemspace(indexCounts);
+	std::vector<uint32_t> startingIndices(numIndices);
+	PropertyList plist(H5P_DATASET_XFER);
+	H5Pset_dxpl_mpio(plist.getId(),
+		collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT);
+	TypeInMemory<uint32_t> indexMemType;
+	auto status = H5Dread(indexDataset.getId(), indexMemType.getId(),
+		indexMemspace.getId(), indexFilespace.getId(), plist.getId(),
+		startingIndices.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << indexDataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	// Read the items of all our ranges at once.
+	std::vector<std::array<hsize_t, 2>> dataBlocks;
+	offsets.assign(1, 0);
+	auto pos = 0;
+	for (auto const& range : ranges) {
+		auto first = startingIndices[pos];
+		auto last = startingIndices[pos + range.second];
+		dataBlocks.push_back({first, (hsize_t)(last - first)});
+		for (auto i = 0; i < range.second; ++i) {
+			offsets.push_back(offsets.back() + startingIndices[pos + i + 1] -
+				startingIndices[pos + i]);
+		}
+		pos += range.second + 1;
+	}
+	SimpleDataSpace<1> dataFilespace(*this);
+	auto numItems = selectBlocks(dataFilespace.getId(), dataBlocks);
+	assert(numItems == offsets.back());
+	SimpleDataSpace<1>::Dimensions dataCounts{numItems};
+	SimpleDataSpace<1> dataMemspace(dataCounts);
+	FlatType flatData(numItems);
+	TypeInMemory<T> dataMemType;
+	status = H5Dread(this->getId(), dataMemType.getId(), dataMemspace.getId(),
+		dataFilespace.getId(), plist.getId(), flatData.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << this->getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	return flatData;
+}
+
 template <typename T>
 std::vector<uint32_t>
 HDF5File::RaggedDataSet2D<T>::readStartingIndices(int baseX, int numX) const
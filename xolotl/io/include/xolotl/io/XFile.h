@@ -1,6 +1,7 @@
 #ifndef XCORE_XFILE_H
 #define XCORE_XFILE_H
 
+#include <array>
 #include <set>
 #include <string>
 #include <tuple>
@@ -30,6 +31,8 @@ public:
 	class ConcentrationGroup;
 	class TimestepGroup : public HDF5File::Group
 	{
+		friend class ConcentrationGroup;
+
 	private:
 		// Prefix to use when constructing group names.
 		static const std::string groupNamePrefix;
@@ -60,6 +63,13 @@ public:
 		// Name of the concentrations data set.
 		static const std::string concDatasetName;
 
+		// Name of the dense concentration dataset.
+		static const std::string denseConcDatasetName;
+
+		// Name of the attribute protecting the group from the retention
+		// policy.
+		static const std::string keepAttrName;
+
 		// Names of grid-specification attributes.
 		static const std::string nxAttrName;
 		static const std::string hxAttrName;
@@ -86,6 +96,13 @@ public:
 		using ConcType = std::pair<int, double>;
 		using Concs1DType = HDF5File::RaggedDataSet2D<ConcType>::Ragged2DType;
 
+		// Concise name for a number of grid points or a grid point index
+		// in each direction, in the (x, y, z) order.
+		using GridBox = std::array<int, 3>;
+
+		// Concise name for a range of rows of the ragged dataset.
+		using RowRange = HDF5File::RaggedDataSetBase::RowRange;
+
 		/**
 		 * Construct the group name for the given time step.
 		 *
@@ -289,7 +306,7 @@ public:
 		/**
 		 * Read concentration dataset for our grid points in a 1D problem.
 		 * Assumes that grid point slabs are assigned to processes in
-		 * MPI rank order.
+		 * MPI rank order. Works with both the ragged and the dense layouts.
 		 *
 		 * @param file The HDF5 file that owns our group.  Needed to support
 		 *              parallel file access.
@@ -302,6 +319,107 @@ public:
 		Concs1DType
 		readConcentrations(const XFile& file, int baseX, int numX) const;
 
+		/**
+		 * Compute the rows of the ragged dataset owned by a block of the
+		 * grid. The rows follow the natural ordering (x is the fastest
+		 * index) so a block owns one range per (y, z) line.
+		 *
+		 * @param globalSize The number of grid points in each direction
+		 * @param start The first grid point of the block
+		 * @param count The number of grid points of the block
+		 * @return The ranges of rows, in the order of the block points
+		 */
+		static std::vector<RowRange>
+		makeRowRanges(const GridBox& globalSize, const GridBox& start,
+			const GridBox& count);
+
+		/**
+		 * Add a ragged concentration dataset for a 2D or 3D grid, any
+		 * decomposition of the grid can be used.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param globalSize The number of grid points in each direction
+		 * @param start The first grid point we own
+		 * @param count The number of grid points we own in each direction
+		 * @param concs Concentrations associated with grid points we own,
+		 *              x being the fastest index
+		 */
+		void
+		writeConcentrations(const XFile& file, const GridBox& globalSize,
+			const GridBox& start, const GridBox& count,
+			const Concs1DType& concs) const;
+
+		/**
+		 * Read the concentrations of a block of the grid. Only the rows of
+		 * the block are read, whatever the decomposition used to write the
+		 * file, so a restart can use a different number of processes.
+		 * Works with both the ragged and the dense layouts.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param globalSize The number of grid points in each direction
+		 * @param start The first grid point we own
+		 * @param count The number of grid points we own in each direction
+		 * @return Concentrations associated with grid points we own, x
+		 *              being the fastest index
+		 */
+		Concs1DType
+		readConcentrations(const XFile& file, const GridBox& globalSize,
+			const GridBox& start, const GridBox& count) const;
+
+		/**
+		 * Whether the concentrations of this time step are stored in the
+		 * ragged layout.
+		 *
+		 * @return True if the ragged dataset exists
+		 */
+		bool
+		hasRaggedConcentrations(void) const;
+
+		/**
+		 * Add a dense concentration dataset for all grid points.
+		 * The dataset stores nValues values for every grid point, it is
+		 * chunked along x and can be compressed with the shuffle and
+		 * deflate filters. Each process writes its block of the grid with
+		 * a collective hyperslab write.
+		 *
+		 * @param globalSize The number of grid points in each direction
+		 * @param start The first grid point we own
+		 * @param count The number of grid points we own in each direction
+		 * @param nValues The number of values at each grid point
+		 * @param data The values for the grid points we own, ordered like
+		 *              the DMDA array (values, then x, y, and z)
+		 * @param deflateLevel The compression level, 0 for no compression
+		 */
+		void
+		writeDenseConcentrations(const GridBox& globalSize,
+			const GridBox& start, const GridBox& count, int nValues,
+			const double* data, int deflateLevel = 0) const;
+
+		/**
+		 * Whether the concentrations of this time step are stored in the
+		 * dense layout.
+		 *
+		 * @return True if the dense dataset exists
+		 */
+		bool
+		hasDenseConcentrations(void) const;
+
+		/**
+		 * Read a block of the dense concentration dataset with a hyperslab
+		 * read.
+		 *
+		 * @param start The first grid point to read
+		 * @param count The number of grid points to read in each direction
+		 * @param nValues The number of values at each grid point
+		 * @param collective Whether all the processes read together
+		 * @return The values, in the same order as for the write
+		 */
+		std::vector<double>
+		readDenseConcentrations(const GridBox& start, const GridBox& count,
+			int& nValues, bool collective = true) const;
+
 		/**
 		 * Read the times from our timestep group.
 		 *
@@ -333,6 +451,31 @@ public:
 		readSizes(int& nx, double& hx, int& ny, double& hy, int& nz,
 			double& hz) const;
 
+		/**
+		 * Protect this time step from the retention policy of the
+		 * concentration group.
+		 */
+		void
+		setKept(void) const;
+
+		/**
+		 * Whether this time step is protected from the retention policy.
+		 *
+		 * @return True if it must never be removed
+		 */
+		bool
+		isKept(void) const;
+
+		/**
+		 * Read the number of grid points in each direction, at least one
+		 * in each of them. Older files do not record ny and nz for 2D and
+		 * 3D grids, they are then deduced from the concentration datasets.
+		 *
+		 * @return The number of grid points in the (x, y, z) order
+		 */
+		GridBox
+		readGlobalSize() const;
+
 		/**
 		 * Read the grid.
 		 *
@@ -405,10 +548,50 @@ public:
 		 * @param k The index of the grid point on the z axis
 		 * @return The vector of concentrations
 		 */
-		// TODO remove once have added support for 0D, 2D, and 3D
-		// parallel reads of concentrations.
+		// Works with both the per grid point and the dense layouts, use
+		// readGridPoints to read many grid points.
 		Data3DType
 		readGridPoint(int i, int j = -1, int k = -1) const;
+
+		/**
+		 * Read the concentrations of a set of grid points into a flat
+		 * buffer. The ragged and dense layouts are read with a single
+		 * request for all the points, the consecutive points in the
+		 * natural ordering being merged in blocks. Files with one dataset
+		 * per grid point are read point by point.
+		 *
+		 * @param file The HDF5 file that owns our group.  Needed to support
+		 *              parallel file access.
+		 * @param globalSize The number of grid points in each direction
+		 * @param dim The dimension of the grid, it names the datasets of
+		 *              the files with one dataset per grid point
+		 * @param points The grid points to read, in any order
+		 * @param offsets The position of the first concentration of each
+		 *              point in the returned buffer, plus one past the last
+		 *              point
+		 * @param collective Whether all the processes take part in the
+		 *              read
+		 * @return The concentrations of the points, point after point
+		 */
+		std::vector<ConcType>
+		readGridPoints(const XFile& file, const GridBox& globalSize, int dim,
+			const std::vector<GridBox>& points, std::vector<uint32_t>& offsets,
+			bool collective = true) const;
+
+	private:
+		/**
+		 * Read the dataset of the (i,j,k)-th grid point, in the layout
+		 * with one dataset per grid point.
+		 *
+		 * @param i The index of the grid point on the x axis
+		 * @param j The index of the grid point on the y axis, -1 in 1D
+		 * @param k The index of the grid point on the z axis, -1 in 1D
+		 *              and 2D
+		 * @return The vector of concentrations, empty if there is no
+		 *              dataset for this grid point
+		 */
+		Data3DType
+		readPositionDataset(int i, int j, int k) const;
 	};
 
 	// Our concentrations group.
@@ -488,6 +671,50 @@ public:
 		std::unique_ptr<TimestepGroup>
 		getTimestepGroup(int loop, int timeStep) const;
 
+		/**
+		 * Access the TimestepGroup associated with the given control step,
+		 * loop, and time step.
+		 *
+		 * @param ctrlStep The control step
+		 * @param loop The loop number
+		 * @param timeStep Time step of the desired TimestepGroup.
+		 * @return TimestepGroup associated with the given time step.  Empty
+		 *          pointer if the given time step is not known to us.
+		 */
+		std::unique_ptr<TimestepGroup>
+		getTimestepGroup(int ctrlStep, int loop, int timeStep) const;
+
+		/**
+		 * List the time steps written to our group.
+		 *
+		 * @return The (control step, loop, time step) of each TimestepGroup,
+		 *          in increasing order
+		 */
+		std::vector<std::array<int, 3>>
+		getTimesteps(void) const;
+
+		/**
+		 * Delete a TimestepGroup. The space it used can then be reused
+		 * by the next ones.
+		 *
+		 * @param ctrlStep The control step
+		 * @param loop The loop number
+		 * @param timeStep Time step of the TimestepGroup to delete.
+		 */
+		void
+		removeTimestepGroup(int ctrlStep, int loop, int timeStep) const;
+
+		/**
+		 * Apply the retention policy: only the last keepLast time steps
+		 * are kept, together with the ones marked with
+		 * TimestepGroup::setKept.
+		 *
+		 * @param keepLast The number of recent time steps to keep
+		 * @return The number of removed time steps
+		 */
+		int
+		pruneTimesteps(int keepLast) const;
+
 		/**
 		 * Access the TimestepGroup associated with the last known time step.
 		 *
@@ -507,11 +734,21 @@ public:
 		using NetworkBoundsType = std::vector<
 			std::vector<core::network::IReactionNetwork::AmountType>>;
 
+		// Concise name for type of moment ids.
+		using MomentIdsType = core::network::IReactionNetwork::MomentIdMap;
+
 	private:
 		// Names of network attribute.
 		static const std::string sizeAttrName;
 		static const std::string phaseSpaceAttrName;
 
+		// Names of the cluster tables, one row per cluster.
+		static const std::string boundsDatasetName;
+		static const std::string formationEnergyDatasetName;
+		static const std::string migrationEnergyDatasetName;
+		static const std::string diffusionFactorDatasetName;
+		static const std::string momentIdsDatasetName;
+
 	public:
 		// Path to the network group within our HDF5 file.
 		static const fs::path path;
@@ -543,6 +780,57 @@ public:
 		int
 		readNetworkSize() const;
 
+		/**
+		 * Whether the clusters are stored as tables rather than one group
+		 * per cluster.
+		 *
+		 * @return True if the cluster tables exist
+		 */
+		bool
+		isTabular() const;
+
+		/**
+		 * Read the bounds of every cluster.
+		 *
+		 * @return The bounds, one vector per cluster
+		 */
+		NetworkBoundsType
+		readClusterBounds() const;
+
+		/**
+		 * Read the properties of every cluster.
+		 *
+		 * @param formationEnergies The formation energies.
+		 * @param migrationEnergies The migration energies.
+		 * @param diffusionFactors The diffusion factors.
+		 */
+		void
+		readClusterProperties(std::vector<double>& formationEnergies,
+			std::vector<double>& migrationEnergies,
+			std::vector<double>& diffusionFactors) const;
+
+		/**
+		 * Read the moment ids of every cluster. They are only written in
+		 * the tabular layout, the result is empty otherwise.
+		 *
+		 * @return The moment ids, one vector per cluster
+		 */
+		MomentIdsType
+		readMomentIds() const;
+
+		/**
+		 * Read the row of a cluster in the tables.
+		 *
+		 * @param id The id of the cluster.
+		 * @param formationEnergy The formation energy.
+		 * @param migrationEnergy The migration energy.
+		 * @param diffusionFactor The diffusion factor.
+		 * @return The cluster bounds.
+		 */
+		NetworkBoundsType::value_type
+		readClusterRow(int id, double& formationEnergy,
+			double& migrationEnergy, double& diffusionFactor) const;
+
 		/**
 		 * Read the reactions for every cluster.
 		 *
@@ -577,12 +865,19 @@ public:
 		static const std::string diffusionFactorAttrName;
 		static const std::string boundsAttrName;
 
+		// The network group, its tables are used in the tabular layout.
+		const NetworkGroup& networkGroup;
+
+		// The id of the cluster.
+		int id;
+
 	public:
 		ClusterGroup(void) = delete;
 		ClusterGroup(const ClusterGroup& other) = delete;
 
 		/**
-		 * Open a cluster group.
+		 * Open a cluster group. In the tabular layout there is no group
+		 * per cluster and the cluster is read from the network tables.
 		 *
 		 * @param networkGroup The group in which the cluster is located.
 		 * @param id The id of the cluster.
@@ -590,7 +885,7 @@ public:
 		ClusterGroup(const NetworkGroup& networkGroup, int id);
 
 		/**
-		 * Create a cluster group.
+		 * Create a cluster group (old layout).
 		 *
 		 * @param networkGroup The group in which to write.
 		 * @param id The Cluster id
@@ -625,6 +920,130 @@ public:
 			double& diffusionFactor) const;
 	};
 
+	// The coupling state of MultiXolotl and the concentrations of each of
+	// its sub-instances, so that they are checkpointed in a single file.
+	class MultiGroup : public HDF5File::Group
+	{
+	public:
+		// Concise name for the blocks of each sub-instance.
+		using Partition = std::vector<std::vector<int>>;
+
+		// Concise name for a number of grid points or a grid point index
+		// in each direction, in the (x, y, z) order.
+		using GridBox = TimestepGroup::GridBox;
+
+	private:
+		// Names of the time stepper attributes.
+		static const std::string stepAttrName;
+		static const std::string timeAttrName;
+		static const std::string deltaTimeAttrName;
+
+		// Names of the partition attributes, the blocks of all the
+		// sub-instances one after the other and the number of blocks of
+		// each of them.
+		static const std::string partitionAttrName;
+		static const std::string partitionSizesAttrName;
+
+		// Name of the attribute with the number of size ranges each block
+		// was split in.
+		static const std::string subRangesAttrName;
+
+		// Names of the attributes of each sub-instance.
+		static const std::string subDOFsAttrName;
+		static const std::string subDeltaTimesAttrName;
+
+		// Prefix to use when constructing sub-instance group names.
+		static const std::string instanceNamePrefix;
+
+		// Name of the dense concentration dataset of a sub-instance.
+		static const std::string concDatasetName;
+
+	public:
+		// Path of the MultiXolotl group within the file.
+		static const fs::path path;
+
+		MultiGroup(void) = delete;
+		MultiGroup(const MultiGroup& other) = delete;
+
+		/**
+		 * Create or open the MultiXolotl group.
+		 *
+		 * @param file The file
+		 * @param create Whether to create the group
+		 */
+		MultiGroup(const XFile& file, bool create = false);
+
+		/**
+		 * Write the state of the time stepper.
+		 *
+		 * @param step The last step solved
+		 * @param time The time reached at that step
+		 * @param deltaTime The size of the next step
+		 */
+		void
+		writeTimes(std::size_t step, double time, double deltaTime) const;
+
+		/**
+		 * Read the state of the time stepper.
+		 *
+		 * @return The last step solved, its time, and the next step size
+		 */
+		std::tuple<std::size_t, double, double>
+		readTimes(void) const;
+
+		/**
+		 * Write the partition and the description of the sub-instances.
+		 *
+		 * @param partition The blocks of each sub-instance
+		 * @param nSubRanges The number of size ranges each block was split
+		 * in, the block ids depend on it
+		 * @param subDOFs The number of clusters of each sub-instance
+		 * @param subDeltaTimes The time step of the solver of each
+		 * sub-instance
+		 */
+		void
+		writeInstances(const Partition& partition, int nSubRanges,
+			const std::vector<int>& subDOFs,
+			const std::vector<double>& subDeltaTimes) const;
+
+		/**
+		 * Read the partition and the description of the sub-instances.
+		 *
+		 * @param nSubRanges The number of size ranges each block was split
+		 * in
+		 * @param subDOFs The number of clusters of each sub-instance
+		 * @param subDeltaTimes The time step of the solver of each
+		 * sub-instance
+		 * @return The blocks of each sub-instance
+		 */
+		Partition
+		readInstances(int& nSubRanges, std::vector<int>& subDOFs,
+			std::vector<double>& subDeltaTimes) const;
+
+		/**
+		 * Write the concentrations of a sub-instance in the dense layout,
+		 * in its own group. All the processes of the file take part, the
+		 * ones not solving this sub-instance own an empty block.
+		 *
+		 * @param id The sub-instance
+		 * @see TimestepGroup::writeDenseConcentrations for the others
+		 */
+		void
+		writeConcentrations(int id, const GridBox& globalSize,
+			const GridBox& start, const GridBox& count, int nValues,
+			const double* data) const;
+
+		/**
+		 * Read a block of the concentrations of a sub-instance.
+		 *
+		 * @param id The sub-instance
+		 * @see TimestepGroup::readDenseConcentrations for the others
+		 */
+		std::vector<double>
+		readConcentrations(int id, const GridBox& start, const GridBox& count,
+			int& nValues) const;
+	};
+
 private:
 	/**
 	 * Pass through only Create* access modes.
@@ -646,6 +1065,33 @@ private:
 	static AccessMode
 	EnsureOpenAccessMode(AccessMode mode);
 
+	// Concise name for a box of grid points.
+	using GridBox = TimestepGroup::GridBox;
+
+	/**
+	 * Create a dense dataset and write our block of it.
+	 *
+	 * @param group The group in which to write
+	 * @param name The name of the dataset
+	 * @see TimestepGroup::writeDenseConcentrations for the others
+	 */
+	static void
+	writeDenseDataset(const Group& group, const std::string& name,
+		const GridBox& globalSize, const GridBox& start, const GridBox& count,
+		int nValues, const double* data, int deflateLevel);
+
+	/**
+	 * Read a block of a dense dataset.
+	 *
+	 * @param group The group from which to read
+	 * @param name The name of the dataset
+	 * @see TimestepGroup::readDenseConcentrations for the others
+	 */
+	static std::vector<double>
+	readDenseDataset(const Group& group, const std::string& name,
+		const GridBox& start, const GridBox& count, int& nValues,
+		bool collective);
+
 public:
 	/**
 	 * Create and initialize a checkpoint file.
@@ -655,9 +1101,12 @@ public:
 	 * @param _comm The MPI communicator used to access the file.
 	 * @param mode Access mode for file.  Only HDF5File Create* modes
 	 *              are supported.
+	 * @param reuseSpace Whether the space of the deleted time steps is
+	 *              reused for the new ones.
 	 */
 	XFile(fs::path path, int create, MPI_Comm _comm = MPI_COMM_WORLD,
-		AccessMode mode = AccessMode::CreateOrTruncateIfExists);
+		AccessMode mode = AccessMode::CreateOrTruncateIfExists,
+		bool reuseSpace = false);
 
 	/**
 	 * Open an existing checkpoint or network file.
@@ -78,7 +78,8 @@ HDF5File::BuildHDF5ErrorString(void)
 }
 
 void
-HDF5File::Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par)
+HDF5File::Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par,
+	bool reuseSpace)
 {
 	// Obtain the HDF5 flag that corresponds to requested access mode.
 	auto hdf5Mode = toHDF5AccessMode(_mode);
@@ -102,8 +103,20 @@ HDF5File::Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par)
 	}
 	else {
 		// We are creating/truncating a file.
+		PropertyList createPlist(H5P_FILE_CREATE);
+		auto createPlistId = H5P_DEFAULT;
+		if (reuseSpace) {
+			// Persist the free-space managers so that the space of the
+			// deleted objects is reused even after reopening the file
+			createPlistId = createPlist.getId();
+			auto status = H5Pset_file_space_strategy(
+				createPlistId, H5F_FSPACE_STRATEGY_FSM_AGGR, 1, 1);
+			if (status < 0) {
+				throw HDF5Exception(BuildHDF5ErrorString());
+			}
+		}
 		setId(H5Fcreate(_path.string().c_str(), hdf5Mode,
-			H5P_DEFAULT, // create plist
+			createPlistId, // create plist
 			plistId)); // access mode plist
 	}
 
@@ -112,6 +125,14 @@ HDF5File::Open(fs::path _path, AccessMode _mode, MPI_Comm _comm, bool par)
 	}
 }
 
+void
+HDF5File::flush(void) const
+{
+	if (H5Fflush(getId(), H5F_SCOPE_GLOBAL) < 0) {
+		throw HDF5Exception(BuildHDF5ErrorString());
+	}
+}
+
 bool
 HDF5File::hasGroup(fs::path path) const
 {
@@ -1,3 +1,6 @@
+#include <cassert>
+
+#include <xolotl/io/HDF5Exception.h>
 #include <xolotl/io/HDF5File.h>
 
 namespace xolotl
@@ -7,5 +10,49 @@ namespace io
 const std::string HDF5File::RaggedDataSetBase::startIndicesDatasetNameSuffix =
 	"_startingIndices";
 
+std::vector<HDF5File::RaggedDataSetBase::RowRange>
+HDF5File::RaggedDataSetBase::mergeRanges(const std::vector<RowRange>& ranges)
+{
+	std::vector<RowRange> merged;
+	for (auto const& range : ranges) {
+		if (range.second == 0) {
+			continue;
+		}
+		if (not merged.empty() and
+			merged.back().first + merged.back().second == range.first) {
+			merged.back().second += range.second;
+			continue;
+		}
+		assert(merged.empty() or
+			merged.back().first + merged.back().second < range.first);
+		merged.push_back(range);
+	}
+	return merged;
+}
+
+uint32_t
+HDF5File::RaggedDataSetBase::selectBlocks(
+	hid_t spaceId, const std::vector<std::array<hsize_t, 2>>& blocks)
+{
+	uint32_t total = 0;
+	auto op = H5S_SELECT_SET;
+	for (auto const& block : blocks) {
+		if (block[1] == 0) {
+			continue;
+		}
+		auto status = H5Sselect_hyperslab(
+			spaceId, op, &block[0], nullptr, &block[1], nullptr);
+		if (status < 0) {
+			throw HDF5Exception("Failed to select the ragged dataset blocks");
+		}
+		op = H5S_SELECT_OR;
+		total += block[1];
+	}
+	if (total == 0) {
+		H5Sselect_none(spaceId);
+	}
+	return total;
+}
+
 } // namespace io
 } // namespace xolotl
@@ -1,6 +1,8 @@
 #include <hdf5.h>
 
+#include <algorithm>
 #include <array>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -18,6 +20,180 @@ namespace io
 		throw std::runtime_error("I/O error"); \
 	}
 
+namespace
+{
+/**
+ * Write a table of 32 bit integers with one row per cluster.
+ *
+ * @param locId The group in which to write
+ * @param name The name of the dataset
+ * @param values The values, row after row
+ * @param nCols The number of columns
+ */
+template <typename T>
+void
+writeTable(hid_t locId, const std::string& name, const std::vector<T>& values,
+	hsize_t nCols)
+{
+	static_assert(sizeof(T) == 4);
+	std::array<hsize_t, 2> dims{values.size() / nCols, nCols};
+	hid_t dataspaceId = H5Screate_simple(2, dims.data(), nullptr);
+	CHK(dataspaceId);
+	hid_t datasetId = H5Dcreate2(locId, name.c_str(), H5T_STD_I32LE,
+		dataspaceId, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+	CHK(datasetId);
+	CHK(H5Dwrite(datasetId, H5T_STD_I32LE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+		values.data()));
+	CHK(H5Dclose(datasetId));
+	CHK(H5Sclose(dataspaceId));
+}
+
+/**
+ * Read rows of a table of 32 bit integers.
+ *
+ * @param locId The group from which to read
+ * @param name The name of the dataset
+ * @param nCols The number of columns
+ * @param first The first row to read
+ * @param nRows The number of rows to read, all the rows if negative
+ * @return The values, row after row
+ */
+template <typename T>
+std::vector<T>
+readTable(hid_t locId, const std::string& name, hsize_t& nCols,
+	hsize_t first = 0, int nRows = -1)
+{
+	static_assert(sizeof(T) == 4);
+	hid_t datasetId = H5Dopen(locId, name.c_str(), H5P_DEFAULT);
+	CHK(datasetId);
+	hid_t fileSpaceId = H5Dget_space(datasetId);
+	std::array<hsize_t, 2> dims;
+	CHK(H5Sget_simple_extent_dims(fileSpaceId, dims.data(), nullptr));
+	nCols = dims[1];
+
+	// Select the rows
+	std::array<hsize_t, 2> offsets{first, 0};
+	std::array<hsize_t, 2> counts{
+		nRows < 0 ? dims[0] - first : (hsize_t)nRows, nCols};
+	CHK(H5Sselect_hyperslab(fileSpaceId, H5S_SELECT_SET, offsets.data(),
+		nullptr, counts.data(), nullptr));
+	hid_t memSpaceId = H5Screate_simple(2, counts.data(), nullptr);
+	std::vector<T> values(counts[0] * counts[1]);
+	CHK(H5Dread(datasetId, H5T_STD_I32LE, memSpaceId, fileSpaceId,
+		H5P_DEFAULT, values.data()));
+
+	CHK(H5Sclose(memSpaceId));
+	CHK(H5Sclose(fileSpaceId));
+	CHK(H5Dclose(datasetId));
+	return values;
+}
+
+/**
+ * Read one value or all the values of a column of doubles.
+ *
+ * @param locId The group from which to read
+ * @param name The name of the dataset
+ * @param id The row to read, all the rows if negative
+ * @return The values
+ */
+std::vector<double>
+readColumn(hid_t locId, const std::string& name, int id = -1)
+{
+	hid_t datasetId = H5Dopen(locId, name.c_str(), H5P_DEFAULT);
+	CHK(datasetId);
+	hid_t fileSpaceId = H5Dget_space(datasetId);
+	hsize_t size;
+	CHK(H5Sget_simple_extent_dims(fileSpaceId, &size, nullptr));
+
+	hsize_t offset = id < 0 ? 0 : id;
+	hsize_t count = id < 0 ? size : 1;
+	CHK(H5Sselect_hyperslab(
+		fileSpaceId, H5S_SELECT_SET, &offset, nullptr, &count, nullptr));
+	hid_t memSpaceId = H5Screate_simple(1, &count, nullptr);
+	std::vector<double> values(count);
+	CHK(H5Dread(datasetId, H5T_NATIVE_DOUBLE, memSpaceId, fileSpaceId,
+		H5P_DEFAULT, values.data()));
+
+	CHK(H5Sclose(memSpaceId));
+	CHK(H5Sclose(fileSpaceId));
+	CHK(H5Dclose(datasetId));
+	return values;
+}
+
+/**
+ * Write a vector as an attribute.
+ *
+ * @param locId The group in which to write
+ * @param name The name of the attribute
+ * @param values The values
+ */
+template <typename T>
+void
+writeVectorAttribute(
+	hid_t locId, const std::string& name, const std::vector<T>& values)
+{
+	hsize_t size = values.size();
+	hid_t dataspaceId = H5Screate_simple(1, &size, nullptr);
+	CHK(dataspaceId);
+	HDF5File::TypeInFile<T> fileType;
+	hid_t attrId = H5Acreate2(locId, name.c_str(), fileType.getId(),
+		dataspaceId, H5P_DEFAULT, H5P_DEFAULT);
+	CHK(attrId);
+	HDF5File::TypeInMemory<T> memType;
+	CHK(H5Awrite(attrId, memType.getId(), values.data()));
+	CHK(H5Aclose(attrId));
+	CHK(H5Sclose(dataspaceId));
+}
+
+/**
+ * Read a vector written as an attribute.
+ *
+ * @param locId The group from which to read
+ * @param name The name of the attribute
+ * @return The values
+ */
+template <typename T>
+std::vector<T>
+readVectorAttribute(hid_t locId, const std::string& name)
+{
+	hid_t attrId = H5Aopen(locId, name.c_str(), H5P_DEFAULT);
+	CHK(attrId);
+	hid_t dataspaceId = H5Aget_space(attrId);
+	CHK(dataspaceId);
+	hsize_t size;
+	CHK(H5Sget_simple_extent_dims(dataspaceId, &size, nullptr));
+	std::vector<T> values(size);
+	HDF5File::TypeInMemory<T> memType;
+	CHK(H5Aread(attrId, memType.getId(), values.data()));
+	CHK(H5Sclose(dataspaceId));
+	CHK(H5Aclose(attrId));
+	return values;
+}
+
+/**
+ * Convert values read from the dense layout to the ragged representation,
+ * only the non-zero values are kept.
+ *
+ * @param values The values, nValues per grid point
+ * @param nValues The number of values at each grid point
+ * @return The ragged concentrations
+ */
+XFile::TimestepGroup::Concs1DType
+denseToRagged(const std::vector<double>& values, int nValues)
+{
+	XFile::TimestepGroup::Concs1DType concs(values.size() / nValues);
+	for (auto i = 0; i < concs.size(); ++i) {
+		for (auto l = 0; l < nValues; ++l) {
+			auto value = values[i * nValues + l];
+			if (value != 0.0) {
+				concs[i].emplace_back(l, value);
+			}
+		}
+	}
+	return concs;
+}
+} // namespace
+
 HDF5File::AccessMode
 XFile::EnsureCreateAccessMode(HDF5File::AccessMode mode)
 {
@@ -45,8 +221,9 @@ XFile::EnsureOpenAccessMode(HDF5File::AccessMode mode)
 	return mode;
 }
 
-XFile::XFile(fs::path _path, int create, MPI_Comm _comm, AccessMode _mode) :
-	HDF5File(_path, EnsureCreateAccessMode(_mode), _comm, true)
+XFile::XFile(fs::path _path, int create, MPI_Comm _comm, AccessMode _mode,
+	bool reuseSpace) :
+	HDF5File(_path, EnsureCreateAccessMode(_mode), _comm, true, reuseSpace)
 {
 	// Create and initialize the group where the concentrations will be stored
 	ConcentrationGroup concGroup(*this, true);
@@ -58,12 +235,121 @@ XFile::XFile(fs::path _path, MPI_Comm _comm, AccessMode _mode) :
 	// Nothing else to do.
 }
 
+void
+XFile::writeDenseDataset(const Group& group, const std::string& name,
+	const GridBox& globalSize, const GridBox& start, const GridBox& count,
+	int nValues, const double* data, int deflateLevel)
+{
+	// The dataset is ordered (z, y, x, value) like the DMDA array
+	SimpleDataSpace<4>::Dimensions globalDims{(hsize_t)globalSize[2],
+		(hsize_t)globalSize[1], (hsize_t)globalSize[0], (hsize_t)nValues};
+	SimpleDataSpace<4> globalSpace(globalDims);
+
+	// Chunks of about 1 MB along x, the values of a grid point are never
+	// split between chunks
+	constexpr hsize_t chunkBytes = 1 << 20;
+	hsize_t chunkX =
+		std::max<hsize_t>(1, chunkBytes / (nValues * sizeof(double)));
+	chunkX = std::max<hsize_t>(1, std::min(chunkX, globalDims[2]));
+	SimpleDataSpace<4>::Dimensions chunkDims{1, 1, chunkX, globalDims[3]};
+	PropertyList createProps(H5P_DATASET_CREATE);
+	CHK(H5Pset_chunk(createProps.getId(), 4, chunkDims.data()));
+	CHK(H5Pset_fill_time(createProps.getId(), H5D_FILL_TIME_NEVER));
+	if (deflateLevel > 0) {
+		if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) <= 0) {
+			throw HDF5Exception("The deflate filter is not available");
+		}
+		// Shuffling the bytes first compresses doubles much better
+		CHK(H5Pset_shuffle(createProps.getId()));
+		CHK(H5Pset_deflate(createProps.getId(), std::min(deflateLevel, 9)));
+	}
+	DataSet<double> dataset(group, name, globalSpace, createProps);
+
+	// Select our block within the file
+	SimpleDataSpace<4>::Dimensions offsets{(hsize_t)start[2],
+		(hsize_t)start[1], (hsize_t)start[0], 0};
+	SimpleDataSpace<4>::Dimensions counts{(hsize_t)count[2],
+		(hsize_t)count[1], (hsize_t)count[0], globalDims[3]};
+	SimpleDataSpace<4> memSpace(counts);
+	SimpleDataSpace<4> fileSpace(dataset);
+	bool isEmpty = (count[0] * count[1] * count[2] == 0);
+	if (isEmpty) {
+		CHK(H5Sselect_none(memSpace.getId()));
+		CHK(H5Sselect_none(fileSpace.getId()));
+	}
+	else {
+		CHK(H5Sselect_hyperslab(fileSpace.getId(), H5S_SELECT_SET,
+			offsets.data(), nullptr, counts.data(), nullptr));
+	}
+
+	// Write using a collective write, it is required by the filters
+	PropertyList plist(H5P_DATASET_XFER);
+	CHK(H5Pset_dxpl_mpio(plist.getId(), H5FD_MPIO_COLLECTIVE));
+	TypeInMemory<double> memType;
+	auto status = H5Dwrite(dataset.getId(), memType.getId(), memSpace.getId(),
+		fileSpace.getId(), plist.getId(), data);
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to write dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+}
+
+std::vector<double>
+XFile::readDenseDataset(const Group& group, const std::string& name,
+	const GridBox& start, const GridBox& count, int& nValues,
+	bool collective)
+{
+	DataSet<double> dataset(group, name);
+	SimpleDataSpace<4> fileSpace(dataset);
+	nValues = fileSpace.getDims()[3];
+
+	// Select the block within the file
+	SimpleDataSpace<4>::Dimensions offsets{(hsize_t)start[2],
+		(hsize_t)start[1], (hsize_t)start[0], 0};
+	SimpleDataSpace<4>::Dimensions counts{(hsize_t)count[2],
+		(hsize_t)count[1], (hsize_t)count[0], (hsize_t)nValues};
+	SimpleDataSpace<4> memSpace(counts);
+	std::vector<double> ret(
+		(std::size_t)count[0] * count[1] * count[2] * nValues);
+	if (ret.empty()) {
+		CHK(H5Sselect_none(memSpace.getId()));
+		CHK(H5Sselect_none(fileSpace.getId()));
+	}
+	else {
+		CHK(H5Sselect_hyperslab(fileSpace.getId(), H5S_SELECT_SET,
+			offsets.data(), nullptr, counts.data(), nullptr));
+	}
+
+	PropertyList plist(H5P_DATASET_XFER);
+	CHK(H5Pset_dxpl_mpio(plist.getId(),
+		collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT));
+	TypeInMemory<double> memType;
+	auto status = H5Dread(dataset.getId(), memType.getId(), memSpace.getId(),
+		fileSpace.getId(), plist.getId(), ret.data());
+	if (status < 0) {
+		std::ostringstream estr;
+		estr << "Failed to read dataset " << dataset.getName();
+		throw HDF5Exception(estr.str());
+	}
+
+	return ret;
+}
+
 //----------------------------------------------------------------------------
 // NetworkGroup
 //
 const fs::path XFile::NetworkGroup::path = "/networkGroup";
 const std::string XFile::NetworkGroup::sizeAttrName = "totalSize";
 const std::string XFile::NetworkGroup::phaseSpaceAttrName = "phaseSpace";
+const std::string XFile::NetworkGroup::boundsDatasetName = "clusterBounds";
+const std::string XFile::NetworkGroup::formationEnergyDatasetName =
+	"formationEnergy";
+const std::string XFile::NetworkGroup::migrationEnergyDatasetName =
+	"migrationEnergy";
+const std::string XFile::NetworkGroup::diffusionFactorDatasetName =
+	"diffusionFactor";
+const std::string XFile::NetworkGroup::momentIdsDatasetName = "momentIds";
 
 XFile::NetworkGroup::NetworkGroup(const XFile& file) :
 	HDF5File::Group(file, NetworkGroup::path, false)
@@ -109,12 +395,50 @@ XFile::NetworkGroup::NetworkGroup(
 		*this, sizeAttrName, scalarDSpace);
 	normalSizeAttr.setTo(totalSize);
 
+	// The clusters are written as tables with one row per cluster
+	std::vector<double> formationEnergies(totalSize),
+		migrationEnergies(totalSize), diffusionFactors(totalSize);
 	for (core::network::IReactionNetwork::IndexType i = 0; i < totalSize; i++) {
 		auto cluster = network.getClusterCommon(i);
-		// Create and initialize the cluster group
-		ClusterGroup clusterGroup(*this, i, bounds[i],
-			cluster.getFormationEnergy(), cluster.getMigrationEnergy(),
-			cluster.getDiffusionFactor());
+		formationEnergies[i] = cluster.getFormationEnergy();
+		migrationEnergies[i] = cluster.getMigrationEnergy();
+		diffusionFactors[i] = cluster.getDiffusionFactor();
+	}
+	std::array<hsize_t, 1> columnDim{(hsize_t)totalSize};
+	XFile::SimpleDataSpace<1> columnDSpace(columnDim);
+	DataSet<std::vector<double>> formationDataset(
+		*this, formationEnergyDatasetName, columnDSpace);
+	formationDataset.write(formationEnergies);
+	DataSet<std::vector<double>> migrationDataset(
+		*this, migrationEnergyDatasetName, columnDSpace);
+	migrationDataset.write(migrationEnergies);
+	DataSet<std::vector<double>> diffusionDataset(
+		*this, diffusionFactorDatasetName, columnDSpace);
+	diffusionDataset.write(diffusionFactors);
+
+	// The bounds have the same size for every cluster
+	hsize_t nBounds = totalSize > 0 ? bounds[0].size() : 0;
+	std::vector<core::network::IReactionNetwork::AmountType> flatBounds;
+	flatBounds.reserve(totalSize * nBounds);
+	for (auto&& clusterBounds : bounds) {
+		flatBounds.insert(
+			flatBounds.end(), clusterBounds.begin(), clusterBounds.end());
+	}
+	writeTable(getId(), boundsDatasetName, flatBounds, nBounds);
+
+	// The moment ids are padded with -1
+	auto momentIds = network.getAllMomentIdInfo();
+	hsize_t nMoments = 0;
+	for (auto&& ids : momentIds) {
+		nMoments = std::max<hsize_t>(nMoments, ids.size());
+	}
+	if (nMoments > 0) {
+		std::vector<int> flatIds(totalSize * nMoments, -1);
+		for (auto i = 0; i < totalSize; i++) {
+			std::copy(momentIds[i].begin(), momentIds[i].end(),
+				flatIds.begin() + i * nMoments);
+		}
+		writeTable(getId(), momentIdsDatasetName, flatIds, nMoments);
 	}
 }
 
@@ -126,6 +450,102 @@ XFile::NetworkGroup::readNetworkSize() const
 	return totalSizeAttr.get();
 }
 
+bool
+XFile::NetworkGroup::isTabular() const
+{
+	return H5Lexists(getId(), boundsDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+XFile::NetworkGroup::NetworkBoundsType
+XFile::NetworkGroup::readClusterBounds() const
+{
+	NetworkBoundsType bounds;
+	if (not isTabular()) {
+		// One group per cluster
+		auto size = readNetworkSize();
+		double formation, migration, diffusion;
+		for (auto i = 0; i < size; i++) {
+			ClusterGroup clusterGroup(*this, i);
+			bounds.push_back(
+				clusterGroup.readCluster(formation, migration, diffusion));
+		}
+		return bounds;
+	}
+
+	hsize_t nBounds = 0;
+	auto flatBounds =
+		readTable<NetworkBoundsType::value_type::value_type>(
+			getId(), boundsDatasetName, nBounds);
+	for (auto it = flatBounds.begin(); it != flatBounds.end();
+		 it += nBounds) {
+		bounds.emplace_back(it, it + nBounds);
+	}
+	return bounds;
+}
+
+void
+XFile::NetworkGroup::readClusterProperties(
+	std::vector<double>& formationEnergies,
+	std::vector<double>& migrationEnergies,
+	std::vector<double>& diffusionFactors) const
+{
+	if (isTabular()) {
+		formationEnergies = readColumn(getId(), formationEnergyDatasetName);
+		migrationEnergies = readColumn(getId(), migrationEnergyDatasetName);
+		diffusionFactors = readColumn(getId(), diffusionFactorDatasetName);
+		return;
+	}
+
+	// One group per cluster
+	auto size = readNetworkSize();
+	formationEnergies.resize(size);
+	migrationEnergies.resize(size);
+	diffusionFactors.resize(size);
+	for (auto i = 0; i < size; i++) {
+		ClusterGroup clusterGroup(*this, i);
+		clusterGroup.readCluster(
+			formationEnergies[i], migrationEnergies[i], diffusionFactors[i]);
+	}
+}
+
+XFile::NetworkGroup::MomentIdsType
+XFile::NetworkGroup::readMomentIds() const
+{
+	MomentIdsType momentIds;
+	if (not isTabular()) {
+		return momentIds;
+	}
+
+	// The table is not written when there are no moments
+	if (H5Lexists(getId(), momentIdsDatasetName.c_str(), H5P_DEFAULT) <= 0) {
+		momentIds.resize(readNetworkSize());
+		return momentIds;
+	}
+
+	hsize_t nMoments = 0;
+	auto flatIds = readTable<int>(getId(), momentIdsDatasetName, nMoments);
+	for (auto it = flatIds.begin(); it != flatIds.end(); it += nMoments) {
+		momentIds.emplace_back();
+		for (auto id = it; id != it + nMoments and *id >= 0; ++id) {
+			momentIds.back().push_back(*id);
+		}
+	}
+	return momentIds;
+}
+
+XFile::NetworkGroup::NetworkBoundsType::value_type
+XFile::NetworkGroup::readClusterRow(int id, double& formationEnergy,
+	double& migrationEnergy, double& diffusionFactor) const
+{
+	formationEnergy = readColumn(getId(), formationEnergyDatasetName, id)[0];
+	migrationEnergy = readColumn(getId(), migrationEnergyDatasetName, id)[0];
+	diffusionFactor = readColumn(getId(), diffusionFactorDatasetName, id)[0];
+
+	hsize_t nBounds = 0;
+	return readTable<NetworkBoundsType::value_type::value_type>(
+		getId(), boundsDatasetName, nBounds, id, 1);
+}
+
 void
 XFile::NetworkGroup::readReactions(
 	core::network::IReactionNetwork& network) const
@@ -154,15 +574,22 @@ const std::string XFile::ClusterGroup::diffusionFactorAttrName =
 	"diffusionFactor";
 const std::string XFile::ClusterGroup::boundsAttrName = "bounds";
 
-XFile::ClusterGroup::ClusterGroup(const NetworkGroup& networkGroup, int id) :
-	HDF5File::Group(networkGroup, makeGroupName(id), false)
+XFile::ClusterGroup::ClusterGroup(
+	const NetworkGroup& _networkGroup, int _id) :
+	HDF5File::Group(_networkGroup,
+		_networkGroup.isTabular() ? std::string(".") : makeGroupName(_id),
+		false),
+	networkGroup(_networkGroup),
+	id(_id)
 {
 }
 
-XFile::ClusterGroup::ClusterGroup(const NetworkGroup& networkGroup, int id,
+XFile::ClusterGroup::ClusterGroup(const NetworkGroup& _networkGroup, int _id,
 	ClusterBoundsType bounds, double formationEnergy, double migrationEnergy,
 	double diffusionFactor) :
-	HDF5File::Group(networkGroup, makeGroupName(id), true)
+	HDF5File::Group(_networkGroup, makeGroupName(_id), true),
+	networkGroup(_networkGroup),
+	id(_id)
 {
 	// Write the region
 	std::array<hsize_t, 1> dim{bounds.size()};
@@ -203,6 +630,12 @@ XFile::ClusterGroup::ClusterBoundsType
 XFile::ClusterGroup::readCluster(double& formationEnergy,
 	double& migrationEnergy, double& diffusionFactor) const
 {
+	// The tabular layout has no group per cluster
+	if (networkGroup.isTabular()) {
+		return networkGroup.readClusterRow(
+			id, formationEnergy, migrationEnergy, diffusionFactor);
+	}
+
 	// Open and read the formation energy attribute
 	Attribute<double> formationEnergyAttr(*this, formationEnergyAttrName);
 	formationEnergy = formationEnergyAttr.get();
@@ -335,6 +768,83 @@ XFile::ConcentrationGroup::getTimestepGroup(int loop, int timeStep) const
 	return std::move(tsGroup);
 }
 
+std::unique_ptr<XFile::TimestepGroup>
+XFile::ConcentrationGroup::getTimestepGroup(
+	int ctrlStep, int loop, int timeStep) const
+{
+	std::unique_ptr<XFile::TimestepGroup> tsGroup;
+
+	try {
+		// Open the sub-group associated with the desired time step.
+		tsGroup = std::make_unique<XFile::TimestepGroup>(
+			*this, ctrlStep, loop, timeStep);
+	}
+	catch (HDF5Exception& e) {
+		// We were unable to open the group associated with the given time step.
+		assert(not tsGroup);
+	}
+
+	return std::move(tsGroup);
+}
+
+std::vector<std::array<int, 3>>
+XFile::ConcentrationGroup::getTimesteps(void) const
+{
+	// Collect the names of the sub-groups
+	std::vector<std::string> names;
+	auto addName = [](hid_t, const char* name, const H5L_info_t*,
+					   void* data) -> herr_t {
+		static_cast<std::vector<std::string>*>(data)->push_back(name);
+		return 0;
+	};
+	CHK(H5Literate(getId(), H5_INDEX_NAME, H5_ITER_NATIVE, nullptr, addName,
+		&names));
+
+	// Parse the ones that follow the time step naming
+	std::vector<std::array<int, 3>> timesteps;
+	auto prefix = TimestepGroup::groupNamePrefix;
+	for (auto const& name : names) {
+		if (name.compare(0, prefix.size(), prefix) != 0) {
+			continue;
+		}
+		std::array<int, 3> ids;
+		char sep1, sep2;
+		std::istringstream istr(name.substr(prefix.size()));
+		istr >> ids[0] >> sep1 >> ids[1] >> sep2 >> ids[2];
+		if (istr and sep1 == '_' and sep2 == '_') {
+			timesteps.push_back(ids);
+		}
+	}
+	std::sort(timesteps.begin(), timesteps.end());
+
+	return timesteps;
+}
+
+void
+XFile::ConcentrationGroup::removeTimestepGroup(
+	int ctrlStep, int loop, int timeStep) const
+{
+	auto name = TimestepGroup::makeGroupName(*this, ctrlStep, loop, timeStep);
+	CHK(H5Ldelete(getId(), name.c_str(), H5P_DEFAULT));
+}
+
+int
+XFile::ConcentrationGroup::pruneTimesteps(int keepLast) const
+{
+	auto timesteps = getTimesteps();
+	int nRemoved = 0;
+	for (int n = 0; n + keepLast < (int)timesteps.size(); ++n) {
+		auto const& ids = timesteps[n];
+		bool kept = TimestepGroup(*this, ids[0], ids[1], ids[2]).isKept();
+		if (not kept) {
+			removeTimestepGroup(ids[0], ids[1], ids[2]);
+			++nRemoved;
+		}
+	}
+
+	return nRemoved;
+}
+
 std::unique_ptr<XFile::TimestepGroup>
 XFile::ConcentrationGroup::getLastTimestepGroup(void) const
 {
@@ -382,6 +892,8 @@ const std::string XFile::TimestepGroup::nzAttrName = "nz";
 const std::string XFile::TimestepGroup::hzAttrName = "hz";
 
 const std::string XFile::TimestepGroup::concDatasetName = "concs";
+const std::string XFile::TimestepGroup::denseConcDatasetName = "denseConcs";
+const std::string XFile::TimestepGroup::keepAttrName = "keep";
 
 std::string
 XFile::TimestepGroup::makeGroupName(const XFile::ConcentrationGroup& concGroup,
@@ -914,11 +1426,89 @@ XFile::TimestepGroup::Concs1DType
 XFile::TimestepGroup::readConcentrations(
 	const XFile& file, int baseX, int numX) const
 {
+	// Convert the dense layout
+	if (hasDenseConcentrations()) {
+		int nValues = 0;
+		auto values =
+			readDenseConcentrations({baseX, 0, 0}, {numX, 1, 1}, nValues);
+		return denseToRagged(values, nValues);
+	}
+
 	// Open and read the ragged dataset.
 	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this, concDatasetName);
 	return dataset.read(baseX, numX);
 }
 
+auto
+XFile::TimestepGroup::makeRowRanges(const GridBox& globalSize,
+	const GridBox& start, const GridBox& count) -> std::vector<RowRange>
+{
+	std::vector<RowRange> ranges;
+	for (auto k = start[2]; k < start[2] + count[2]; ++k) {
+		for (auto j = start[1]; j < start[1] + count[1]; ++j) {
+			uint32_t first = (k * globalSize[1] + j) * globalSize[0] + start[0];
+			ranges.emplace_back(first, count[0]);
+		}
+	}
+	return ranges;
+}
+
+void
+XFile::TimestepGroup::writeConcentrations(const XFile& file,
+	const GridBox& globalSize, const GridBox& start, const GridBox& count,
+	const Concs1DType& concs) const
+{
+	// Create and write the ragged dataset.
+	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this, concDatasetName,
+		makeRowRanges(globalSize, start, count), concs);
+}
+
+XFile::TimestepGroup::Concs1DType
+XFile::TimestepGroup::readConcentrations(const XFile& file,
+	const GridBox& globalSize, const GridBox& start,
+	const GridBox& count) const
+{
+	// Convert the dense layout
+	if (hasDenseConcentrations()) {
+		int nValues = 0;
+		auto values = readDenseConcentrations(start, count, nValues);
+		return denseToRagged(values, nValues);
+	}
+
+	// Read only our rows of the ragged dataset.
+	RaggedDataSet2D<ConcType> dataset(file.getComm(), *this, concDatasetName);
+	return dataset.read(makeRowRanges(globalSize, start, count));
+}
+
+bool
+XFile::TimestepGroup::hasRaggedConcentrations(void) const
+{
+	return H5Lexists(getId(), concDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+void
+XFile::TimestepGroup::writeDenseConcentrations(const GridBox& globalSize,
+	const GridBox& start, const GridBox& count, int nValues,
+	const double* data, int deflateLevel) const
+{
+	writeDenseDataset(*this, denseConcDatasetName, globalSize, start, count,
+		nValues, data, deflateLevel);
+}
+
+bool
+XFile::TimestepGroup::hasDenseConcentrations(void) const
+{
+	return H5Lexists(getId(), denseConcDatasetName.c_str(), H5P_DEFAULT) > 0;
+}
+
+std::vector<double>
+XFile::TimestepGroup::readDenseConcentrations(const GridBox& start,
+	const GridBox& count, int& nValues, bool collective) const
+{
+	return readDenseDataset(
+		*this, denseConcDatasetName, start, count, nValues, collective);
+}
+
 std::pair<double, double>
 XFile::TimestepGroup::readTimes(void) const
 {
@@ -967,6 +1557,66 @@ XFile::TimestepGroup::readSizes(
 	hz = hzAttr.get();
 }
 
+void
+XFile::TimestepGroup::setKept(void) const
+{
+	if (isKept()) {
+		return;
+	}
+	XFile::ScalarDataSpace scalarDSpace;
+	Attribute<int> keepAttr(*this, keepAttrName, scalarDSpace);
+	keepAttr.setTo(1);
+}
+
+bool
+XFile::TimestepGroup::isKept(void) const
+{
+	return H5Aexists(getId(), keepAttrName.c_str()) > 0;
+}
+
+auto
+XFile::TimestepGroup::readGlobalSize() const -> GridBox
+{
+	int nx, ny, nz;
+	double hx, hy, hz;
+	readSizes(nx, hx, ny, hy, nz, hz);
+	GridBox globalSize{nx, std::max(ny, 1), std::max(nz, 1)};
+	if (ny > 0) {
+		return globalSize;
+	}
+
+	// The dense dataset is (z, y, x, value)
+	if (hasDenseConcentrations()) {
+		DataSet<double> dataset(*this, denseConcDatasetName);
+		SimpleDataSpace<4> fileSpace(dataset);
+		auto dims = fileSpace.getDims();
+		return {(int)dims[2], (int)dims[1], (int)dims[0]};
+	}
+
+	// Count the per grid point datasets along y and z
+	auto exists = [this](int j, int k) {
+		std::ostringstream datasetName;
+		datasetName << "position_0_" << j << "_" << k;
+		return H5Lexists(getId(), datasetName.str().c_str(), H5P_DEFAULT) >
+			0;
+	};
+	if (exists(0, 0)) {
+		while (exists(globalSize[1], 0)) {
+			++globalSize[1];
+		}
+		while (exists(0, globalSize[2])) {
+			++globalSize[2];
+		}
+	}
+	else if (exists(0, -1)) {
+		while (exists(globalSize[1], -1)) {
+			++globalSize[1];
+		}
+	}
+
+	return globalSize;
+}
+
 std::vector<double>
 XFile::TimestepGroup::readGrid() const
 {
@@ -1078,6 +1728,159 @@ XFile::TimestepGroup::readData3D(
 
 auto
 XFile::TimestepGroup::readGridPoint(int i, int j, int k) const -> Data3DType
+{
+	// Read the grid point from the dense layout, each process reads on its
+	// own
+	if (hasDenseConcentrations()) {
+		int nValues = 0;
+		auto values = readDenseConcentrations(
+			{i, std::max(j, 0), std::max(k, 0)}, {1, 1, 1}, nValues, false);
+		Data3DType toReturn;
+		for (auto l = 0; l < nValues; ++l) {
+			if (values[l] != 0.0) {
+				toReturn.push_back({(double)l, values[l]});
+			}
+		}
+		return toReturn;
+	}
+
+	return readPositionDataset(i, j, k);
+}
+
+auto
+XFile::TimestepGroup::readGridPoints(const XFile& file,
+	const GridBox& globalSize, int dim, const std::vector<GridBox>& points,
+	std::vector<uint32_t>& offsets, bool collective) const
+	-> std::vector<ConcType>
+{
+	// The rows of the points in the natural ordering, sorted and without
+	// duplicates
+	auto rowOf = [&globalSize](const GridBox& point) {
+		return (uint32_t)(
+			((std::size_t)point[2] * globalSize[1] + point[1]) * globalSize[0] +
+			point[0]);
+	};
+	std::vector<uint32_t> rows;
+	rows.reserve(points.size());
+	for (auto const& point : points) {
+		rows.push_back(rowOf(point));
+	}
+	bool inOrder = std::adjacent_find(rows.begin(), rows.end(),
+					   std::greater_equal<uint32_t>()) == rows.end();
+	if (not inOrder) {
+		std::sort(rows.begin(), rows.end());
+		rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+	}
+
+	// Read the concentrations of these rows
+	std::vector<uint32_t> rowOffsets;
+	std::vector<ConcType> rowConcs;
+	const uint32_t nx = globalSize[0];
+	const uint32_t ny = globalSize[1];
+	if (hasRaggedConcentrations()) {
+		std::vector<RowRange> ranges;
+		for (auto row : rows) {
+			ranges.emplace_back(row, 1);
+		}
+		RaggedDataSet2D<ConcType> dataset(
+			file.getComm(), *this, concDatasetName);
+		rowConcs = dataset.readFlat(ranges, rowOffsets, collective);
+	}
+	else if (hasDenseConcentrations()) {
+		DataSet<double> dataset(*this, denseConcDatasetName);
+		SimpleDataSpace<4> fileSpace(dataset);
+		hsize_t nValues = fileSpace.getDims()[3];
+
+		// One block for each run of consecutive points along x
+		auto op = H5S_SELECT_SET;
+		for (std::size_t n = 0, m = 1; n < rows.size(); n = m++) {
+			while (m < rows.size() and rows[m] == rows[m - 1] + 1 and
+				rows[m] % nx != 0) {
+				++m;
+			}
+			SimpleDataSpace<4>::Dimensions start{
+				rows[n] / (nx * ny), (rows[n] / nx) % ny, rows[n] % nx, 0};
+			SimpleDataSpace<4>::Dimensions count{1, 1, m - n, nValues};
+			CHK(H5Sselect_hyperslab(fileSpace.getId(), op, start.data(),
+				nullptr, count.data(), nullptr));
+			op = H5S_SELECT_OR;
+		}
+		SimpleDataSpace<1>::Dimensions memCount{rows.size() * nValues};
+		SimpleDataSpace<1> memSpace(memCount);
+		if (rows.empty()) {
+			CHK(H5Sselect_none(memSpace.getId()));
+			CHK(H5Sselect_none(fileSpace.getId()));
+		}
+
+		std::vector<double> values(memCount[0]);
+		PropertyList plist(H5P_DATASET_XFER);
+		CHK(H5Pset_dxpl_mpio(plist.getId(),
+			collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT));
+		TypeInMemory<double> memType;
+		auto status = H5Dread(dataset.getId(), memType.getId(),
+			memSpace.getId(), fileSpace.getId(), plist.getId(), values.data());
+		if (status < 0) {
+			std::ostringstream estr;
+			estr << "Failed to read dataset " << dataset.getName();
+			throw HDF5Exception(estr.str());
+		}
+
+		// Only keep the non-zero values
+		rowOffsets.assign(1, 0);
+		for (std::size_t n = 0; n < rows.size(); ++n) {
+			for (hsize_t l = 0; l < nValues; ++l) {
+				auto value = values[n * nValues + l];
+				if (value != 0.0) {
+					rowConcs.emplace_back(l, value);
+				}
+			}
+			rowOffsets.push_back(rowConcs.size());
+		}
+	}
+	else {
+		// One dataset per grid point, the unused directions are -1
+		rowOffsets.assign(1, 0);
+		for (auto row : rows) {
+			int i = row % nx;
+			int j = (dim > 1) ? (row / nx) % ny : -1;
+			int k = (dim > 2) ? row / (nx * ny) : -1;
+			auto pointConcs = readPositionDataset(i, j, k);
+			if (pointConcs.empty()) {
+				std::ostringstream estr;
+				estr << "\nXFile: no concentrations for the grid point (" << i
+					 << ", " << j << ", " << k << ") in the time step group "
+					 << getName();
+				throw std::runtime_error(estr.str());
+			}
+			for (auto&& conc : pointConcs) {
+				rowConcs.emplace_back((int)conc[0], conc[1]);
+			}
+			rowOffsets.push_back(rowConcs.size());
+		}
+	}
+
+	if (inOrder) {
+		offsets = std::move(rowOffsets);
+		return rowConcs;
+	}
+
+	// Put the points back in the requested order
+	offsets.assign(1, 0);
+	std::vector<ConcType> concs;
+	for (auto const& point : points) {
+		auto n = std::lower_bound(rows.begin(), rows.end(), rowOf(point)) -
+			rows.begin();
+		concs.insert(concs.end(), rowConcs.begin() + rowOffsets[n],
+			rowConcs.begin() + rowOffsets[n + 1]);
+		offsets.push_back(concs.size());
+	}
+
+	return concs;
+}
+
+auto
+XFile::TimestepGroup::readPositionDataset(int i, int j, int k) const
+	-> Data3DType
 {
 	// Set the dataset name
 	std::stringstream datasetName;
@@ -1125,5 +1928,112 @@ XFile::TimestepGroup::readGridPoint(int i, int j, int k) const -> Data3DType
 	return toReturn;
 }
 
+//----------------------------------------------------------------------------
+// MultiGroup
+//
+const fs::path XFile::MultiGroup::path = "/multiGroup";
+const std::string XFile::MultiGroup::stepAttrName = "step";
+const std::string XFile::MultiGroup::timeAttrName = "time";
+const std::string XFile::MultiGroup::deltaTimeAttrName = "deltaTime";
+const std::string XFile::MultiGroup::partitionAttrName = "partition";
+const std::string XFile::MultiGroup::partitionSizesAttrName =
+	"partitionSizes";
+const std::string XFile::MultiGroup::subRangesAttrName = "subRanges";
+const std::string XFile::MultiGroup::subDOFsAttrName = "subDOFs";
+const std::string XFile::MultiGroup::subDeltaTimesAttrName = "subDeltaTimes";
+const std::string XFile::MultiGroup::instanceNamePrefix = "instance_";
+const std::string XFile::MultiGroup::concDatasetName = "denseConcs";
+
+XFile::MultiGroup::MultiGroup(const XFile& file, bool create) :
+	HDF5File::Group(file, MultiGroup::path, create)
+{
+}
+
+void
+XFile::MultiGroup::writeTimes(
+	std::size_t step, double time, double deltaTime) const
+{
+	XFile::ScalarDataSpace scalarDSpace;
+	Attribute<decltype(step)> stepAttr(*this, stepAttrName, scalarDSpace);
+	stepAttr.setTo(step);
+	Attribute<decltype(time)> timeAttr(*this, timeAttrName, scalarDSpace);
+	timeAttr.setTo(time);
+	Attribute<decltype(deltaTime)> deltaTimeAttr(
+		*this, deltaTimeAttrName, scalarDSpace);
+	deltaTimeAttr.setTo(deltaTime);
+}
+
+std::tuple<std::size_t, double, double>
+XFile::MultiGroup::readTimes(void) const
+{
+	Attribute<std::size_t> stepAttr(*this, stepAttrName);
+	Attribute<double> timeAttr(*this, timeAttrName);
+	Attribute<double> deltaTimeAttr(*this, deltaTimeAttrName);
+	return std::make_tuple(stepAttr.get(), timeAttr.get(), deltaTimeAttr.get());
+}
+
+void
+XFile::MultiGroup::writeInstances(const Partition& partition, int nSubRanges,
+	const std::vector<int>& subDOFs,
+	const std::vector<double>& subDeltaTimes) const
+{
+	// The partition is flattened
+	std::vector<int> blockIds, sizes;
+	for (auto&& blocks : partition) {
+		sizes.push_back(blocks.size());
+		blockIds.insert(blockIds.end(), blocks.begin(), blocks.end());
+	}
+	writeVectorAttribute(getId(), partitionAttrName, blockIds);
+	writeVectorAttribute(getId(), partitionSizesAttrName, sizes);
+	XFile::ScalarDataSpace scalarDSpace;
+	Attribute<int> subRangesAttr(*this, subRangesAttrName, scalarDSpace);
+	subRangesAttr.setTo(nSubRanges);
+
+	writeVectorAttribute(getId(), subDOFsAttrName, subDOFs);
+	writeVectorAttribute(getId(), subDeltaTimesAttrName, subDeltaTimes);
+}
+
+auto
+XFile::MultiGroup::readInstances(int& nSubRanges, std::vector<int>& subDOFs,
+	std::vector<double>& subDeltaTimes) const -> Partition
+{
+	auto blockIds = readVectorAttribute<int>(getId(), partitionAttrName);
+	auto sizes = readVectorAttribute<int>(getId(), partitionSizesAttrName);
+	Partition partition;
+	auto first = blockIds.begin();
+	for (auto size : sizes) {
+		partition.emplace_back(first, first + size);
+		first += size;
+	}
+	Attribute<int> subRangesAttr(*this, subRangesAttrName);
+	nSubRanges = subRangesAttr.get();
+
+	subDOFs = readVectorAttribute<int>(getId(), subDOFsAttrName);
+	subDeltaTimes = readVectorAttribute<double>(getId(), subDeltaTimesAttrName);
+
+	return partition;
+}
+
+void
+XFile::MultiGroup::writeConcentrations(int id, const GridBox& globalSize,
+	const GridBox& start, const GridBox& count, int nValues,
+	const double* data) const
+{
+	HDF5File::Group instanceGroup(
+		*this, instanceNamePrefix + std::to_string(id), true);
+	writeDenseDataset(instanceGroup, concDatasetName, globalSize, start, count,
+		nValues, data, 0);
+}
+
+std::vector<double>
+XFile::MultiGroup::readConcentrations(int id, const GridBox& start,
+	const GridBox& count, int& nValues) const
+{
+	HDF5File::Group instanceGroup(
+		*this, instanceNamePrefix + std::to_string(id), false);
+	return readDenseDataset(
+		instanceGroup, concDatasetName, start, count, nValues, true);
+}
+
 } // namespace io
 } // namespace xolotl
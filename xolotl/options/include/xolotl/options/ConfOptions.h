@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iosfwd>
+
 #include <xolotl/options/Options.h>
 
 namespace xolotl
@@ -20,6 +22,15 @@ public:
 
 	void
 	readParams(int argc, const char* argv[]) override;
+
+	/**
+	 * Read the PETSc arguments of a parameter file and nothing else.
+	 *
+	 * @param ifs The parameter file
+	 * @return The PETSc arguments
+	 */
+	static std::string
+	readPetscArgs(std::ifstream& ifs);
 };
 } // namespace options
 } // namespace xolotl
@@ -363,6 +363,25 @@ public:
 	virtual void
 	setNetworkParameters(const std::vector<IdType>& params) = 0;
 
+	/**
+	 * Obtain the smallest and largest sizes of the clusters kept for each
+	 * network parameter, the other clusters are not part of the network.
+	 * Empty when all of them are kept.
+	 *
+	 * @return vector of size ranges
+	 */
+	virtual const std::vector<std::array<IdType, 2>>&
+	getNetworkSizeRanges() const = 0;
+
+	/**
+	 * Replace the size ranges of the clusters kept for each network
+	 * parameter
+	 *
+	 * @param ranges List of size ranges
+	 */
+	virtual void
+	setNetworkSizeRanges(const std::vector<std::array<IdType, 2>>& ranges) = 0;
+
 	/**
 	 * Obtain the maximum value of impurities (He or Xe) to be used.
 	 *
@@ -635,6 +654,35 @@ public:
 	virtual double
 	getCascadeEfficiency() const = 0;
 
+	/**
+	 * Obtain the name of the time integration scheme: "coupled" integrates
+	 * all the terms together, "strang" splits reactions and incident flux
+	 * from transport (diffusion, advection, heat) with Strang splitting, and
+	 * "imex" treats the incident flux (and optionally advection and Soret)
+	 * explicitly with an additive Runge-Kutta scheme.
+	 *
+	 * @return The name of the scheme
+	 */
+	virtual std::string
+	getTimeIntegrationName() const = 0;
+
+	/**
+	 * Obtain the temperatures of the 0D ensemble members, each member is an
+	 * independent 0D case solved in the same process.
+	 *
+	 * @return The temperatures, empty if they are not varied
+	 */
+	virtual const std::vector<double>&
+	getEnsembleTemperatures() const = 0;
+
+	/**
+	 * Obtain the factors applied to the flux of the 0D ensemble members.
+	 *
+	 * @return The factors, empty if the flux is not varied
+	 */
+	virtual const std::vector<double>&
+	getEnsembleFluxFactors() const = 0;
+
 protected:
 	friend class ::xolotl::interface::MultiXolotl;
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <iosfwd>
+
 #include <boost/property_tree/ptree_fwd.hpp>
 
 #include <xolotl/options/Options.h>
@@ -23,6 +25,15 @@ public:
 	void
 	readParams(int argc, const char* argv[]) override;
 
+	/**
+	 * Read the PETSc arguments of a parameter file and nothing else.
+	 *
+	 * @param ifs The parameter file
+	 * @return The PETSc arguments
+	 */
+	static std::string
+	readPetscArgs(std::ifstream& ifs);
+
 private:
 	std::unique_ptr<boost::property_tree::iptree> _map;
 };
@@ -198,6 +198,11 @@ protected:
 	 */
 	std::vector<IdType> networkParams;
 
+	/**
+	 * Size range of the clusters kept for each network parameter
+	 */
+	std::vector<std::array<IdType, 2>> networkSizeRanges;
+
 	/**
 	 * Maximum number of He or Xe
 	 */
@@ -361,6 +366,21 @@ protected:
 	 */
 	double cascadeEfficiency;
 
+	/**
+	 * Name of the time integration scheme.
+	 */
+	std::string timeIntegrationName;
+
+	/**
+	 * Temperatures of the ensemble members (0D only).
+	 */
+	std::vector<double> ensembleTemperatures;
+
+	/**
+	 * Factors applied to the flux of the ensemble members (0D only).
+	 */
+	std::vector<double> ensembleFluxFactors;
+
 public:
 	/**
 	 * The constructor.
@@ -726,6 +746,25 @@ public:
 	void
 	setNetworkParameters(const std::vector<IdType>& params) override;
 
+	/**
+	 * \see IOptions.h
+	 */
+	const std::vector<std::array<IdType, 2>>&
+	getNetworkSizeRanges() const override
+	{
+		return networkSizeRanges;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	void
+	setNetworkSizeRanges(
+		const std::vector<std::array<IdType, 2>>& ranges) override
+	{
+		networkSizeRanges = ranges;
+	}
+
 	/**
 	 * \see IOptions.h
 	 */
@@ -1040,6 +1079,33 @@ public:
 		return cascadeEfficiency;
 	}
 
+	/**
+	 * \see IOptions.h
+	 */
+	std::string
+	getTimeIntegrationName() const override
+	{
+		return timeIntegrationName;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	const std::vector<double>&
+	getEnsembleTemperatures() const override
+	{
+		return ensembleTemperatures;
+	}
+
+	/**
+	 * \see IOptions.h
+	 */
+	const std::vector<double>&
+	getEnsembleFluxFactors() const override
+	{
+		return ensembleFluxFactors;
+	}
+
 protected:
 	/**
 	 * \see IOptions.h
@@ -1080,6 +1146,9 @@ protected:
 	void
 	checkVizHandlerName() const;
 
+	void
+	checkTimeIntegrationName() const;
+
 	void
 	setGridParam(const std::vector<double>& params);
 
@@ -1125,11 +1194,35 @@ protected:
 	void
 	setGroupingParams(const std::string& paramString);
 
+	void
+	setEnsembleTemperatures(const std::vector<double>& params);
+
+	void
+	setEnsembleTemperatures(const std::string& paramStr);
+
+	void
+	setEnsembleFluxFactors(const std::vector<double>& params);
+
+	void
+	setEnsembleFluxFactors(const std::string& paramStr);
+
+	void
+	checkEnsemble() const;
+
 	void
 	appendPetscArg(const std::string& arg);
 };
 
 std::shared_ptr<IOptions>
 createOptions(int argc, const char* argv[]);
+
+/**
+ * Read the PETSc arguments of the parameter file with the reader of its
+ * format. Nothing is logged so it can be used before MPI is initialized.
+ *
+ * @return The PETSc arguments, empty if the file can't be read
+ */
+std::string
+readPetscArgs(int argc, const char* argv[]);
 } /* namespace options */
 } /* namespace xolotl */
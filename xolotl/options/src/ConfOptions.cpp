@@ -229,7 +229,17 @@ ConfOptions::readParams(int argc, const char* argv[])
 		bpo::value<double>(&cascadeEfficiency)->default_value(0.0),
 		"The value of the remaining efficiency once the overlap effect started "
 		"(0.0 by "
-		"default).");
+		"default).")("timeIntegration",
+		bpo::value<std::string>(&timeIntegrationName)
+			->default_value("coupled"),
+		"The time integration scheme: all the terms together (coupled, "
+		"default), Strang splitting between reactions and transport "
+		"(strang), or implicit-explicit with the flux treated explicitly "
+		"(imex).")("ensembleTemp", bpo::value<std::string>(),
+		"The list of temperatures (K) of the members of a 0D ensemble solved "
+		"in the same process.")("ensembleFlux", bpo::value<std::string>(),
+		"The list of factors applied to the flux for the members of a 0D "
+		"ensemble solved in the same process.");
 
 	bpo::options_description visible("Allowed options");
 	visible.add(desc).add(config);
@@ -284,6 +294,11 @@ ConfOptions::readParams(int argc, const char* argv[])
 		checkVizHandlerName();
 	}
 
+	// Take care of the time integration scheme
+	if (opts.count("timeIntegration")) {
+		checkTimeIntegrationName();
+	}
+
 	// Take care of the grid
 	if (opts.count("gridParam")) {
 		setGridParam(opts["gridParam"].as<std::string>());
@@ -327,6 +342,15 @@ ConfOptions::readParams(int argc, const char* argv[])
 		setBoundaries(opts["boundary"].as<std::string>());
 	}
 
+	// Take care of the 0D ensemble
+	if (opts.count("ensembleTemp")) {
+		setEnsembleTemperatures(opts["ensembleTemp"].as<std::string>());
+	}
+	if (opts.count("ensembleFlux")) {
+		setEnsembleFluxFactors(opts["ensembleFlux"].as<std::string>());
+	}
+	checkEnsemble();
+
 	// Take care of the rng
 	if (opts.count("rng")) {
 		processRNGParam(opts["rng"].as<std::string>());
@@ -337,5 +361,21 @@ ConfOptions::readParams(int argc, const char* argv[])
 		setPulseParams(opts["pulse"].as<std::string>());
 	}
 }
+
+std::string
+ConfOptions::readPetscArgs(std::ifstream& ifs)
+{
+	std::string petscArgs;
+	bpo::options_description config("Parameters");
+	config.add_options()(
+		"petscArgs", bpo::value<std::string>(&petscArgs), "PETSc arguments");
+
+	// Every other parameter is left to readParams
+	bpo::variables_map opts;
+	store(parse_config_file(ifs, config, true), opts);
+	notify(opts);
+
+	return petscArgs;
+}
 } // namespace options
 } // namespace xolotl
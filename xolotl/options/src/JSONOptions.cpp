@@ -291,11 +291,50 @@ JSONOptions::readParams(int argc, const char* argv[])
 
 	checkSetParam(tree, "cascadeEfficiency", cascadeEfficiency);
 
+	timeIntegrationName = tree.get("timeIntegration", "coupled");
+	checkTimeIntegrationName();
+
+	if (tree.count("ensembleTemp")) {
+		auto node = tree.get_child("ensembleTemp");
+		if (node.empty()) {
+			setEnsembleTemperatures(node.get_value<std::string>());
+		}
+		else {
+			setEnsembleTemperatures(asVector<double>(node));
+		}
+	}
+	if (tree.count("ensembleFlux")) {
+		auto node = tree.get_child("ensembleFlux");
+		if (node.empty()) {
+			setEnsembleFluxFactors(node.get_value<std::string>());
+		}
+		else {
+			setEnsembleFluxFactors(asVector<double>(node));
+		}
+	}
+	checkEnsemble();
+
 	if (tree.count("petscArgs")) {
 		for (auto&& elem : tree.get_child("petscArgs")) {
 			appendPetscArg(elem.second.data());
 		}
 	}
 }
+
+std::string
+JSONOptions::readPetscArgs(std::ifstream& ifs)
+{
+	boost::property_tree::iptree tree;
+	auto ss = stripComments(ifs);
+	boost::property_tree::read_json(ss, tree);
+
+	std::string petscArgs;
+	if (tree.count("petscArgs")) {
+		for (auto&& elem : tree.get_child("petscArgs")) {
+			petscArgs += " " + elem.second.data();
+		}
+	}
+	return petscArgs;
+}
 } // namespace options
 } // namespace xolotl
@@ -85,7 +85,8 @@ Options::Options() :
 	basalPortion(0.1),
 	transitionSize(325),
 	cascadeDose(-1.0),
-	cascadeEfficiency(0.0)
+	cascadeEfficiency(0.0),
+	timeIntegrationName("coupled")
 {
 }
 
@@ -139,6 +140,11 @@ Options::printAll(std::ostream& os) const
 		os << ' ' << p;
 	}
 	os << '\n';
+	os << "networkSizeRanges:";
+	for (auto&& r : networkSizeRanges) {
+		os << " [" << r[0] << ", " << r[1] << ']';
+	}
+	os << '\n';
 	os << "maxImpurity: " << maxImpurity << '\n';
 	os << "maxD: " << maxD << '\n';
 	os << "maxT: " << maxT << '\n';
@@ -186,6 +192,17 @@ Options::printAll(std::ostream& os) const
 	os << "transitionSize: " << transitionSize << '\n';
 	os << "cascadeDose: " << cascadeDose << '\n';
 	os << "cascadeEfficiency: " << cascadeEfficiency << '\n';
+	os << "timeIntegrationName: \"" << timeIntegrationName << "\"\n";
+	os << "ensembleTemperatures:";
+	for (auto&& t : ensembleTemperatures) {
+		os << " " << t;
+	}
+	os << '\n';
+	os << "ensembleFluxFactors:";
+	for (auto&& f : ensembleFluxFactors) {
+		os << " " << f;
+	}
+	os << '\n';
 
 	os << "processMap:";
 	for (auto&& p : processMap) {
@@ -321,6 +338,18 @@ Options::checkVizHandlerName() const
 	}
 }
 
+void
+Options::checkTimeIntegrationName() const
+{
+	static const std::string schemes[] = {"coupled", "strang", "imex"};
+	if (std::find(begin(schemes), end(schemes), timeIntegrationName) ==
+		end(schemes)) {
+		throw InvalidOptionValue(
+			"Options: could not understand the time integration scheme: " +
+			timeIntegrationName + ". Aborting!");
+	}
+}
+
 void
 Options::setGridParam(const std::vector<double>& params)
 {
@@ -521,6 +550,49 @@ Options::setGroupingParams(const std::string& paramString)
 	setGroupingParams(tokens);
 }
 
+void
+Options::setEnsembleTemperatures(const std::vector<double>& params)
+{
+	ensembleTemperatures = params;
+}
+
+void
+Options::setEnsembleTemperatures(const std::string& paramStr)
+{
+	// Break the argument into tokens.
+	auto tokens = util::Tokenizer<double>{paramStr}();
+	setEnsembleTemperatures(tokens);
+}
+
+void
+Options::setEnsembleFluxFactors(const std::vector<double>& params)
+{
+	ensembleFluxFactors = params;
+}
+
+void
+Options::setEnsembleFluxFactors(const std::string& paramStr)
+{
+	// Break the argument into tokens.
+	auto tokens = util::Tokenizer<double>{paramStr}();
+	setEnsembleFluxFactors(tokens);
+}
+
+void
+Options::checkEnsemble() const
+{
+	if (!ensembleTemperatures.empty() && !ensembleFluxFactors.empty() &&
+		ensembleTemperatures.size() != ensembleFluxFactors.size()) {
+		throw InvalidOptionValue("Options: the ensemble temperatures and flux "
+								 "factors must have the same size. Aborting!");
+	}
+	if ((!ensembleTemperatures.empty() || !ensembleFluxFactors.empty()) &&
+		dimensionNumber != 0) {
+		throw InvalidOptionValue(
+			"Options: the ensemble mode is only available in 0D. Aborting!");
+	}
+}
+
 void
 Options::appendPetscArg(const std::string& arg)
 {
@@ -547,5 +619,29 @@ createOptions(int argc, const char* argv[])
 
 	return std::make_shared<ConfOptions>();
 }
+
+std::string
+readPetscArgs(int argc, const char* argv[])
+{
+	if (argc < 2) {
+		return {};
+	}
+
+	std::ifstream ifs(argv[1]);
+	if (!ifs) {
+		return {};
+	}
+
+	// A malformed file is reported when the options are read
+	try {
+		if (fs::path(argv[1]).extension() == ".json") {
+			return JSONOptions::readPetscArgs(ifs);
+		}
+		return ConfOptions::readPetscArgs(ifs);
+	}
+	catch (const std::exception&) {
+		return {};
+	}
+}
 } // end namespace options
 } // end namespace xolotl
@@ -53,6 +53,15 @@ public:
 	{
 		++value;
 	}
+
+	/**
+	 * This operation increments the EventCounter by the given count.
+	 */
+	void
+	increment(IEventCounter::ValType count) override
+	{
+		value += count;
+	}
 };
 // end class EventCounter
 
@@ -55,6 +55,13 @@ public:
 	 */
 	virtual void
 	increment() = 0;
+
+	/**
+	 * This operation increments the IEventCounter by the number of events
+	 * counted elsewhere.
+	 */
+	virtual void
+	increment(ValType count) = 0;
 };
 // end class IEventCounter
 
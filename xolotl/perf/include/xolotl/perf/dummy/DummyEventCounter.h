@@ -49,6 +49,14 @@ public:
 	increment()
 	{
 	}
+
+	/**
+	 * This operation increments the DummyEventCounter by the given count.
+	 */
+	virtual void
+	increment(IEventCounter::ValType)
+	{
+	}
 };
 // end class DummyEventCounter
 
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <xolotl/config.h>
+
+namespace xolotl
+{
+namespace solver
+{
+/**
+ * Describes how the local concentrations are laid out in a flat buffer owned
+ * by the caller. The value of the component ids[n] at the local grid point
+ * (i, j, k) is stored at
+ *     i * pointStrides[0] + j * pointStrides[1] + k * pointStrides[2]
+ *         + n * componentStride
+ * The default layout is the one of the solution: all the components (dof + 1
+ * values, the last one being the temperature) of a grid point are contiguous
+ * and x is the fastest direction.
+ */
+struct BufferLayout
+{
+	//! The components stored in the buffer, all of them when empty
+	std::vector<IdType> ids;
+
+	//! The distance between two consecutive components of a grid point
+	IdType componentStride{1};
+
+	//! The distance between two consecutive grid points in each direction.
+	//! A zero value packs the grid points after the previous direction, the
+	//! first direction being packed after the components of a point when
+	//! they are contiguous and with a stride of one otherwise.
+	std::array<IdType, 3> pointStrides{0, 0, 0};
+};
+} /* namespace solver */
+} /* namespace xolotl */
@@ -2,8 +2,10 @@
 #define ISOLVER_H
 
 // Includes
+#include <array>
 #include <map>
 
+#include <xolotl/solver/BufferLayout.h>
 #include <xolotl/solver/handler/ISolverHandler.h>
 
 namespace xolotl
@@ -72,6 +74,51 @@ public:
 		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
 	getConcVector() = 0;
 
+	/**
+	 * Copy the first components of the local concentrations in a flat
+	 * buffer, one row of nComponents values per local grid point with x
+	 * being the fastest direction.
+	 *
+	 * @param nComponents The number of values to copy per grid point
+	 * @param concs The buffer, only resized if it is too small
+	 * @return The number of grid points copied
+	 */
+	virtual IdType
+	getConcentrations(IdType nComponents, std::vector<double>& concs) = 0;
+
+	/**
+	 * Copy the local concentrations in a buffer owned by the caller, without
+	 * any intermediate allocation.
+	 *
+	 * @param layout The layout of the buffer
+	 * @param buffer The buffer
+	 */
+	virtual void
+	getConcentrations(const BufferLayout& layout, double* buffer) = 0;
+
+	/**
+	 * Set the local concentrations from a buffer owned by the caller. The
+	 * components that are not in the layout keep their value, and the
+	 * temperature of the network is updated.
+	 *
+	 * @param layout The layout of the buffer
+	 * @param buffer The buffer
+	 */
+	virtual void
+	setConcentrations(const BufferLayout& layout, const double* buffer) = 0;
+
+	/**
+	 * Get the part of the grid of the solution owned by this process, in the
+	 * (x, y, z) order.
+	 *
+	 * @param start The first grid point we own
+	 * @param count The number of grid points we own in each direction
+	 * @param globalSize The number of grid points in each direction
+	 */
+	virtual void
+	getLocalGridBox(std::array<IdType, 3>& start, std::array<IdType, 3>& count,
+		std::array<IdType, 3>& globalSize) = 0;
+
 	/**
 	 * This operation sets the concentration vector in the current state of the
 	 * simulation.
@@ -0,0 +1,146 @@
+#pragma once
+
+// Includes
+#include <petscksp.h>
+
+#include <array>
+#include <vector>
+
+#include <xolotl/core/network/IReactionNetwork.h>
+#include <xolotl/perf/IPerfHandler.h>
+#include <xolotl/perf/ITimer.h>
+
+namespace xolotl
+{
+namespace solver
+{
+/**
+ * This class implements a block-Jacobi preconditioner where each block is the
+ * (dof + 1) x (dof + 1) network block of a grid point (clusters, moments, and
+ * temperature). It is attached to PETSc as a PCSHELL.
+ *
+ * The sparsity of the block is the same at every grid point because it comes
+ * from the network connectivity. The symbolic LU factorization (fill-in
+ * pattern and list of elimination updates) is thus computed only once and
+ * reused for all the grid points and Newton iterations; only the numeric
+ * factorization is redone when the operator changes.
+ *
+ * The coupling between grid points (diffusion, advection) is neglected by the
+ * block solve and can be recovered with a few outer Richardson iterations on
+ * the full operator.
+ */
+class NetworkPreconditioner
+{
+public:
+	using SparseFillMap = core::network::IReactionNetwork::SparseFillMap;
+
+	NetworkPreconditioner() = delete;
+
+	/**
+	 * The constructor.
+	 *
+	 * @param network The reaction network giving the block sparsity
+	 * @param perfHandler The perf handler to use for timers
+	 * @param outerIterations The number of outer iterations to account for
+	 * the coupling between grid points (1 means plain block-Jacobi)
+	 */
+	NetworkPreconditioner(core::network::IReactionNetwork& network,
+		perf::IPerfHandler& perfHandler, PetscInt outerIterations = 1);
+
+	/**
+	 * Set the PETSc preconditioner to be a shell using this object.
+	 *
+	 * @param pc The PETSc preconditioner
+	 */
+	PetscErrorCode
+	attach(PC pc);
+
+	/**
+	 * Compute the numeric factorization of every local block from the
+	 * preconditioning matrix.
+	 *
+	 * @param pc The PETSc preconditioner
+	 */
+	PetscErrorCode
+	setUp(PC pc);
+
+	/**
+	 * Apply the preconditioner.
+	 *
+	 * @param pc The PETSc preconditioner
+	 * @param x The input vector
+	 * @param y The output vector
+	 */
+	PetscErrorCode
+	apply(PC pc, Vec x, Vec y);
+
+	/**
+	 * Free the PETSc objects owned by the preconditioner.
+	 */
+	PetscErrorCode
+	destroy();
+
+private:
+	/**
+	 * Compute the fill-in pattern of the LU factors of the network block
+	 * and the list of elimination updates. It only depends on the network
+	 * connectivity.
+	 *
+	 * @param fillMap The network connectivity
+	 */
+	void
+	symbolicFactorization(const SparseFillMap& fillMap);
+
+	/**
+	 * Find the position of entry (row, col) in the factor storage.
+	 *
+	 * @return The position or -1 if it is not part of the pattern
+	 */
+	PetscInt
+	findPosition(PetscInt row, PetscInt col) const;
+
+	/**
+	 * Factorize in place the block starting at the given pointer.
+	 */
+	void
+	factorBlock(double* lu) const;
+
+	/**
+	 * Solve LU x = b in place for one block.
+	 */
+	void
+	solveBlock(const double* lu, double* x) const;
+
+	//! The size of a block (DOF + temperature)
+	PetscInt _blockSize;
+
+	//! The number of outer iterations
+	PetscInt _outerIterations;
+
+	//! The number of blocks owned by this process
+	PetscInt _nBlocks;
+
+	//! CSR description of the factors (including fill-in)
+	std::vector<PetscInt> _rowStart;
+	std::vector<PetscInt> _cols;
+	std::vector<PetscInt> _diagPos;
+
+	//! For each strictly lower entry, the range of its updates in _updates
+	std::vector<PetscInt> _updateStart;
+
+	//! The elimination updates: (target position, U position) pairs
+	std::vector<std::array<PetscInt, 2>> _updates;
+
+	//! The factored values for all the local blocks
+	std::vector<double> _factors;
+
+	//! Work vector for the outer iterations
+	Vec _residual;
+
+	//! Timers
+	std::shared_ptr<perf::ITimer> _setUpTimer;
+	std::shared_ptr<perf::ITimer> _applyTimer;
+};
+// end class NetworkPreconditioner
+} /* namespace solver */
+} /* namespace xolotl */
@@ -8,6 +8,8 @@ namespace xolotl
 {
 namespace solver
 {
+class NetworkPreconditioner;
+
 /**
  * This class realizes the Solver interface to solve the
  * diffusion-reaction problem with the PETSc solvers from Argonne
@@ -38,6 +40,67 @@ private:
 	 */
 	PetscOptions petscOptions;
 
+	/**
+	 * The network block preconditioner (only used with -network_pc or the
+	 * splitting).
+	 */
+	std::unique_ptr<NetworkPreconditioner> networkPC;
+
+	/**
+	 * Name of the time integration scheme (coupled, strang, or imex).
+	 */
+	std::string timeIntegration{"coupled"};
+
+	/**
+	 * The groups of terms treated explicitly with the imex scheme.
+	 */
+	unsigned int explicitTerms{0};
+
+	/**
+	 * Time stepper for the transport part when the splitting is used.
+	 */
+	TS transportTs{nullptr};
+
+	/**
+	 * Time up to which the transport part was integrated.
+	 */
+	PetscReal transportTime{0.0};
+
+	/**
+	 * Last time step taken by the transport time stepper.
+	 */
+	PetscReal transportDt{0.0};
+
+	/**
+	 * Solution and transport time at the beginning of the current split
+	 * step, to redo the first transport half step when the reaction step is
+	 * retried with a smaller time step.
+	 */
+	Vec splitStartC{nullptr};
+	PetscReal splitStartTime{0.0};
+
+	/**
+	 * Time step the first transport half step was computed for.
+	 */
+	PetscReal splitDt{0.0};
+
+	/**
+	 * Whether the heat equation is solved separately from the clusters
+	 * (-heat_decoupled).
+	 */
+	PetscBool heatDecoupled{PETSC_FALSE};
+
+	/**
+	 * Number of implicit sub-steps of the heat equation per time step
+	 * (-heat_substeps).
+	 */
+	PetscInt heatSubSteps{1};
+
+	/**
+	 * Time up to which the heat equation was integrated.
+	 */
+	PetscReal heatTime{0.0};
+
 	/**
 	 * Timer for rhsFunction
 	 */
@@ -53,6 +116,16 @@ private:
 	 */
 	std::shared_ptr<perf::ITimer> solveTimer;
 
+	/**
+	 * Timer for the transport sub-steps
+	 */
+	std::shared_ptr<perf::ITimer> transportTimer;
+
+	/**
+	 * Timer for the heat equation sub-steps
+	 */
+	std::shared_ptr<perf::ITimer> heatTimer;
+
 	// For the monitors
 	std::vector<std::vector<std::vector<double>>> _nSurf;
 	std::vector<std::vector<std::vector<double>>> _nBulk;
@@ -73,6 +146,59 @@ private:
 	setupInitialConditions(
 		DM data, Vec solutionVector, DM oldData, Vec oldSolution);
 
+	/**
+	 * Create the time stepper integrating the transport terms, it shares the
+	 * DM and solution vector with the main time stepper.
+	 *
+	 * @param J The Jacobian of the main time stepper, its structure is
+	 * duplicated
+	 */
+	void
+	createTransportTS(Mat J);
+
+	/**
+	 * Integrate the transport terms from transportTime to the target time.
+	 *
+	 * @param U The solution vector, modified in place
+	 * @param targetTime The time to reach
+	 */
+	PetscErrorCode
+	advanceTransport(Vec U, PetscReal targetTime);
+
+	/**
+	 * Integrate the heat equation from heatTime to the target time, the
+	 * clusters see the new temperature from the next time step on.
+	 *
+	 * @param U The solution vector, modified in place
+	 * @param targetTime The time to reach
+	 */
+	PetscErrorCode
+	advanceHeat(Vec U, PetscReal targetTime);
+
+	/**
+	 * Get the groups of terms integrated by the given time stepper.
+	 *
+	 * @param ts The time stepper
+	 * @return The combination of RHSTerm flags
+	 */
+	unsigned int
+	getRHSTerms(TS ts) const;
+
+	/**
+	 * Evaluate the given groups of terms of the right-hand side.
+	 */
+	PetscErrorCode
+	computeRHSFunction(
+		TS ts, PetscReal ftime, Vec C, Vec F, unsigned int terms);
+
+	/**
+	 * Evaluate the Jacobian of the given groups of terms of the right-hand
+	 * side.
+	 */
+	PetscErrorCode
+	computeRHSJacobian(
+		TS ts, PetscReal ftime, Vec C, Mat A, Mat J, unsigned int terms);
+
 public:
 	/**
 	 * Default constructor, deleted because we must construct using arguments.
@@ -107,6 +233,33 @@ public:
 		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
 	getConcVector() override;
 
+	/**
+	 * \see ISolver.h
+	 */
+	IdType
+	getConcentrations(
+		IdType nComponents, std::vector<double>& concs) override;
+
+	/**
+	 * \see ISolver.h
+	 */
+	void
+	getConcentrations(const BufferLayout& layout, double* buffer) override;
+
+	/**
+	 * \see ISolver.h
+	 */
+	void
+	setConcentrations(
+		const BufferLayout& layout, const double* buffer) override;
+
+	/**
+	 * \see ISolver.h
+	 */
+	void
+	getLocalGridBox(std::array<IdType, 3>& start, std::array<IdType, 3>& count,
+		std::array<IdType, 3>& globalSize) override;
+
 	/**
 	 * \see ISolver.h
 	 */
@@ -165,6 +318,44 @@ public:
 
 	PetscErrorCode
 	rhsJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J);
+
+	/**
+	 * Implicit part of the imex scheme: F = Cdot - f_I(C).
+	 */
+	PetscErrorCode
+	iFunction(TS ts, PetscReal ftime, Vec C, Vec Cdot, Vec F);
+
+	/**
+	 * Jacobian of the implicit part of the imex scheme:
+	 * J = shift * I - df_I/dC.
+	 */
+	PetscErrorCode
+	iJacobian(TS ts, PetscReal ftime, Vec C, Vec Cdot, PetscReal shift,
+		Mat A, Mat J);
+
+	/**
+	 * First transport half step of the Strang splitting, before the reaction
+	 * step.
+	 */
+	PetscErrorCode
+	preStep(TS ts);
+
+	/**
+	 * Redo the first transport half step of the Strang splitting when the
+	 * reaction step was rejected and is retried with another time step.
+	 *
+	 * @param stageTime The time of the stage about to be computed
+	 */
+	PetscErrorCode
+	preStage(TS ts, PetscReal stageTime);
+
+	/**
+	 * Second transport half step of the Strang splitting, and the heat
+	 * equation when it is decoupled, after a successful step and before the
+	 * monitors.
+	 */
+	PetscErrorCode
+	postEvaluate(TS ts);
 };
 // end class PetscSolver
 } /* namespace solver */
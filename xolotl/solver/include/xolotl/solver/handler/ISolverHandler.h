@@ -29,6 +29,22 @@ namespace handler
 template <typename ValueType, typename SeedType>
 class RandomNumberGenerator;
 
+/**
+ * The groups of terms of the right-hand side that a solver handler can be
+ * asked to compute, they are combined as bit flags.
+ */
+enum RHSTerm : unsigned int
+{
+	reactionTerm = 1u << 0,
+	fluxTerm = 1u << 1,
+	diffusionTerm = 1u << 2,
+	advectionTerm = 1u << 3,
+	soretTerm = 1u << 4,
+	temperatureTerm = 1u << 5,
+	allTerms = (1u << 6) - 1u
+};
+// end enum RHSTerm
+
 /**
  * Realizations of this interface are responsible for the actual implementation
  * of each piece of the solver. It is created to handle the multiple dimensions
@@ -99,29 +115,40 @@ public:
 	initGBLocation(DM& da, Vec& C) = 0;
 
 	/**
-	 * This operation get the concentration vector with the ids.
+	 * Update the temperature of the network from the temperature component
+	 * of the solution, after the solution was set from outside.
 	 *
 	 * @param da The PETSc distributed array
 	 * @param C The PETSc solution vector
-	 * @return The concentration vector
 	 */
-	virtual std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-	getConcVector(DM& da, Vec& C) = 0;
+	virtual void
+	updateNetworkTemperature(DM& da, Vec& C) = 0;
+
+	/**
+	 * Choose whether the heat equation is solved separately from the
+	 * clusters. The temperature component then keeps only its diagonal in the
+	 * Jacobian and is advanced by advanceTemperature(). It has to be called
+	 * before initializeSolverContext().
+	 *
+	 * @param decoupled Whether the temperature is decoupled
+	 */
+	virtual void
+	setTemperatureDecoupled(bool decoupled) = 0;
 
 	/**
-	 * This operation sets the concentration vector in the current state of the
-	 * simulation.
+	 * Advance the temperature component of the solution with implicit
+	 * sub-steps, from the temperatures alone, and update the network with
+	 * the new temperatures.
 	 *
 	 * @param da The PETSc distributed array
 	 * @param C The PETSc solution vector
-	 * @param The concentration vector
+	 * @param time The time at the beginning of the interval
+	 * @param deltaTime The length of the interval
+	 * @param nSubSteps The number of sub-steps
 	 */
 	virtual void
-	setConcVector(DM& da, Vec& C,
-		std::vector<
-			std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-			concVector) = 0;
+	advanceTemperature(
+		DM& da, Vec& C, double time, double deltaTime, int nSubSteps) = 0;
 
 	/**
 	 * Get the previous time.
@@ -168,6 +195,23 @@ public:
 	virtual void
 	updateConcentration(TS& ts, Vec& localC, Vec& F, PetscReal ftime) = 0;
 
+	/**
+	 * Select the groups of terms that are included by updateConcentration()
+	 * and computeJacobian(), used when the right-hand side is split.
+	 *
+	 * @param terms The combination of RHSTerm flags
+	 */
+	virtual void
+	setRHSTerms(unsigned int terms) = 0;
+
+	/**
+	 * Get the groups of terms that are currently computed.
+	 *
+	 * @return The combination of RHSTerm flags
+	 */
+	virtual unsigned int
+	getRHSTerms() const = 0;
+
 	/**
 	 * Compute the full Jacobian.
 	 *
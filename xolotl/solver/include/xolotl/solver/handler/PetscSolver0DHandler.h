@@ -14,9 +14,49 @@ namespace handler
  * This class is a subclass of PetscSolverHandler and implement all the methods
  * needed to solve the DR equations in 0D using PETSc from Argonne National
  * Laboratory.
+ *
+ * Several independent 0D cases (ensemble members) that only differ by their
+ * temperature or flux can be solved together. They share the network, their
+ * rates are stored along the grid dimension of the network data, and they
+ * are laid out as the points of a DMDA without stencil so the Jacobian is
+ * block diagonal.
  */
 class PetscSolver0DHandler : public PetscSolverHandler
 {
+private:
+	//! The temperature of each member (empty if given by the handler)
+	std::vector<double> memberTemperatures;
+
+	//! The factor applied to the flux of each member (empty if none)
+	std::vector<double> memberFluxFactors;
+
+	//! The number of ensemble members
+	IdType nMembers;
+
+	//! Work array for the flux of one member
+	Kokkos::View<double*> fluxBuffer;
+
+	/**
+	 * Get the temperature of an ensemble member.
+	 *
+	 * @param member The index of the member
+	 * @param time The current time
+	 * @return The temperature
+	 */
+	double
+	getMemberTemperature(IdType member, double time) const;
+
+	/**
+	 * Get the temperatures of all the ensemble members at once.
+	 *
+	 * @param concs The concentrations, one row per member
+	 * @param time The current time
+	 * @param temps The vector that will contain the temperatures
+	 */
+	void
+	getMemberTemperatures(NetworkType::GridConcentrationsView concs,
+		double time, std::vector<double>& temps);
+
 public:
 	PetscSolver0DHandler() = delete;
 
@@ -27,7 +67,11 @@ public:
 	 */
 	PetscSolver0DHandler(NetworkType& _network,
 		perf::IPerfHandler& _perfHandler, const options::IOptions& options) :
-		PetscSolverHandler(_network, _perfHandler, options)
+		PetscSolverHandler(_network, _perfHandler, options),
+		memberTemperatures(options.getEnsembleTemperatures()),
+		memberFluxFactors(options.getEnsembleFluxFactors()),
+		nMembers(std::max<IdType>(1,
+			std::max(memberTemperatures.size(), memberFluxFactors.size())))
 	{
 	}
 
@@ -64,21 +108,11 @@ public:
 		return;
 	}
 
-	/**
-	 * \see ISolverHandler.h
-	 */
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-	getConcVector(DM& da, Vec& C) override;
-
 	/**
 	 * \see ISolverHandler.h
 	 */
 	void
-	setConcVector(DM& da, Vec& C,
-		std::vector<
-			std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-			concVector) override;
+	updateNetworkTemperature(DM& da, Vec& C) override;
 
 	/**
 	 * \see ISolverHandler.h
@@ -118,7 +152,7 @@ public:
 		std::vector<double>& temperatures, std::vector<double>& depths) override
 	{
 		temperatures = temperature;
-		depths = std::vector<double>(1, 1.0);
+		depths = std::vector<double>(temperature.size(), 1.0);
 	}
 
 	/**
@@ -63,18 +63,15 @@ public:
 	/**
 	 * \see ISolverHandler.h
 	 */
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-	getConcVector(DM& da, Vec& C) override;
+	void
+	updateNetworkTemperature(DM& da, Vec& C) override;
 
 	/**
 	 * \see ISolverHandler.h
 	 */
 	void
-	setConcVector(DM& da, Vec& C,
-		std::vector<
-			std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-			concVector) override;
+	advanceTemperature(DM& da, Vec& C, double time, double deltaTime,
+		int nSubSteps) override;
 
 	/**
 	 * \see ISolverHandler.h
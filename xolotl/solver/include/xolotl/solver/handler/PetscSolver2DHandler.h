@@ -64,21 +64,11 @@ public:
 	void
 	initGBLocation(DM& da, Vec& C) override;
 
-	/**
-	 * \see ISolverHandler.h
-	 */
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-	getConcVector(DM& da, Vec& C) override;
-
 	/**
 	 * \see ISolverHandler.h
 	 */
 	void
-	setConcVector(DM& da, Vec& C,
-		std::vector<
-			std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-			concVector) override;
+	updateNetworkTemperature(DM& da, Vec& C) override;
 
 	/**
 	 * \see ISolverHandler.h
@@ -71,6 +71,25 @@ protected:
 	convertToRowColPairList(std::size_t dof,
 		const core::network::IReactionNetwork::SparseFillMap& fillMap);
 
+	/**
+	 * Get a view with one row per grid point of a DMDA Kokkos array, the
+	 * last dimension being the degrees of freedom.
+	 *
+	 * @param offsetView The DMDA array
+	 * @return The same data, with all the grid dimensions merged
+	 */
+	template <typename TRowsView, typename TOffsetView>
+	static TRowsView
+	getGridRows(const TOffsetView& offsetView)
+	{
+		auto view = offsetView.view();
+		std::size_t nRows = 1;
+		for (std::size_t r = 0; r + 1 < view.rank; ++r) {
+			nRows *= view.extent(r);
+		}
+		return TRowsView(view.data(), nRows, view.extent(view.rank - 1));
+	}
+
 public:
 	/**
 	 * Default constructor, deleted because we need to construct with objects.
@@ -178,6 +178,12 @@ protected:
 	//! The previous time.
 	double previousTime;
 
+	//! The groups of terms to compute in the right-hand side.
+	unsigned int rhsTerms;
+
+	//! If the heat equation is solved separately from the clusters.
+	bool temperatureDecoupled;
+
 	//! The number of xenon atoms that went to the GB
 	double nXeGB;
 
@@ -190,6 +196,18 @@ protected:
 	//! The random number generator to use.
 	std::unique_ptr<util::RandomNumberGenerator<int, unsigned int>> rng;
 
+	/**
+	 * To know if a group of terms is currently computed.
+	 *
+	 * @param term The RHSTerm flag
+	 * @return True if the term should be computed
+	 */
+	bool
+	hasTerm(RHSTerm term) const
+	{
+		return (rhsTerms & term) != 0u;
+	}
+
 	/**
 	 * Method generating the grid in the x direction
 	 *
@@ -480,6 +498,49 @@ public:
 			fluxHandler->computeFluence(time);
 	}
 
+	/**
+	 * \see ISolverHandler.h
+	 */
+	void
+	setTemperatureDecoupled(bool decoupled) override
+	{
+		if (decoupled and dimension != 1) {
+			throw std::runtime_error("\nThe heat equation can only be solved "
+									 "separately from the clusters in 1D.");
+		}
+		temperatureDecoupled = decoupled;
+	}
+
+	/**
+	 * The temperature is only advanced separately in 1D.
+	 *
+	 * \see ISolverHandler.h
+	 */
+	void
+	advanceTemperature(DM& da, Vec& C, double time, double deltaTime,
+		int nSubSteps) override
+	{
+		return;
+	}
+
+	/**
+	 * \see ISolverHandler.h
+	 */
+	void
+	setRHSTerms(unsigned int terms) override
+	{
+		rhsTerms = terms;
+	}
+
+	/**
+	 * \see ISolverHandler.h
+	 */
+	unsigned int
+	getRHSTerms() const override
+	{
+		return rhsTerms;
+	}
+
 	/**
 	 * \see ISolverHandler.h
 	 */
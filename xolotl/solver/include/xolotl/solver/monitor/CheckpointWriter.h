@@ -0,0 +1,122 @@
+#pragma once
+
+#include <mpi.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace xolotl
+{
+namespace solver
+{
+namespace monitor
+{
+/**
+ * This class runs the checkpoint writes. In asynchronous mode the writes are
+ * done by a background thread on a duplicate of the Xolotl communicator so
+ * the solver can continue while the previous snapshot is written. At most
+ * nBuffers snapshots are kept at the same time, the solver waits when the
+ * writes fall behind.
+ *
+ * The asynchronous mode requires MPI_THREAD_MULTIPLE and a thread-safe HDF5
+ * library, the writes are done in the calling thread otherwise. Xolotl only
+ * asks MPI for MPI_THREAD_MULTIPLE when -async_checkpoint is given.
+ */
+class CheckpointWriter
+{
+public:
+	//! A write, it receives the communicator to use
+	using Task = std::function<void(MPI_Comm)>;
+
+	CheckpointWriter() = delete;
+
+	/**
+	 * The constructor.
+	 *
+	 * @param async Whether the asynchronous mode is requested
+	 * @param nBuffers The number of snapshots that can be in flight
+	 */
+	CheckpointWriter(bool async, std::size_t nBuffers = 2);
+
+	/**
+	 * The destructor waits for the pending writes.
+	 */
+	~CheckpointWriter();
+
+	/**
+	 * Whether the writes are done in the background.
+	 */
+	bool
+	isAsync() const
+	{
+		return _async;
+	}
+
+	/**
+	 * The communicator to use for the checkpoint file.
+	 */
+	MPI_Comm
+	getComm() const
+	{
+		return _comm;
+	}
+
+	/**
+	 * Block until a snapshot can be taken.
+	 */
+	void
+	waitForSlot();
+
+	/**
+	 * Queue a write, or do it right away in synchronous mode.
+	 *
+	 * @param task The write
+	 */
+	void
+	submit(Task task);
+
+	/**
+	 * Block until all the queued writes are done.
+	 */
+	void
+	wait();
+
+private:
+	/**
+	 * The loop of the background thread.
+	 */
+	void
+	run();
+
+	/**
+	 * Throw the error of a failed background write, if any.
+	 */
+	void
+	rethrow();
+
+	//! Whether the writes are done in the background
+	bool _async;
+
+	//! The maximum number of snapshots in flight
+	std::size_t _capacity;
+
+	//! The communicator used by the writes
+	MPI_Comm _comm;
+
+	//! The background thread and its synchronization
+	std::thread _thread;
+	std::mutex _mutex;
+	std::condition_variable _condition;
+	std::deque<Task> _tasks;
+	std::size_t _pending;
+	bool _stop;
+	std::exception_ptr _error;
+};
+// end class CheckpointWriter
+} /* namespace monitor */
+} /* namespace solver */
+} /* namespace xolotl */
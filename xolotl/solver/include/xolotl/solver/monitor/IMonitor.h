@@ -30,6 +30,19 @@ public:
 
 	virtual void
 	setExternalControlStep(std::size_t step) = 0;
+
+	/**
+	 * Wait until all the checkpoint writes are done.
+	 */
+	virtual void
+	waitForCheckpoints() = 0;
+
+	/**
+	 * Wait until all the checkpoint writes are done and close the
+	 * checkpoint file.
+	 */
+	virtual void
+	closeCheckpoint() = 0;
 };
 } // namespace monitor
 } // namespace solver
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <petscts.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <xolotl/perf/IPerfHandler.h>
+#include <xolotl/perf/ITimer.h>
+
+namespace xolotl
+{
+namespace solver
+{
+namespace monitor
+{
+/**
+ * This class registers the diagnostic monitors with PETSc and decides at
+ * each time step whether they should run. Each monitor has its own cadence
+ * read from the PETSc options, using the name of the option enabling it:
+ *     -<name>_every_steps N : run every N time steps
+ *     -<name>_every_time T : run when T seconds of simulated time went by
+ *     -<name>_every_wall W : run when W seconds of wall time went by
+ * The monitor runs as soon as one of the given criteria is met, and at every
+ * time step when none is given. It always runs at the first and last time
+ * steps. The time spent in each monitor is recorded
+ * with the "monitor:<name>" timer.
+ *
+ * The wall time decision is taken by the first process so that all of them
+ * run the same monitors.
+ */
+class MonitorScheduler
+{
+public:
+	//! The signature of a PETSc monitor
+	using MonitorFunction =
+		PetscErrorCode (*)(TS, PetscInt, PetscReal, Vec, void*);
+
+	MonitorScheduler() = delete;
+
+	/**
+	 * The constructor.
+	 *
+	 * @param perfHandler The perf handler to use for timers
+	 */
+	MonitorScheduler(std::shared_ptr<perf::IPerfHandler> perfHandler);
+
+	/**
+	 * Register a monitor with the time stepper. The monitors are called in
+	 * the same order as with TSMonitorSet.
+	 *
+	 * @param ts The time stepper
+	 * @param name The name of the monitor, used for its options and timer
+	 * @param monitor The monitor
+	 * @param ctx The context given to the monitor
+	 */
+	PetscErrorCode
+	add(TS ts, const std::string& name, MonitorFunction monitor, void* ctx);
+
+	/**
+	 * The time of the previous run of the monitor being called, used by the
+	 * monitors that integrate over time between two runs.
+	 *
+	 * @param defaultTime The time returned when it did not run yet
+	 */
+	PetscReal
+	getPreviousRunTime(PetscReal defaultTime) const;
+
+private:
+	//! A registered monitor and its cadence
+	struct Entry
+	{
+		MonitorScheduler* scheduler;
+		std::string name;
+		MonitorFunction monitor;
+		void* ctx;
+		PetscInt everySteps;
+		PetscReal everyTime;
+		PetscReal everyWall;
+		std::shared_ptr<perf::ITimer> timer;
+		bool hasRun;
+		PetscReal previousTime;
+		std::chrono::steady_clock::time_point previousWall;
+	};
+
+	/**
+	 * The function registered with PETSc for every entry.
+	 */
+	static PetscErrorCode
+	runEntry(
+		TS ts, PetscInt timestep, PetscReal time, Vec solution, void* ictx);
+
+	/**
+	 * Whether the entry is due at this time step.
+	 *
+	 * @param lastStep Whether the time stepper is done
+	 */
+	bool
+	isDue(const Entry& entry, PetscInt timestep, PetscReal time,
+		bool lastStep) const;
+
+	//! The perf handler
+	std::shared_ptr<perf::IPerfHandler> _perfHandler;
+
+	//! The registered monitors, PETSc keeps pointers to them
+	std::vector<std::unique_ptr<Entry>> _entries;
+
+	//! The monitor being called
+	const Entry* _current;
+};
+// end class MonitorScheduler
+} /* namespace monitor */
+} /* namespace solver */
+} /* namespace xolotl */
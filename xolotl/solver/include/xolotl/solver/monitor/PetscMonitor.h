@@ -2,9 +2,13 @@
 
 #include <memory>
 
+#include <Kokkos_Core.hpp>
+
 #include <xolotl/perf/ITimer.h>
 #include <xolotl/solver/handler/ISolverHandler.h>
+#include <xolotl/solver/monitor/CheckpointWriter.h>
 #include <xolotl/solver/monitor/IPetscMonitor.h>
+#include <xolotl/solver/monitor/MonitorScheduler.h>
 #include <xolotl/viz/IPlot.h>
 
 namespace xolotl
@@ -31,6 +35,12 @@ public:
 	PetscErrorCode
 	startStop(TS ts, PetscInt timestep, PetscReal time, Vec solution) override;
 
+	void
+	waitForCheckpoints() override;
+
+	void
+	closeCheckpoint() override;
+
 	PetscErrorCode
 	monitorTime(
 		TS ts, PetscInt timestep, PetscReal time, Vec solution) override;
@@ -77,10 +87,82 @@ protected:
 	bool
 	checkForCreatingCheckpoint() const;
 
+	/**
+	 * Copy the local part of the solution to host memory that can be read
+	 * by the checkpoint writer.
+	 */
+	PetscErrorCode
+	stageSolution(
+		Vec solution, std::shared_ptr<const std::vector<double>>& staged);
+
+	/**
+	 * The time of the previous run of the monitor being called, or of the
+	 * previous time step if it did not run yet. The monitors integrating
+	 * quantities over time use it instead of the previous time step because
+	 * they may not run at every time step.
+	 */
+	double
+	getMonitorPreviousTime() const;
+
+	/**
+	 * Get the largest value of one component of the local solution. The
+	 * reduction runs on the Kokkos view of the vector, in device memory.
+	 *
+	 * @param solution The global solution vector
+	 * @param component The component (cluster id)
+	 * @param maxValue The result
+	 */
+	PetscErrorCode
+	getLocalMaxComponent(Vec solution, IdType component, double& maxValue);
+
+	/**
+	 * Move the values of the first nComponents components that are closer
+	 * to zero than the threshold to +/- threshold, in device memory.
+	 *
+	 * @param solution The global solution vector
+	 * @param nComponents The number of components to check
+	 * @param threshold The threshold
+	 */
+	PetscErrorCode
+	clampNearZero(Vec solution, IdType nComponents, double threshold);
+
+	/**
+	 * Compute the weighted sum of the local grid points of the solution in
+	 * device memory. The weights are given in the local grid point order,
+	 * x being the fastest direction.
+	 *
+	 * @param solution The global solution vector
+	 * @param weights The weight of each local grid point
+	 * @param sums The result, one value per component
+	 */
+	PetscErrorCode
+	sumLocalGridPoints(Vec solution, const std::vector<double>& weights,
+		Kokkos::View<double*>& sums);
+
+	/**
+	 * Copy the values of one local grid point of the solution to the host.
+	 *
+	 * @param solution The global solution vector
+	 * @param localPoint The local grid point index, x being the fastest
+	 * @param values The result
+	 */
+	PetscErrorCode
+	copyGridPointToHost(
+		Vec solution, IdType localPoint, std::vector<double>& values);
+
+	//! The part of a checkpoint write that depends on the dimension
+	using CheckpointTask = std::function<void(
+		io::XFile&, io::XFile::TimestepGroup&, MPI_Comm)>;
+
+	/**
+	 * Take a snapshot of the solution and of the monitor data. It runs on the
+	 * solver thread while the returned task may run on the writer thread, so
+	 * the task must only use what it captured by value.
+	 */
 	virtual PetscErrorCode
 	startStopImpl(TS ts, PetscInt timestep, PetscReal time, Vec solution,
-		io::XFile& checkpointFile, io::XFile::TimestepGroup* tsGroup,
-		const std::vector<std::string>& speciesNames) = 0;
+		const std::vector<std::string>& speciesNames,
+		CheckpointTask& task) = 0;
 
 protected:
 	TS _ts;
@@ -89,6 +171,31 @@ protected:
 
 	std::shared_ptr<perf::ITimer> _startStopTimer;
 
+	std::unique_ptr<CheckpointWriter> _checkpointWriter;
+
+	//! Runs the diagnostic monitors with their cadence
+	std::unique_ptr<MonitorScheduler> _monitorScheduler;
+
+	//! Whether the concentrations are written in the dense layout, and the
+	//! compression level to use then
+	bool _denseCheckpoint{false};
+	PetscInt _checkpointDeflate{0};
+
+	//! The number of recent time steps kept in the checkpoint file (0 keeps
+	//! all of them), and the stride count between time steps always kept
+	PetscInt _checkpointKeepLast{0};
+	PetscInt _checkpointKeepEvery{0};
+
+	//! The checkpoint file, only used by the writes: it is opened by the
+	//! first one and stays open until closeCheckpoint()
+	struct CheckpointFile
+	{
+		std::unique_ptr<io::XFile> file;
+		std::unique_ptr<io::XFile::ConcentrationGroup> concGroup;
+	};
+	std::shared_ptr<CheckpointFile> _checkpointFile{
+		std::make_shared<CheckpointFile>()};
+
 	std::shared_ptr<viz::IPlot> _perfPlot;
 
 	std::vector<IdType> _iClusterIds;
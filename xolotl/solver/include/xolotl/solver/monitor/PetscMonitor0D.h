@@ -38,8 +38,8 @@ public:
 
 	PetscErrorCode
 	startStopImpl(TS ts, PetscInt timestep, PetscReal time, Vec solution,
-		io::XFile& checkpointFile, io::XFile::TimestepGroup* tsGroup,
-		const std::vector<std::string>& speciesNames) override;
+		const std::vector<std::string>& speciesNames,
+		CheckpointTask& task) override;
 
 	PetscErrorCode
 	computeXenonRetention(
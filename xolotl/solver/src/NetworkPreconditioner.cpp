@@ -0,0 +1,302 @@
+// Includes
+#include <algorithm>
+#include <set>
+
+#include <Kokkos_Core.hpp>
+
+#include <xolotl/solver/NetworkPreconditioner.h>
+#include <xolotl/util/Log.h>
+#include <xolotl/util/MPIUtils.h>
+
+namespace xolotl
+{
+namespace solver
+{
+using HostRange = Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>;
+
+/*
+ Shell callbacks, they only forward to the context
+ */
+PetscErrorCode
+NetworkPCSetUp(PC pc)
+{
+	PetscFunctionBeginUser;
+	NetworkPreconditioner* ctx = nullptr;
+	PetscCall(PCShellGetContext(pc, &ctx));
+	PetscCall(ctx->setUp(pc));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+NetworkPCApply(PC pc, Vec x, Vec y)
+{
+	PetscFunctionBeginUser;
+	NetworkPreconditioner* ctx = nullptr;
+	PetscCall(PCShellGetContext(pc, &ctx));
+	PetscCall(ctx->apply(pc, x, y));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+NetworkPCDestroy(PC pc)
+{
+	PetscFunctionBeginUser;
+	NetworkPreconditioner* ctx = nullptr;
+	PetscCall(PCShellGetContext(pc, &ctx));
+	PetscCall(ctx->destroy());
+	PetscFunctionReturn(0);
+}
+
+NetworkPreconditioner::NetworkPreconditioner(
+	core::network::IReactionNetwork& network, perf::IPerfHandler& perfHandler,
+	PetscInt outerIterations) :
+	_blockSize(network.getDOF() + 1),
+	_outerIterations(std::max(outerIterations, (PetscInt)1)),
+	_nBlocks(0),
+	_residual(nullptr),
+	_setUpTimer(perfHandler.getTimer("networkPCSetUpTimer")),
+	_applyTimer(perfHandler.getTimer("networkPCApplyTimer"))
+{
+	// The symbolic factorization only depends on the connectivity
+	SparseFillMap fillMap;
+	network.getDiagonalFill(fillMap);
+	symbolicFactorization(fillMap);
+
+	if (util::getMPIRank() == 0) {
+		XOLOTL_LOG << "NetworkPreconditioner: block size " << _blockSize
+				   << ", " << _cols.size()
+				   << " entries in the LU factors, and " << _updates.size()
+				   << " elimination updates per grid point, with "
+				   << _outerIterations << " outer iteration(s).";
+	}
+}
+
+PetscErrorCode
+NetworkPreconditioner::attach(PC pc)
+{
+	PetscFunctionBeginUser;
+	PetscCall(PCSetType(pc, PCSHELL));
+	PetscCall(PCShellSetContext(pc, this));
+	PetscCall(PCShellSetSetUp(pc, NetworkPCSetUp));
+	PetscCall(PCShellSetApply(pc, NetworkPCApply));
+	PetscCall(PCShellSetDestroy(pc, NetworkPCDestroy));
+	PetscCall(PCShellSetName(pc, "Xolotl network block-Jacobi"));
+	PetscFunctionReturn(0);
+}
+
+void
+NetworkPreconditioner::symbolicFactorization(const SparseFillMap& fillMap)
+{
+	const auto n = _blockSize;
+
+	// Compute the pattern of each row of the factors, the row k of U is
+	// merged in the row i for each k < i in the pattern of row i
+	std::vector<std::vector<PetscInt>> rows(n);
+	for (PetscInt i = 0; i < n; ++i) {
+		std::set<PetscInt> pattern;
+		pattern.insert(i);
+		if (auto it = fillMap.find(i); it != fillMap.end()) {
+			pattern.insert(it->second.begin(), it->second.end());
+		}
+		// The diagonal is always present so the loop stops on it
+		for (auto it = pattern.begin(); *it < i; ++it) {
+			auto& rowK = rows[*it];
+			auto upper = std::upper_bound(rowK.begin(), rowK.end(), *it);
+			pattern.insert(upper, rowK.end());
+		}
+		rows[i].assign(pattern.begin(), pattern.end());
+	}
+
+	// Convert to CSR
+	_rowStart.assign(n + 1, 0);
+	_diagPos.assign(n, 0);
+	_cols.clear();
+	for (PetscInt i = 0; i < n; ++i) {
+		_rowStart[i] = _cols.size();
+		auto diag = std::lower_bound(rows[i].begin(), rows[i].end(), i);
+		_diagPos[i] = _rowStart[i] + (diag - rows[i].begin());
+		_cols.insert(_cols.end(), rows[i].begin(), rows[i].end());
+	}
+	_rowStart[n] = _cols.size();
+
+	// List the updates associated with each strictly lower entry
+	_updateStart.assign(_cols.size() + 1, 0);
+	_updates.clear();
+	for (PetscInt i = 0; i < n; ++i) {
+		for (auto e = _rowStart[i]; e < _rowStart[i + 1]; ++e) {
+			_updateStart[e] = _updates.size();
+			if (e >= _diagPos[i]) {
+				continue;
+			}
+			auto k = _cols[e];
+			for (auto u = _diagPos[k] + 1; u < _rowStart[k + 1]; ++u) {
+				_updates.push_back({findPosition(i, _cols[u]), u});
+			}
+		}
+	}
+	_updateStart[_cols.size()] = _updates.size();
+}
+
+PetscInt
+NetworkPreconditioner::findPosition(PetscInt row, PetscInt col) const
+{
+	auto first = _cols.begin() + _rowStart[row];
+	auto last = _cols.begin() + _rowStart[row + 1];
+	auto it = std::lower_bound(first, last, col);
+	if (it == last || *it != col) {
+		return -1;
+	}
+	return it - _cols.begin();
+}
+
+void
+NetworkPreconditioner::factorBlock(double* lu) const
+{
+	for (PetscInt i = 0; i < _blockSize; ++i) {
+		for (auto e = _rowStart[i]; e < _diagPos[i]; ++e) {
+			lu[e] /= lu[_diagPos[_cols[e]]];
+			const auto l = lu[e];
+			for (auto u = _updateStart[e]; u < _updateStart[e + 1]; ++u) {
+				lu[_updates[u][0]] -= l * lu[_updates[u][1]];
+			}
+		}
+		// Protect against empty rows
+		if (lu[_diagPos[i]] == 0.0) {
+			lu[_diagPos[i]] = 1.0;
+		}
+	}
+}
+
+void
+NetworkPreconditioner::solveBlock(const double* lu, double* x) const
+{
+	// Forward substitution (unit lower triangle)
+	for (PetscInt i = 0; i < _blockSize; ++i) {
+		for (auto e = _rowStart[i]; e < _diagPos[i]; ++e) {
+			x[i] -= lu[e] * x[_cols[e]];
+		}
+	}
+	// Backward substitution
+	for (PetscInt i = _blockSize - 1; i >= 0; --i) {
+		for (auto e = _diagPos[i] + 1; e < _rowStart[i + 1]; ++e) {
+			x[i] -= lu[e] * x[_cols[e]];
+		}
+		x[i] /= lu[_diagPos[i]];
+	}
+}
+
+PetscErrorCode
+NetworkPreconditioner::setUp(PC pc)
+{
+	PetscFunctionBeginUser;
+
+	_setUpTimer->start();
+
+	Mat Amat, Pmat;
+	PetscCall(PCGetOperators(pc, &Amat, &Pmat));
+
+	// The DMDA ordering keeps all the DOF of a grid point contiguous
+	PetscInt rStart, rEnd;
+	PetscCall(MatGetOwnershipRange(Pmat, &rStart, &rEnd));
+	_nBlocks = (rEnd - rStart) / _blockSize;
+	const PetscInt nnz = _cols.size();
+	_factors.assign(_nBlocks * nnz, 0.0);
+
+	// Scatter the diagonal block values in the factor storage, entries that
+	// are not in the network pattern are dropped
+	for (PetscInt b = 0; b < _nBlocks; ++b) {
+		auto lu = _factors.data() + b * nnz;
+		auto blockStart = rStart + b * _blockSize;
+		for (PetscInt r = 0; r < _blockSize; ++r) {
+			PetscInt nCols;
+			const PetscInt* cols;
+			const PetscScalar* values;
+			PetscCall(MatGetRow(Pmat, blockStart + r, &nCols, &cols, &values));
+			for (PetscInt n = 0; n < nCols; ++n) {
+				auto c = cols[n] - blockStart;
+				if (c < 0 || c >= _blockSize) {
+					continue;
+				}
+				auto pos = findPosition(r, c);
+				if (pos >= 0) {
+					lu[pos] += values[n];
+				}
+			}
+			PetscCall(
+				MatRestoreRow(Pmat, blockStart + r, &nCols, &cols, &values));
+		}
+	}
+
+	// Numeric factorization, independent for each grid point
+	auto factors = _factors.data();
+	Kokkos::parallel_for(
+		"NetworkPreconditioner::setUp", HostRange(0, _nBlocks),
+		[=](PetscInt b) { factorBlock(factors + b * nnz); });
+
+	if (_outerIterations > 1 && !_residual) {
+		PetscCall(MatCreateVecs(Pmat, &_residual, NULL));
+	}
+
+	_setUpTimer->stop();
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+NetworkPreconditioner::apply(PC pc, Vec x, Vec y)
+{
+	PetscFunctionBeginUser;
+
+	_applyTimer->start();
+
+	const PetscInt nnz = _cols.size();
+	auto factors = _factors.data();
+	auto blockSolve = [&](Vec in, Vec out) {
+		PetscFunctionBeginUser;
+		if (in != out) {
+			PetscCall(VecCopy(in, out));
+		}
+		PetscScalar* array;
+		PetscCall(VecGetArray(out, &array));
+		Kokkos::parallel_for(
+			"NetworkPreconditioner::apply", HostRange(0, _nBlocks),
+			[=](PetscInt b) {
+				solveBlock(factors + b * nnz, array + b * _blockSize);
+			});
+		PetscCall(VecRestoreArray(out, &array));
+		PetscFunctionReturn(0);
+	};
+
+	// First block-Jacobi sweep
+	PetscCall(blockSolve(x, y));
+
+	// Outer Richardson iterations to account for the coupling between grid
+	// points: y <- y + M^-1 (x - P y)
+	if (_outerIterations > 1) {
+		Mat Amat, Pmat;
+		PetscCall(PCGetOperators(pc, &Amat, &Pmat));
+		for (PetscInt it = 1; it < _outerIterations; ++it) {
+			PetscCall(MatMult(Pmat, y, _residual));
+			PetscCall(VecAYPX(_residual, -1.0, x));
+			PetscCall(blockSolve(_residual, _residual));
+			PetscCall(VecAXPY(y, 1.0, _residual));
+		}
+	}
+
+	_applyTimer->stop();
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+NetworkPreconditioner::destroy()
+{
+	PetscFunctionBeginUser;
+	if (_residual) {
+		PetscCall(VecDestroy(&_residual));
+	}
+	_factors.clear();
+	PetscFunctionReturn(0);
+}
+} /* end namespace solver */
+} /* end namespace xolotl */
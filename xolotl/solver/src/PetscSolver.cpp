@@ -1,9 +1,12 @@
 // Includes
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
 #include <iostream>
 
 #include <xolotl/io/XFile.h>
+#include <xolotl/solver/NetworkPreconditioner.h>
 #include <xolotl/solver/PetscSolver.h>
 #include <xolotl/solver/handler/PetscSolver0DHandler.h>
 #include <xolotl/solver/handler/PetscSolver1DHandler.h>
@@ -36,7 +39,56 @@ namespace detail
 auto petscSolverRegistrations =
 	xolotl::factory::solver::SolverFactory::RegistrationCollection<PetscSolver>(
 		{"PETSc"});
+
+/**
+ * Call f(solutionIndex, bufferIndex) for each value of the local solution
+ * stored in a buffer with the given layout.
+ *
+ * @param layout The layout of the buffer
+ * @param blockSize The number of values per grid point in the solution
+ * @param localSize The number of local grid points in each direction
+ * @param f The function to call
+ */
+template <typename F>
+void
+forEachBufferValue(const BufferLayout& layout, IdType blockSize,
+	const std::array<IdType, 3>& localSize, F&& f)
+{
+	const IdType nIds = layout.ids.empty() ? blockSize : layout.ids.size();
+	for (auto id : layout.ids) {
+		if (id >= blockSize) {
+			throw std::runtime_error(
+				"PetscSolver Exception: The buffer layout refers to the "
+				"component " +
+				std::to_string(id) + " but there are only " +
+				std::to_string(blockSize) + ".");
+		}
+	}
+
+	// The packed directions follow the previous one
+	auto strides = layout.pointStrides;
+	IdType packed = (layout.componentStride == 1) ? nIds : 1;
+	for (auto d = 0; d < 3; ++d) {
+		if (strides[d] == 0) {
+			strides[d] = packed;
+		}
+		packed = strides[d] * localSize[d];
+	}
+
+	IdType point = 0;
+	for (IdType k = 0; k < localSize[2]; ++k)
+		for (IdType j = 0; j < localSize[1]; ++j)
+			for (IdType i = 0; i < localSize[0]; ++i, ++point) {
+				auto pointOffset =
+					i * strides[0] + j * strides[1] + k * strides[2];
+				for (IdType n = 0; n < nIds; ++n) {
+					auto id = layout.ids.empty() ? n : layout.ids[n];
+					f(point * blockSize + id,
+						pointOffset + n * layout.componentStride);
+				}
+			}
 }
+} // namespace detail
 
 PetscErrorCode
 overridePetscVFPrintf(FILE* fd, const char format[], va_list Argp)
@@ -113,6 +165,62 @@ RHSJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J, void* ctx)
 	PetscFunctionReturn(0);
 }
 
+/*
+ Implicit part of the right-hand side when the imex scheme is used
+ */
+PetscErrorCode
+IFunction(TS ts, PetscReal ftime, Vec C, Vec Cdot, Vec F, void* ctx)
+{
+	PetscFunctionBeginUser;
+	PetscCall(
+		static_cast<PetscSolver*>(ctx)->iFunction(ts, ftime, C, Cdot, F));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+IJacobian(TS ts, PetscReal ftime, Vec C, Vec Cdot, PetscReal shift, Mat A,
+	Mat J, void* ctx)
+{
+	PetscFunctionBeginUser;
+	auto solver = static_cast<PetscSolver*>(ctx);
+	PetscCall(solver->iJacobian(ts, ftime, C, Cdot, shift, A, J));
+	PetscFunctionReturn(0);
+}
+
+/*
+ Transport half steps around the reaction step for the Strang splitting, the
+ decoupled heat equation is also advanced after the step
+ */
+PetscErrorCode
+SplittingPreStep(TS ts)
+{
+	PetscFunctionBeginUser;
+	PetscSolver* solver = nullptr;
+	PetscCall(TSGetApplicationContext(ts, &solver));
+	PetscCall(solver->preStep(ts));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+SplittingPreStage(TS ts, PetscReal stageTime)
+{
+	PetscFunctionBeginUser;
+	PetscSolver* solver = nullptr;
+	PetscCall(TSGetApplicationContext(ts, &solver));
+	PetscCall(solver->preStage(ts, stageTime));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PostEvaluate(TS ts)
+{
+	PetscFunctionBeginUser;
+	PetscSolver* solver = nullptr;
+	PetscCall(TSGetApplicationContext(ts, &solver));
+	PetscCall(solver->postEvaluate(ts));
+	PetscFunctionReturn(0);
+}
+
 PetscSolver::PetscSolver(const options::IOptions& options) :
 	Solver(options,
 		[&options](core::network::IReactionNetwork& network,
@@ -139,10 +247,13 @@ PetscSolver::PetscSolver(const options::IOptions& options) :
 		})
 {
 	this->setCommandLineOptions(options.getPetscArg());
+	timeIntegration = options.getTimeIntegrationName();
 
 	rhsFunctionTimer = perfHandler->getTimer("rhsFunctionTimer");
 	rhsJacobianTimer = perfHandler->getTimer("rhsJacobianTimer");
 	solveTimer = perfHandler->getTimer("solveTimer");
+	transportTimer = perfHandler->getTimer("transportTimer");
+	heatTimer = perfHandler->getTimer("heatTimer");
 }
 
 PetscSolver::PetscSolver(
@@ -152,6 +263,8 @@ PetscSolver::PetscSolver(
 	rhsFunctionTimer = perfHandler->getTimer("rhsFunctionTimer");
 	rhsJacobianTimer = perfHandler->getTimer("rhsJacobianTimer");
 	solveTimer = perfHandler->getTimer("solveTimer");
+	transportTimer = perfHandler->getTimer("transportTimer");
+	heatTimer = perfHandler->getTimer("heatTimer");
 }
 
 PetscSolver::~PetscSolver()
@@ -207,6 +320,12 @@ PetscSolver::initialize(int loop, double time, DM oldDA, Vec oldC)
 	Mat J;
 	PetscCallVoid(DMSetMatrixPreallocateSkip(da, PETSC_TRUE));
 	PetscCallVoid(DMCreateMatrix(da, &J));
+	// Check the option -heat_decoupled, it changes the Jacobian structure
+	PetscCallVoid(
+		PetscOptionsHasName(NULL, NULL, "-heat_decoupled", &heatDecoupled));
+	PetscCallVoid(
+		PetscOptionsGetInt(NULL, NULL, "-heat_substeps", &heatSubSteps, NULL));
+	this->solverHandler->setTemperatureDecoupled(heatDecoupled);
 	this->solverHandler->initializeSolverContext(da, J);
 
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -216,11 +335,32 @@ PetscSolver::initialize(int loop, double time, DM oldDA, Vec oldC)
 	auto xolotlComm = util::getMPIComm();
 	PetscCallVoid(TSCreate(xolotlComm, &ts));
 	PetscCallVoid(TSSetType(ts, TSARKIMEX));
-	PetscCallVoid(TSARKIMEXSetFullyImplicit(ts, PETSC_TRUE));
 	PetscCallVoid(TSSetDM(ts, da));
 	PetscCallVoid(TSSetProblemType(ts, TS_NONLINEAR));
-	PetscCallVoid(TSSetRHSFunction(ts, nullptr, RHSFunction, this));
-	PetscCallVoid(TSSetRHSJacobian(ts, J, J, RHSJacobian, this));
+	if (timeIntegration == "imex") {
+		// The incident flux is always explicit, advection and Soret can be
+		// moved to the explicit part when they are slow
+		explicitTerms = handler::fluxTerm;
+		PetscBool flagExplicit;
+		PetscCallVoid(PetscOptionsHasName(
+			NULL, NULL, "-imex_explicit_advection", &flagExplicit));
+		if (flagExplicit)
+			explicitTerms |= handler::advectionTerm;
+		PetscCallVoid(PetscOptionsHasName(
+			NULL, NULL, "-imex_explicit_soret", &flagExplicit));
+		if (flagExplicit)
+			explicitTerms |= handler::soretTerm;
+
+		PetscCallVoid(TSARKIMEXSetFullyImplicit(ts, PETSC_FALSE));
+		PetscCallVoid(TSSetIFunction(ts, nullptr, IFunction, this));
+		PetscCallVoid(TSSetIJacobian(ts, J, J, IJacobian, this));
+		PetscCallVoid(TSSetRHSFunction(ts, nullptr, RHSFunction, this));
+	}
+	else {
+		PetscCallVoid(TSARKIMEXSetFullyImplicit(ts, PETSC_TRUE));
+		PetscCallVoid(TSSetRHSFunction(ts, nullptr, RHSFunction, this));
+		PetscCallVoid(TSSetRHSJacobian(ts, J, J, RHSJacobian, this));
+	}
 	PetscCallVoid(TSSetSolution(ts, C));
 
 	// Read the times if the information is in the HDF5 file
@@ -244,6 +384,44 @@ PetscSolver::initialize(int loop, double time, DM oldDA, Vec oldC)
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 	PetscCallVoid(TSSetFromOptions(ts));
 
+	// Check the option -network_pc
+	PetscBool flagNetworkPC;
+	PetscCallVoid(
+		PetscOptionsHasName(NULL, NULL, "-network_pc", &flagNetworkPC));
+	bool splitting = (timeIntegration == "strang");
+	if (flagNetworkPC || splitting) {
+		// Replace the preconditioner by the network block-Jacobi one, the
+		// symbolic factorization is kept across loops. With the splitting the
+		// main Jacobian only holds reactions and the block solve is exact.
+		if (not networkPC) {
+			PetscInt outerIts = 1;
+			PetscCallVoid(PetscOptionsGetInt(
+				NULL, NULL, "-network_pc_outer_its", &outerIts, NULL));
+			networkPC = std::make_unique<NetworkPreconditioner>(
+				this->solverHandler->getNetwork(), *perfHandler, outerIts);
+		}
+		SNES snes;
+		KSP ksp;
+		PC pc;
+		PetscCallVoid(TSGetSNES(ts, &snes));
+		PetscCallVoid(SNESGetKSP(snes, &ksp));
+		PetscCallVoid(KSPGetPC(ksp, &pc));
+		PetscCallVoid(networkPC->attach(pc));
+	}
+
+	// The transport is integrated by a second time stepper in half steps
+	// around each reaction step
+	if (splitting) {
+		createTransportTS(J);
+		PetscCallVoid(TSSetPreStep(ts, SplittingPreStep));
+		PetscCallVoid(TSSetPreStage(ts, SplittingPreStage));
+	}
+	// The decoupled heat equation is lagged by one step
+	if (splitting || heatDecoupled) {
+		PetscCallVoid(TSSetApplicationContext(ts, this));
+		PetscCallVoid(TSSetPostEvaluate(ts, PostEvaluate));
+	}
+
 	// Switch on the number of dimensions to set the monitors
 	auto dim = this->solverHandler->getDimension();
 	switch (dim) {
@@ -308,14 +486,140 @@ PetscSolver::setTimes(double finalTime, double dt)
 std::vector<std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
 PetscSolver::getConcVector()
 {
-	return this->solverHandler->getConcVector(da, C);
+	PetscInt xm, ym, zm, blockSize;
+	PetscCallContinue(DMDAGetCorners(da, NULL, NULL, NULL, &xm, &ym, &zm));
+	PetscCallContinue(VecGetBlockSize(C, &blockSize));
+
+	// Read the dense local concentrations
+	std::vector<double> concs;
+	getConcentrations(blockSize, concs);
+
+	// Only keep the non-zero values, except in 0D where each member keeps
+	// all of them
+	bool keepAll = this->solverHandler->getDimension() == 0;
+	std::vector<
+		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
+		toReturn(zm,
+			std::vector<std::vector<std::vector<std::pair<IdType, double>>>>(
+				ym, std::vector<std::vector<std::pair<IdType, double>>>(xm)));
+	const double* value = concs.data();
+	for (auto k = 0; k < zm; ++k)
+		for (auto j = 0; j < ym; ++j)
+			for (auto i = 0; i < xm; ++i) {
+				auto& point = toReturn[k][j][i];
+				for (auto l = 0; l < blockSize; ++l, ++value) {
+					if (keepAll || std::fabs(*value) > 1.0e-16) {
+						point.push_back(std::make_pair(l, *value));
+					}
+				}
+			}
+
+	return toReturn;
+}
+
+void
+PetscSolver::getConcentrations(const BufferLayout& layout, double* buffer)
+{
+	PetscInt xm, ym, zm, blockSize;
+	PetscCallVoid(DMDAGetCorners(da, NULL, NULL, NULL, &xm, &ym, &zm));
+	PetscCallVoid(VecGetBlockSize(C, &blockSize));
+
+	const PetscScalar* array;
+	PetscCallVoid(VecGetArrayRead(C, &array));
+	detail::forEachBufferValue(layout, blockSize,
+		{static_cast<IdType>(xm), static_cast<IdType>(ym),
+			static_cast<IdType>(zm)},
+		[&](IdType solutionIndex, IdType bufferIndex) {
+			buffer[bufferIndex] = array[solutionIndex];
+		});
+	PetscCallVoid(VecRestoreArrayRead(C, &array));
+}
+
+void
+PetscSolver::setConcentrations(const BufferLayout& layout, const double* buffer)
+{
+	PetscInt xm, ym, zm, blockSize;
+	PetscCallVoid(DMDAGetCorners(da, NULL, NULL, NULL, &xm, &ym, &zm));
+	PetscCallVoid(VecGetBlockSize(C, &blockSize));
+
+	PetscScalar* array;
+	PetscCallVoid(VecGetArray(C, &array));
+	detail::forEachBufferValue(layout, blockSize,
+		{static_cast<IdType>(xm), static_cast<IdType>(ym),
+			static_cast<IdType>(zm)},
+		[&](IdType solutionIndex, IdType bufferIndex) {
+			array[solutionIndex] = buffer[bufferIndex];
+		});
+	PetscCallVoid(VecRestoreArray(C, &array));
+
+	// The temperature may have changed
+	this->solverHandler->updateNetworkTemperature(da, C);
+}
+
+IdType
+PetscSolver::getConcentrations(IdType nComponents, std::vector<double>& concs)
+{
+	// The local part of the solution is contiguous, one block of DOF values
+	// per grid point
+	PetscInt blockSize, localSize;
+	PetscCallContinue(VecGetBlockSize(C, &blockSize));
+	PetscCallContinue(VecGetLocalSize(C, &localSize));
+	assert(nComponents <= blockSize);
+	const IdType nPoints = localSize / blockSize;
+	if (concs.size() < nPoints * nComponents) {
+		concs.resize(nPoints * nComponents);
+	}
+
+	const PetscScalar* array;
+	PetscCallContinue(VecGetArrayRead(C, &array));
+	for (IdType i = 0; i < nPoints; ++i) {
+		std::copy_n(
+			array + i * blockSize, nComponents, concs.data() + i * nComponents);
+	}
+	PetscCallContinue(VecRestoreArrayRead(C, &array));
+
+	return nPoints;
+}
+
+void
+PetscSolver::getLocalGridBox(std::array<IdType, 3>& start,
+	std::array<IdType, 3>& count, std::array<IdType, 3>& globalSize)
+{
+	PetscInt xs, ys, zs, xm, ym, zm, Mx, My, Mz;
+	PetscCallVoid(DMDAGetCorners(da, &xs, &ys, &zs, &xm, &ym, &zm));
+	PetscCallVoid(DMDAGetInfo(da, NULL, &Mx, &My, &Mz, NULL, NULL, NULL, NULL,
+		NULL, NULL, NULL, NULL, NULL));
+	start = {static_cast<IdType>(xs), static_cast<IdType>(ys),
+		static_cast<IdType>(zs)};
+	count = {static_cast<IdType>(xm), static_cast<IdType>(ym),
+		static_cast<IdType>(zm)};
+	globalSize = {static_cast<IdType>(Mx), static_cast<IdType>(My),
+		static_cast<IdType>(Mz)};
 }
 
 void
 PetscSolver::setConcVector(std::vector<std::vector<
 		std::vector<std::vector<std::pair<IdType, double>>>>>& concVector)
 {
-	return this->solverHandler->setConcVector(da, C, concVector);
+	PetscInt xm, ym, zm, blockSize;
+	PetscCallVoid(DMDAGetCorners(da, NULL, NULL, NULL, &xm, &ym, &zm));
+	PetscCallVoid(VecGetBlockSize(C, &blockSize));
+
+	// Start from the current dense local concentrations
+	std::vector<double> concs;
+	getConcentrations(blockSize, concs);
+
+	// Overwrite the given values
+	double* point = concs.data();
+	for (auto k = 0; k < zm; ++k)
+		for (auto j = 0; j < ym; ++j)
+			for (auto i = 0; i < xm; ++i, point += blockSize) {
+				for (auto const& pair : concVector[k][j][i]) {
+					point[pair.first] = pair.second;
+				}
+			}
+
+	setConcentrations(BufferLayout{}, concs.data());
 }
 
 double
@@ -334,6 +638,10 @@ PetscSolver::setCurrentTimes(double time, double dt)
 	// Give the values to the solver
 	PetscCallVoid(TSSetTime(ts, time));
 	PetscCallVoid(TSSetTimeStep(ts, dt));
+
+	// The transport part and the heat equation start from the same time
+	transportTime = time;
+	heatTime = time;
 }
 
 void
@@ -370,6 +678,8 @@ PetscSolver::solve()
 			}
 			// Start the PETSc Solve
 			PetscCallVoid(TSSolve(ts, C));
+			// The last checkpoints may still be in flight
+			this->monitor->waitForCheckpoints();
 			// Stop the timer
 			solveTimer->stop();
 
@@ -473,9 +783,16 @@ PetscSolver::finalize()
 	/* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 	 Free work space.
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+	if (this->monitor) {
+		this->monitor->closeCheckpoint();
+	}
 	PetscCallVoid(PetscOptionsDestroy(&petscOptions));
 	PetscCallVoid(VecDestroy(&C));
 	PetscCallVoid(TSDestroy(&ts));
+	if (transportTs) {
+		PetscCallVoid(TSDestroy(&transportTs));
+		PetscCallVoid(VecDestroy(&splitStartC));
+	}
 	PetscCallVoid(DMDestroy(&da));
 
 	if (petscInitializedHere) {
@@ -494,6 +811,51 @@ PetscSolver::getXolotlTime()
 
 PetscErrorCode
 PetscSolver::rhsFunction(TS ts, PetscReal ftime, Vec C, Vec F)
+{
+	PetscFunctionBeginUser;
+	PetscCall(computeRHSFunction(ts, ftime, C, F, getRHSTerms(ts)));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::rhsJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J)
+{
+	PetscFunctionBeginUser;
+	PetscCall(computeRHSJacobian(ts, ftime, C, A, J, getRHSTerms(ts)));
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::iFunction(TS ts, PetscReal ftime, Vec C, Vec Cdot, Vec F)
+{
+	PetscFunctionBeginUser;
+
+	// F = Cdot - f_I(C)
+	PetscCall(computeRHSFunction(
+		ts, ftime, C, F, handler::allTerms & ~explicitTerms));
+	PetscCall(VecAYPX(F, -1.0, Cdot));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::iJacobian(TS ts, PetscReal ftime, Vec C, Vec Cdot,
+	PetscReal shift, Mat A, Mat J)
+{
+	PetscFunctionBeginUser;
+
+	// J = shift * I - df_I/dC, the diagonal is always part of the pattern
+	PetscCall(computeRHSJacobian(
+		ts, ftime, C, A, J, handler::allTerms & ~explicitTerms));
+	PetscCall(MatScale(J, -1.0));
+	PetscCall(MatShift(J, shift));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::computeRHSFunction(
+	TS ts, PetscReal ftime, Vec C, Vec F, unsigned int terms)
 {
 	PetscFunctionBeginUser;
 
@@ -516,7 +878,12 @@ PetscSolver::rhsFunction(TS ts, PetscReal ftime, Vec C, Vec F)
 	// Set the initial values of F
 	PetscCall(VecSet(F, 0.0));
 
-	// Compute the new concentrations
+	// Compute the new concentrations, the decoupled heat equation is never
+	// part of the time steppers
+	if (heatDecoupled) {
+		terms &= ~handler::temperatureTerm;
+	}
+	this->solverHandler->setRHSTerms(terms);
 	this->solverHandler->updateConcentration(ts, localC, F, ftime);
 
 	// Stop the RHSFunction Timer
@@ -529,7 +896,8 @@ PetscSolver::rhsFunction(TS ts, PetscReal ftime, Vec C, Vec F)
 }
 
 PetscErrorCode
-PetscSolver::rhsJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J)
+PetscSolver::computeRHSJacobian(
+	TS ts, PetscReal ftime, Vec C, Mat A, Mat J, unsigned int terms)
 {
 	PetscFunctionBeginUser;
 
@@ -548,6 +916,10 @@ PetscSolver::rhsJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J)
 	PetscCall(DMGlobalToLocalEnd(da, C, INSERT_VALUES, localC));
 
 	// Get the solver handler
+	if (heatDecoupled) {
+		terms &= ~handler::temperatureTerm;
+	}
+	this->solverHandler->setRHSTerms(terms);
 	this->solverHandler->computeJacobian(ts, localC, J, ftime);
 
 	// Return the local vector
@@ -568,5 +940,179 @@ PetscSolver::rhsJacobian(TS ts, PetscReal ftime, Vec C, Mat A, Mat J)
 
 	PetscFunctionReturn(0);
 }
+
+unsigned int
+PetscSolver::getRHSTerms(TS ts) const
+{
+	if (timeIntegration == "strang") {
+		if (ts == transportTs) {
+			return handler::diffusionTerm | handler::advectionTerm |
+				handler::soretTerm | handler::temperatureTerm;
+		}
+		return handler::reactionTerm | handler::fluxTerm;
+	}
+
+	// Only the explicit part goes through the RHS function
+	if (timeIntegration == "imex") {
+		return explicitTerms;
+	}
+
+	return handler::allTerms;
+}
+
+void
+PetscSolver::createTransportTS(Mat J)
+{
+	if (transportTs) {
+		PetscCallVoid(TSDestroy(&transportTs));
+		PetscCallVoid(VecDestroy(&splitStartC));
+	}
+
+	// Same non-zero structure as the full Jacobian (MatDuplicate keeps the
+	// COO assembly information), only the transport entries will be set
+	Mat transportJ;
+	PetscCallVoid(MatDuplicate(J, MAT_DO_NOT_COPY_VALUES, &transportJ));
+
+	auto xolotlComm = util::getMPIComm();
+	PetscCallVoid(TSCreate(xolotlComm, &transportTs));
+	PetscCallVoid(TSSetOptionsPrefix(transportTs, "transport_"));
+	PetscCallVoid(TSSetType(transportTs, TSARKIMEX));
+	PetscCallVoid(TSARKIMEXSetFullyImplicit(transportTs, PETSC_TRUE));
+	PetscCallVoid(TSSetDM(transportTs, da));
+	PetscCallVoid(TSSetProblemType(transportTs, TS_NONLINEAR));
+	PetscCallVoid(TSSetRHSFunction(transportTs, nullptr, RHSFunction, this));
+	PetscCallVoid(TSSetRHSJacobian(
+		transportTs, transportJ, transportJ, RHSJacobian, this));
+	PetscCallVoid(
+		TSSetExactFinalTime(transportTs, TS_EXACTFINALTIME_MATCHSTEP));
+	PetscCallVoid(TSSetFromOptions(transportTs));
+	PetscCallVoid(MatDestroy(&transportJ));
+
+	// Keeps the state at the beginning of each split step
+	PetscCallVoid(DMCreateGlobalVector(da, &splitStartC));
+
+	transportDt = 0.0;
+}
+
+PetscErrorCode
+PetscSolver::advanceTransport(Vec U, PetscReal targetTime)
+{
+	PetscFunctionBeginUser;
+
+	// Nothing to do if the transport is already there
+	if (targetTime <= transportTime) {
+		PetscFunctionReturn(0);
+	}
+
+	transportTimer->start();
+
+	// Start from the last step size that worked
+	PetscReal dt = targetTime - transportTime;
+	if (transportDt > 0.0) {
+		dt = std::min(dt, transportDt);
+	}
+	PetscCall(TSSetStepNumber(transportTs, 0));
+	PetscCall(TSSetTime(transportTs, transportTime));
+	PetscCall(TSSetTimeStep(transportTs, dt));
+	PetscCall(TSSetMaxTime(transportTs, targetTime));
+	PetscCall(TSSolve(transportTs, U));
+	PetscCall(TSGetTimeStep(transportTs, &transportDt));
+	transportTime = targetTime;
+
+	transportTimer->stop();
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::advanceHeat(Vec U, PetscReal targetTime)
+{
+	PetscFunctionBeginUser;
+
+	if (targetTime <= heatTime) {
+		PetscFunctionReturn(0);
+	}
+
+	heatTimer->start();
+	this->solverHandler->advanceTemperature(da, U, heatTime,
+		targetTime - heatTime, std::max<PetscInt>(heatSubSteps, 1));
+	heatTime = targetTime;
+	heatTimer->stop();
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::preStep(TS ts)
+{
+	PetscFunctionBeginUser;
+
+	PetscReal time, dt;
+	PetscCall(TSGetTime(ts, &time));
+	PetscCall(TSGetTimeStep(ts, &dt));
+	Vec U;
+	PetscCall(TSGetSolution(ts, &U));
+
+	// Save the state in case the reaction step is rejected
+	PetscCall(VecCopy(U, splitStartC));
+	splitStartTime = transportTime;
+
+	// T(dt/2)
+	PetscCall(advanceTransport(U, time + 0.5 * dt));
+	splitDt = dt;
+	PetscCall(TSRestartStep(ts));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::preStage(TS ts, PetscReal stageTime)
+{
+	PetscFunctionBeginUser;
+
+	PetscReal time, dt;
+	PetscCall(TSGetTime(ts, &time));
+	PetscCall(TSGetTimeStep(ts, &dt));
+
+	// Only the first stage of a retried step needs anything, the step
+	// size changed after the rejection
+	if (stageTime != time || dt == splitDt) {
+		PetscFunctionReturn(0);
+	}
+
+	// Redo T(dt/2) from the beginning of the step with the new step size
+	Vec U;
+	PetscCall(TSGetSolution(ts, &U));
+	PetscCall(VecCopy(splitStartC, U));
+	transportTime = splitStartTime;
+	PetscCall(advanceTransport(U, time + 0.5 * dt));
+	splitDt = dt;
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscSolver::postEvaluate(TS ts)
+{
+	PetscFunctionBeginUser;
+
+	PetscReal time;
+	PetscCall(TSGetTime(ts, &time));
+	Vec U;
+	PetscCall(TSGetSolution(ts, &U));
+
+	// T(dt/2), the solution is synchronized again for the monitors
+	if (timeIntegration == "strang") {
+		PetscCall(advanceTransport(U, time));
+	}
+
+	// The temperature catches up with the clusters
+	if (heatDecoupled) {
+		PetscCall(advanceHeat(U, time));
+	}
+	PetscCall(TSRestartStep(ts));
+
+	PetscFunctionReturn(0);
+}
 } /* end namespace solver */
 } /* end namespace xolotl */
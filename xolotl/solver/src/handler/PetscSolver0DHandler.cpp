@@ -15,6 +15,32 @@ namespace solver
 {
 namespace handler
 {
+double
+PetscSolver0DHandler::getMemberTemperature(IdType member, double time) const
+{
+	if (memberTemperatures.empty()) {
+		plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
+		return temperatureHandler->getTemperature(gridPosition, time);
+	}
+
+	return memberTemperatures[member];
+}
+
+void
+PetscSolver0DHandler::getMemberTemperatures(
+	NetworkType::GridConcentrationsView concs, double time,
+	std::vector<double>& temps)
+{
+	if (memberTemperatures.empty()) {
+		std::vector<plsm::SpaceVector<double, 3>> gridPositions(
+			nMembers, plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+		temperatureHandler->getTemperatures(gridPositions, time, concs, temps);
+		return;
+	}
+
+	temps = memberTemperatures;
+}
+
 void
 PetscSolver0DHandler::createSolverContext(DM& da)
 {
@@ -27,6 +53,9 @@ PetscSolver0DHandler::createSolverContext(DM& da)
 	 - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 	XOLOTL_LOG << "SolverHandler: 0D simulation";
+	if (nMembers > 1) {
+		XOLOTL_LOG << ", ensemble of " << nMembers << " members";
+	}
 	for (auto pair : initialConc) {
 		XOLOTL_LOG << ", initial concentration for Id: " << pair.first
 				   << " of: " << pair.second << " nm-3";
@@ -41,8 +70,9 @@ PetscSolver0DHandler::createSolverContext(DM& da)
 								 "parallel, this is not possible!");
 	}
 
-	PetscCallVoid(
-		DMDACreate1d(xolotlComm, DM_BOUNDARY_NONE, 1, dof + 1, 0, NULL, &da));
+	// One point per ensemble member, they are not coupled
+	PetscCallVoid(DMDACreate1d(
+		xolotlComm, DM_BOUNDARY_NONE, nMembers, dof + 1, 0, NULL, &da));
 	PetscCallVoid(DMSetFromOptions(da));
 	PetscCallVoid(DMSetUp(da));
 }
@@ -64,26 +94,40 @@ PetscSolver0DHandler::initializeSolverContext(DM& da, Mat& J)
 	temperatureHandler->initialize(dof);
 
 	// Tell the network the number of grid points on this process
-	network.setGridSize(1);
+	network.setGridSize(nMembers);
 
 	// Get the diagonal fill
-	auto nPartials = network.getDiagonalFill(dfill);
-
-	// Preallocate matrix
-	auto [rows, cols] = convertToCoordinateListPair(dof, dfill);
-	rows.push_back(dof);
-	cols.push_back(dof);
-	++nPartials;
+	nNetworkEntries = network.getDiagonalFill(dfill);
+
+	// Preallocate matrix, the same block for each member
+	auto [blockRows, blockCols] = convertToCoordinateListPair(dof, dfill);
+	blockRows.push_back(dof);
+	blockCols.push_back(dof);
+	std::vector<PetscInt> rows, cols;
+	rows.reserve(nMembers * blockRows.size());
+	cols.reserve(nMembers * blockCols.size());
+	for (IdType m = 0; m < nMembers; ++m) {
+		PetscInt offset = m * (dof + 1);
+		for (std::size_t n = 0; n < blockRows.size(); ++n) {
+			rows.push_back(blockRows[n] + offset);
+			cols.push_back(blockCols[n] + offset);
+		}
+	}
 	//
 	PetscCallVoid(
 		MatSetPreallocationCOO(J, rows.size(), rows.data(), cols.data()));
 
 	// Initialize the arrays for the reaction partial derivatives
-	vals = Kokkos::View<double*>("solverPartials", nPartials);
+	vals = Kokkos::View<double*>("solverPartials", rows.size());
 
 	// Set the size of the partial derivatives vectors
 	reactingPartialsForCluster.resize(dof, 0.0);
 
+	// Work array to scale the flux of each member
+	if (not memberFluxFactors.empty()) {
+		fluxBuffer = Kokkos::View<double*>("ensembleFlux", dof + 1);
+	}
+
 	// Initialize the flux handler
 	fluxHandler->initializeFluxHandler(network, 0, grid);
 }
@@ -93,7 +137,7 @@ PetscSolver0DHandler::initializeConcentration(
 	DM& da, Vec& C, DM& oldDA, Vec& oldC)
 {
 	// Initialize the last temperature
-	temperature.push_back(0.0);
+	temperature.assign(nMembers, 0.0);
 
 	// Pointer for the concentration vector
 	PetscScalar** concentrations = nullptr;
@@ -106,19 +150,6 @@ PetscSolver0DHandler::initializeConcentration(
 	// + moments
 	const auto dof = network.getDOF();
 
-	// Get the concentration of the only grid point
-	concOffset = concentrations[0];
-
-	// Loop on all the clusters to initialize at 0.0
-	for (auto n = 0; n < dof; n++) {
-		concOffset[n] = 0.0;
-	}
-
-	// Temperature
-	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
-	concOffset[dof] = temperatureHandler->getTemperature(gridPosition, 0.0);
-	temperature[0] = concOffset[dof];
-
 	// Get the last time step written in the HDF5 file
 	bool hasConcentrations = false;
 	std::unique_ptr<io::XFile> xfile;
@@ -129,35 +160,46 @@ PetscSolver0DHandler::initializeConcentration(
 		hasConcentrations = (concGroup and concGroup->hasTimesteps());
 	}
 
-	// Initialize the option specified concentration
-	if (not hasConcentrations) {
-		for (auto pair : initialConc) {
-			concOffset[pair.first] = pair.second;
-		}
-	}
-
-	// If the concentration must be set from the HDF5 file
+	// Read the concentrations from the HDF5 file for each member
+	io::XFile::TimestepGroup::Concs1DType myConcs;
 	if (hasConcentrations) {
-		// Read the concentrations from the HDF5 file for
-		// each of our grid points.
 		assert(concGroup);
 		auto tsGroup = concGroup->getLastTimestepGroup();
 		assert(tsGroup);
-		auto myConcs = tsGroup->readConcentrations(*xfile, 0, 1);
+		myConcs = tsGroup->readConcentrations(*xfile, 0, nMembers);
+	}
+
+	for (IdType m = 0; m < nMembers; ++m) {
+		// Get the concentration of this member
+		concOffset = concentrations[m];
+
+		// Loop on all the clusters to initialize at 0.0
+		for (auto n = 0; n < dof; n++) {
+			concOffset[n] = 0.0;
+		}
 
-		// Apply the concentrations we just read.
-		concOffset = concentrations[0];
+		// Temperature
+		concOffset[dof] = getMemberTemperature(m, 0.0);
+		temperature[m] = concOffset[dof];
 
-		for (auto const& currConcData : myConcs[0]) {
-			concOffset[currConcData.first] = currConcData.second;
+		// Initialize the option specified concentration
+		if (not hasConcentrations) {
+			for (auto pair : initialConc) {
+				concOffset[pair.first] = pair.second;
+			}
+		}
+		// Apply the concentrations we just read
+		else {
+			for (auto const& currConcData : myConcs[m]) {
+				concOffset[currConcData.first] = currConcData.second;
+			}
+			// Get the temperature
+			temperature[m] = myConcs[m][myConcs[m].size() - 1].second;
 		}
-		// Get the temperature
-		double temp = myConcs[0][myConcs[0].size() - 1].second;
-		temperature[0] = temp;
 	}
 
 	// Update the network with the temperature
-	auto depths = std::vector<double>(1, 1.0);
+	auto depths = std::vector<double>(nMembers, 1.0);
 	network.setTemperatures(temperature, depths);
 
 	/*
@@ -168,80 +210,25 @@ PetscSolver0DHandler::initializeConcentration(
 	return;
 }
 
-std::vector<std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-PetscSolver0DHandler::getConcVector(DM& da, Vec& C)
-{
-	// Initial declaration
-	const double* gridPointSolution = nullptr;
-
-	// Pointer for the concentration vector
-	PetscScalar** concentrations = nullptr;
-	PetscCallContinue(DMDAVecGetArrayDOFRead(da, C, &concentrations));
-
-	// Get the network and dof
-	auto& network = getNetwork();
-	const auto dof = network.getDOF();
-
-	// Create the vector for the concentrations
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-		toReturn;
-
-	// Access the solution data for the current grid point.
-	gridPointSolution = concentrations[0];
-
-	// Create the temporary vector for this grid point
-	std::vector<std::pair<IdType, double>> tempVector;
-	for (auto l = 0; l < dof + 1; ++l) {
-		//		if (std::fabs(gridPointSolution[l]) > 1.0e-20) {
-		tempVector.push_back(std::make_pair(l, gridPointSolution[l]));
-		//		}
-	}
-	std::vector<std::vector<std::pair<IdType, double>>> tempTempVector;
-	tempTempVector.push_back(tempVector);
-	std::vector<std::vector<std::vector<std::pair<IdType, double>>>>
-		tempTempTempVector;
-	tempTempTempVector.push_back(tempTempVector);
-	toReturn.push_back(tempTempTempVector);
-
-	// Restore the solutionArray
-	PetscCallContinue(DMDAVecRestoreArrayDOFRead(da, C, &concentrations));
-
-	return toReturn;
-}
-
 void
-PetscSolver0DHandler::setConcVector(DM& da, Vec& C,
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-		concVector)
+PetscSolver0DHandler::updateNetworkTemperature(DM& da, Vec& C)
 {
 	// Pointer for the concentration vector
-	PetscScalar* gridPointSolution = nullptr;
 	PetscScalar** concentrations = nullptr;
-	PetscCallVoid(DMDAVecGetArrayDOF(da, C, &concentrations));
+	PetscCallVoid(DMDAVecGetArrayDOFRead(da, C, &concentrations));
 
 	// Get the DOF of the network
 	const auto dof = network.getDOF();
 
-	// Get the local concentration
-	gridPointSolution = concentrations[0];
-
-	// Loop on the given vector
-	for (auto l = 0; l < concVector[0][0][0].size(); l++) {
-		gridPointSolution[concVector[0][0][0][l].first] =
-			concVector[0][0][0][l].second;
+	// Set the temperature of each member in the network
+	for (IdType m = 0; m < nMembers; ++m) {
+		temperature[m] = concentrations[m][dof];
 	}
-
-	// Set the temperature in the network
-	temperature[0] = gridPointSolution[dof];
-	auto depths = std::vector<double>(1, 1.0);
+	auto depths = std::vector<double>(nMembers, 1.0);
 	network.setTemperatures(temperature, depths);
 
-	/*
-	 Restore vectors
-	 */
-	PetscCallVoid(DMDAVecRestoreArrayDOF(da, C, &concentrations));
+	// Restore the solutionArray
+	PetscCallVoid(DMDAVecRestoreArrayDOFRead(da, C, &concentrations));
 
 	return;
 }
@@ -261,36 +248,63 @@ PetscSolver0DHandler::updateConcentration(
 	PetscOffsetView<PetscScalar**> updatedConcs;
 	PetscCallVoid(DMDAVecGetKokkosOffsetViewDOFWrite(da, F, &updatedConcs));
 
-	// Set the grid position
-	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
-
-	// The following pointers are set to the first position in the conc or
-	// updatedConc arrays that correspond to the beginning of the data for the
-	// current grid point.
-	auto concOffset = subview(concs, 0, Kokkos::ALL).view();
-	auto updatedConcOffset = subview(updatedConcs, 0, Kokkos::ALL).view();
-
-	// Get the temperature from the temperature handler
-	temperatureHandler->setTemperature(concOffset);
-	double temp = temperatureHandler->getTemperature(gridPosition, ftime);
+	// Get the temperature of each member from the temperature handler
+	std::vector<double> memberTemps;
+	getMemberTemperatures(
+		getGridRows<NetworkType::GridConcentrationsView>(concs), ftime,
+		memberTemps);
+	bool tempHasChanged = false;
+	for (IdType m = 0; m < nMembers; ++m) {
+		double temp = memberTemps[m];
+
+		if (std::fabs(temperature[m] - temp) > 0.1) {
+			temperature[m] = temp;
+			tempHasChanged = true;
+		}
+	}
 
 	// Update the network if the temperature changed
-	if (std::fabs(temperature[0] - temp) > 0.1) {
-		temperature[0] = temp;
-		auto depths = std::vector<double>(1, 1.0);
+	if (tempHasChanged) {
+		auto depths = std::vector<double>(nMembers, 1.0);
 		network.setTemperatures(temperature, depths);
 	}
 
-	// ----- Account for flux of incoming particles -----
-	fluxHandler->computeIncidentFlux(
-		ftime, concOffset, updatedConcOffset, 0, 0);
+	for (IdType m = 0; m < nMembers; ++m) {
+		// The following pointers are set to the first position in the conc or
+		// updatedConc arrays that correspond to the beginning of the data for
+		// the current member.
+		auto concOffset = subview(concs, m, Kokkos::ALL).view();
+		auto updatedConcOffset = subview(updatedConcs, m, Kokkos::ALL).view();
+
+		// ----- Account for flux of incoming particles -----
+		if (hasTerm(fluxTerm)) {
+			if (memberFluxFactors.empty()) {
+				fluxHandler->computeIncidentFlux(
+					ftime, concOffset, updatedConcOffset, 0, 0);
+			}
+			else {
+				auto buffer = fluxBuffer;
+				Kokkos::deep_copy(buffer, 0.0);
+				fluxHandler->computeIncidentFlux(
+					ftime, concOffset, buffer, 0, 0);
+				auto factor = memberFluxFactors[m];
+				Kokkos::parallel_for(
+					"PetscSolver0DHandler::memberFlux", buffer.size(),
+					KOKKOS_LAMBDA(const IdType i) {
+						updatedConcOffset(i) += factor * buffer(i);
+					});
+			}
+		}
 
-	// ----- Compute the reaction fluxes over the locally owned part of the grid
-	// -----
-	fluxCounter->increment();
-	fluxTimer->start();
-	network.computeAllFluxes(concOffset, updatedConcOffset);
-	fluxTimer->stop();
+		// ----- Compute the reaction fluxes over the locally owned part of the
+		// grid -----
+		if (hasTerm(reactionTerm)) {
+			fluxCounter->increment();
+			fluxTimer->start();
+			network.computeAllFluxes(concOffset, updatedConcOffset, m);
+			fluxTimer->stop();
+		}
+	}
 
 	/*
 	 Restore vectors
@@ -311,28 +325,45 @@ PetscSolver0DHandler::computeJacobian(
 	PetscOffsetView<const PetscScalar**> concs;
 	PetscCallVoid(DMDAVecGetKokkosOffsetViewDOF(da, localC, &concs));
 
-	// Set the grid position
-	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
-
-	// Get the temperature from the temperature handler
-	auto concOffset = subview(concs, 0, Kokkos::ALL).view();
-	temperatureHandler->setTemperature(concOffset);
-	double temp = temperatureHandler->getTemperature(gridPosition, ftime);
+	// Get the temperature of each member from the temperature handler
+	std::vector<double> memberTemps;
+	getMemberTemperatures(
+		getGridRows<NetworkType::GridConcentrationsView>(concs), ftime,
+		memberTemps);
+	bool tempHasChanged = false;
+	for (IdType m = 0; m < nMembers; ++m) {
+		double temp = memberTemps[m];
+
+		if (std::fabs(temperature[m] - temp) > 0.1) {
+			temperature[m] = temp;
+			tempHasChanged = true;
+		}
+	}
 
 	// Update the network if the temperature changed
-	if (std::fabs(temperature[0] - temp) > 0.1) {
-		temperature[0] = temp;
-		auto depths = std::vector<double>(1, 1.0);
+	if (tempHasChanged) {
+		auto depths = std::vector<double>(nMembers, 1.0);
 		network.setTemperatures(temperature, depths);
 	}
 
 	// ----- Take care of the reactions for all the reactants -----
 
-	// Compute all the partial derivatives for the reactions
-	partialDerivativeCounter->increment();
-	partialDerivativeTimer->start();
-	network.computeAllPartials(concOffset, vals);
-	partialDerivativeTimer->stop();
+	// Compute all the partial derivatives for the reactions, each member
+	// block holds the network entries followed by the temperature
+	if (hasTerm(reactionTerm)) {
+		const std::size_t blockSize = nNetworkEntries + 1;
+		for (IdType m = 0; m < nMembers; ++m) {
+			auto concOffset = subview(concs, m, Kokkos::ALL).view();
+			auto blockStart = m * blockSize;
+			partialDerivativeCounter->increment();
+			partialDerivativeTimer->start();
+			network.computeAllPartials(concOffset,
+				subview(vals,
+					std::make_pair(blockStart, blockStart + nNetworkEntries)),
+				m);
+			partialDerivativeTimer->stop();
+		}
+	}
 
 	PetscCallVoid(MatSetValuesCOO(J, vals.data(), ADD_VALUES));
 
@@ -129,6 +129,12 @@ PetscSolver1DHandler::initializeSolverContext(DM& da, Mat& J)
 	// Initialize the temperature handler
 	temperatureHandler->initialize(dof);
 
+	// The separate heat equation solve only knows the mirror boundaries
+	if (temperatureDecoupled and not isMirror) {
+		throw std::runtime_error("\nThe heat equation can only be solved "
+								 "separately with mirror boundary conditions.");
+	}
+
 	// Fill ofill, the matrix of "off-diagonal" elements that represents
 	// diffusion
 	diffusionHandler->initialize(network, difEntries);
@@ -191,11 +197,15 @@ PetscSolver1DHandler::initializeSolverContext(DM& da, Mat& J)
 		};
 	std::size_t partialsCount{0};
 	for (auto i = localXS; i < localXS + localXM; ++i) {
-		// temperature
+		// temperature, only the diagonal is kept when it is decoupled
 		mapMatStencilsToCoords({dof, dof}, i, i, rows, cols);
+		partialsCount += 1;
+		if (temperatureDecoupled) {
+			continue;
+		}
 		mapMatStencilsToCoords({dof, dof}, i, i - 1, rows, cols);
 		mapMatStencilsToCoords({dof, dof}, i, i + 1, rows, cols);
-		partialsCount += 3;
+		partialsCount += 2;
 	}
 	for (auto i = localXS; i < localXS + localXM; ++i) {
 		// Soret diffusion
@@ -640,76 +650,12 @@ PetscSolver1DHandler::initGBLocation(DM& da, Vec& C)
 	return;
 }
 
-std::vector<std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-PetscSolver1DHandler::getConcVector(DM& da, Vec& C)
-{
-	// Initial declaration
-	const double* gridPointSolution = nullptr;
-
-	// Pointer for the concentration vector
-	PetscScalar** concentrations = nullptr;
-	PetscCallContinue(DMDAVecGetArrayDOFRead(da, C, &concentrations));
-
-	// Get the network and dof
-	auto& network = getNetwork();
-	const auto dof = network.getDOF();
-
-	// Create the vector for the concentrations
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-		toReturn;
-	std::vector<std::vector<std::pair<IdType, double>>> tempTempVector;
-
-	// Loop on the grid points
-	for (auto i = 0; i < localXM; ++i) {
-		gridPointSolution = concentrations[localXS + i];
-
-		// Create the temporary vector for this grid point
-		std::vector<std::pair<IdType, double>> tempVector;
-		for (auto l = 0; l < dof + 1; ++l) {
-			if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-				tempVector.push_back(std::make_pair(l, gridPointSolution[l]));
-			}
-		}
-		tempTempVector.push_back(tempVector);
-	}
-	std::vector<std::vector<std::vector<std::pair<IdType, double>>>>
-		tempTempTempVector;
-	tempTempTempVector.push_back(tempTempVector);
-	toReturn.push_back(tempTempTempVector);
-
-	// Restore the solutionArray
-	PetscCallContinue(DMDAVecRestoreArrayDOFRead(da, C, &concentrations));
-
-	return toReturn;
-}
-
 void
-PetscSolver1DHandler::setConcVector(DM& da, Vec& C,
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-		concVector)
+PetscSolver1DHandler::updateNetworkTemperature(DM& da, Vec& C)
 {
 	// Pointer for the concentration vector
 	PetscScalar* gridPointSolution = nullptr;
 	PetscScalar** concentrations = nullptr;
-	PetscCallVoid(DMDAVecGetArrayDOF(da, C, &concentrations));
-
-	// Loop on the grid points
-	for (auto i = 0; i < localXM; ++i) {
-		gridPointSolution = concentrations[localXS + i];
-
-		// Loop on the given vector
-		for (auto l = 0; l < concVector[0][0][i].size(); l++) {
-			gridPointSolution[concVector[0][0][i][l].first] =
-				concVector[0][0][i][l].second;
-		}
-	}
-
-	/*
-	 Restore vectors
-	 */
-	PetscCallVoid(DMDAVecRestoreArrayDOF(da, C, &concentrations));
 
 	// Get the complete data array, including ghost cells to set the temperature
 	// at the ghost points
@@ -750,6 +696,140 @@ PetscSolver1DHandler::setConcVector(DM& da, Vec& C,
 	return;
 }
 
+void
+PetscSolver1DHandler::advanceTemperature(
+	DM& da, Vec& C, double time, double deltaTime, int nSubSteps)
+{
+	// Get the DOF of the network
+	const auto dof = network.getDOF();
+	const int nPoints = nX;
+
+	// Pointer for the concentration vector
+	PetscScalar** concentrations = nullptr;
+	PetscCallVoid(DMDAVecGetArrayDOF(da, C, &concentrations));
+
+	// The temperature profile is small, every process gathers all of it and
+	// solves the same system
+	auto xolotlComm = util::getMPIComm();
+	int nProcs = 0;
+	MPI_Comm_size(xolotlComm, &nProcs);
+	int localCount = localXM;
+	std::vector<int> counts(nProcs), displs(nProcs, 0);
+	MPI_Allgather(
+		&localCount, 1, MPI_INT, counts.data(), 1, MPI_INT, xolotlComm);
+	for (auto p = 1; p < nProcs; ++p) {
+		displs[p] = displs[p - 1] + counts[p - 1];
+	}
+	std::vector<double> localTemps(localXM);
+	for (auto i = 0; i < localXM; ++i) {
+		localTemps[i] = concentrations[localXS + i][dof];
+	}
+	std::vector<double> temps(nPoints);
+	MPI_Allgatherv(localTemps.data(), localCount, MPI_DOUBLE, temps.data(),
+		counts.data(), displs.data(), MPI_DOUBLE, xolotlComm);
+
+	// The ghost points mirror the grid point next to the boundary
+	auto getMirrorIndex = [nPoints](int xi) {
+		if (xi < 0)
+			return -xi;
+		if (xi > nPoints - 1)
+			return 2 * (nPoints - 1) - xi;
+		return xi;
+	};
+
+	// Each sub-step solves (I - h J) dT = h f, with the rate and its partials
+	// taken at the beginning of the sub-step, in a tridiagonal system
+	std::vector<double> lower(nPoints), diag(nPoints), upper(nPoints),
+		rhs(nPoints);
+	double h = deltaTime / nSubSteps;
+	for (auto step = 0; step < nSubSteps; ++step) {
+		double currentTime = time + (step + 1) * h;
+		std::fill(lower.begin(), lower.end(), 0.0);
+		std::fill(diag.begin(), diag.end(), 1.0);
+		std::fill(upper.begin(), upper.end(), 0.0);
+		std::fill(rhs.begin(), rhs.end(), 0.0);
+
+		// Add the heat equation at one grid point to the system
+		auto addGridPoint = [&](int xi) {
+			// Compute the left and right hx
+			double hxLeft = 0.0, hxRight = 0.0;
+			if (xi >= 1 && xi < nPoints) {
+				hxLeft =
+					(temperatureGrid[xi + 1] - temperatureGrid[xi - 1]) / 2.0;
+				hxRight = (temperatureGrid[xi + 2] - temperatureGrid[xi]) / 2.0;
+			}
+			else {
+				hxLeft = temperatureGrid[xi + 1] - temperatureGrid[xi];
+				hxRight = (temperatureGrid[xi + 2] - temperatureGrid[xi]) / 2.0;
+			}
+
+			int ids[3] = {xi, getMirrorIndex(xi - 1), getMirrorIndex(xi + 1)};
+			double stencil[3] = {temps[ids[0]], temps[ids[1]], temps[ids[2]]};
+			double partials[3];
+			auto rate = temperatureHandler->computeTemperatureRate(
+				currentTime, stencil, partials, hxLeft, hxRight, xi);
+
+			rhs[xi] += h * rate;
+			for (auto n = 0; n < 3; ++n) {
+				if (ids[n] == xi)
+					diag[xi] -= h * partials[n];
+				else if (ids[n] < xi)
+					lower[xi] -= h * partials[n];
+				else
+					upper[xi] -= h * partials[n];
+			}
+		};
+
+		// Same grid points as in updateConcentration()
+		for (auto xi = 0; xi < nPoints; ++xi) {
+			// Heat condition
+			if (xi == 0 || (xi == nPoints - 1 && isRobin)) {
+				addGridPoint(xi);
+			}
+
+			// Boundary conditions
+			if (xi < leftOffset || xi > nPoints - 1 - rightOffset) {
+				continue;
+			}
+			// Free surface GB
+			bool skip = false;
+			for (auto& pair : gbVector) {
+				if (xi == std::get<0>(pair)) {
+					skip = true;
+					break;
+				}
+			}
+			if (skip)
+				continue;
+
+			addGridPoint(xi);
+		}
+
+		// Thomas algorithm
+		for (auto i = 1; i < nPoints; ++i) {
+			double w = lower[i] / diag[i - 1];
+			diag[i] -= w * upper[i - 1];
+			rhs[i] -= w * rhs[i - 1];
+		}
+		rhs[nPoints - 1] /= diag[nPoints - 1];
+		for (auto i = nPoints - 2; i >= 0; --i) {
+			rhs[i] = (rhs[i] - upper[i] * rhs[i + 1]) / diag[i];
+		}
+		for (auto i = 0; i < nPoints; ++i) {
+			temps[i] += rhs[i];
+		}
+	}
+
+	// Set the new temperatures in the solution
+	for (auto i = 0; i < localXM; ++i) {
+		concentrations[localXS + i][dof] = temps[localXS + i];
+	}
+	PetscCallVoid(DMDAVecRestoreArrayDOF(da, C, &concentrations));
+
+	// Update the network with the temperature
+	updateNetworkTemperature(da, C);
+}
+
 void
 PetscSolver1DHandler::updateConcentration(
 	TS& ts, Vec& localC, Vec& F, PetscReal ftime)
@@ -809,6 +889,27 @@ PetscSolver1DHandler::updateConcentration(
 	Kokkos::Array<ConcSubView, 3> concVector;
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		localXM + 2, plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto xi = (PetscInt)localXS - 1;
+		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
+		// Set the grid fraction
+		if (xi < 0) {
+			gridFractions[xi + 1 - localXS][0] =
+				(grid[0] - grid[1]) / (grid.back() - grid[1]);
+		}
+		else {
+			gridFractions[xi + 1 - localXS][0] =
+				((grid[xi] + grid[xi + 1]) / 2.0 - grid[1]) /
+				(grid.back() - grid[1]);
+		}
+	}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(gridFractions, ftime,
+		getGridRows<NetworkType::GridConcentrationsView>(concs), gridTemps);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points
 	bool tempHasChanged = false;
@@ -816,7 +917,7 @@ PetscSolver1DHandler::updateConcentration(
 		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 		// Heat condition
 		if ((xi == 0 || (xi == nX - 1 && isRobin)) && xi >= localXS &&
-			xi < localXS + localXM) {
+			xi < localXS + localXM && hasTerm(temperatureTerm)) {
 			// Compute the old and new array offsets
 			auto concOffset = subview(concs, xi, Kokkos::ALL).view();
 			auto updatedConcOffset =
@@ -854,18 +955,8 @@ PetscSolver1DHandler::updateConcentration(
 		auto concOffset = subview(concs, xi, Kokkos::ALL).view();
 		auto updatedConcOffset = subview(updatedConcs, xi, Kokkos::ALL).view();
 
-		// Set the grid fraction
-		if (xi < 0) {
-			gridPosition[0] = (grid[0] - grid[1]) / (grid.back() - grid[1]);
-		}
-		else {
-			gridPosition[0] = ((grid[xi] + grid[xi + 1]) / 2.0 - grid[1]) /
-				(grid.back() - grid[1]);
-		}
-
 		// Get the temperature from the temperature handler
-		temperatureHandler->setTemperature(concOffset);
-		double temp = temperatureHandler->getTemperature(gridPosition, ftime);
+		double temp = gridTemps[xi + 1 - localXS];
 
 		// Update the network if the temperature changed
 		if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -912,7 +1003,8 @@ PetscSolver1DHandler::updateConcentration(
 		}
 
 		// Compute the temperature over the locally owned part of the grid
-		if (xi >= localXS && xi < localXS + localXM) {
+		if (xi >= localXS && xi < localXS + localXM &&
+			hasTerm(temperatureTerm)) {
 			temperatureHandler->computeTemperature(ftime, concVector.data(),
 				updatedConcOffset, hxLeft, hxRight, xi);
 		}
@@ -987,26 +1079,34 @@ PetscSolver1DHandler::updateConcentration(
 
 		// ---- Compute Soret diffusion over the locally owned part of the grid
 		// -----
-		soretDiffusionHandler->computeDiffusion(network,
-			core::StencilConcArray{concVector.data(), 3}, updatedConcOffset,
-			hxLeft, hxRight, xi - localXS);
+		if (hasTerm(soretTerm)) {
+			soretDiffusionHandler->computeDiffusion(network,
+				core::StencilConcArray{concVector.data(), 3}, updatedConcOffset,
+				hxLeft, hxRight, xi - localXS);
+		}
 
 		// ----- Account for flux of incoming particles -----
-		fluxHandler->computeIncidentFlux(
-			ftime, concOffset, updatedConcOffset, xi, 0);
+		if (hasTerm(fluxTerm)) {
+			fluxHandler->computeIncidentFlux(
+				ftime, concOffset, updatedConcOffset, xi, 0);
+		}
 
 		// ---- Compute diffusion over the locally owned part of the grid -----
-		diffusionHandler->computeDiffusion(network,
-			core::StencilConcArray{concVector.data(), 3}, updatedConcOffset,
-			hxLeft, hxRight, xi - localXS);
+		if (hasTerm(diffusionTerm)) {
+			diffusionHandler->computeDiffusion(network,
+				core::StencilConcArray{concVector.data(), 3}, updatedConcOffset,
+				hxLeft, hxRight, xi - localXS);
+		}
 
 		// ---- Compute advection over the locally owned part of the grid -----
 		// Set the grid position
 		gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-		for (auto i = 0; i < advectionHandlers.size(); i++) {
-			advectionHandlers[i]->computeAdvection(network, gridPosition,
-				core::StencilConcArray{concVector.data(), 3}, updatedConcOffset,
-				hxLeft, hxRight, xi - localXS);
+		if (hasTerm(advectionTerm)) {
+			for (auto i = 0; i < advectionHandlers.size(); i++) {
+				advectionHandlers[i]->computeAdvection(network, gridPosition,
+					core::StencilConcArray{concVector.data(), 3},
+					updatedConcOffset, hxLeft, hxRight, xi - localXS);
+			}
 		}
 
 		auto surfacePos = grid[1];
@@ -1017,11 +1117,13 @@ PetscSolver1DHandler::updateConcentration(
 
 		// ----- Compute the reaction fluxes over the locally owned part of the
 		// grid -----
-		fluxCounter->increment();
-		fluxTimer->start();
-		network.computeAllFluxes(concOffset, updatedConcOffset,
-			xi + 1 - localXS, curDepth, curSpacing);
-		fluxTimer->stop();
+		if (hasTerm(reactionTerm)) {
+			fluxCounter->increment();
+			fluxTimer->start();
+			network.computeAllFluxes(concOffset, updatedConcOffset,
+				xi + 1 - localXS, curDepth, curSpacing);
+			fluxTimer->stop();
+		}
 	}
 
 	/*
@@ -1062,12 +1164,40 @@ PetscSolver1DHandler::computeJacobian(
 	const double* hConcPtrVec[3];
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		localXM + 2, plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto xi = (PetscInt)localXS - 1;
+		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
+		// Set the grid fraction
+		if (xi < 0) {
+			gridFractions[xi + 1 - localXS][0] =
+				(temperatureGrid[0] - temperatureGrid[1]) /
+				(temperatureGrid.back() - temperatureGrid[1]);
+		}
+		else {
+			gridFractions[xi + 1 - localXS][0] =
+				((temperatureGrid[xi] + temperatureGrid[xi + 1]) / 2.0 -
+					temperatureGrid[1]) /
+				(temperatureGrid.back() - temperatureGrid[1]);
+		}
+	}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(gridFractions, ftime,
+		getGridRows<NetworkType::GridConcentrationsView>(concs), gridTemps);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
 	bool tempHasChanged = false;
-	auto hTempVals = Kokkos::View<double*, Kokkos::HostSpace>(
-		"Host Temp Jac Vals", localXM * 3);
+	Kokkos::View<double*, Kokkos::HostSpace> hTempVals;
+	if (hasTerm(temperatureTerm)) {
+		hTempVals = Kokkos::View<double*, Kokkos::HostSpace>(
+			"Host Temp Jac Vals", localXM * 3);
+	}
+	// Only the diagonal is kept when the temperature is decoupled
+	const std::size_t nTempEntries = temperatureDecoupled ? 1 : 3;
 	std::size_t valIndex = 0;
 	for (auto xi = (PetscInt)localXS - 1;
 		 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
@@ -1090,27 +1220,26 @@ PetscSolver1DHandler::computeJacobian(
 			hxRight = temperatureGrid[xi + 1] - temperatureGrid[xi];
 		}
 
-		// Get the concentrations at this grid point
-		auto concOffset = subview(concs, xi, Kokkos::ALL).view();
-
 		auto tempIndex = valIndex;
 		if (xi >= localXS && xi < localXS + localXM) {
 			// Fill the concVector with the pointer to the middle, left, and
-			// right grid points
-			int id = 0;
-			for (auto&& xId : {xi, (PetscInt)xi - 1, xi + 1}) {
-				concVector[id] = subview(concs, xId, Kokkos::ALL).view();
-				hConcVec[id] = create_mirror_view(concVector[id]);
-				deep_copy(hConcVec[id], concVector[id]);
-				hConcPtrVec[id] = hConcVec[id].data();
-				++id;
+			// right grid points, only the temperature partials need them
+			if (hasTerm(temperatureTerm)) {
+				int id = 0;
+				for (auto&& xId : {xi, (PetscInt)xi - 1, xi + 1}) {
+					concVector[id] = subview(concs, xId, Kokkos::ALL).view();
+					hConcVec[id] = create_mirror_view(concVector[id]);
+					deep_copy(hConcVec[id], concVector[id]);
+					hConcPtrVec[id] = hConcVec[id].data();
+					++id;
+				}
 			}
-			valIndex += 3;
+			valIndex += nTempEntries;
 		}
 
 		// Heat condition
 		if ((xi == 0 || (xi == nX - 1 && isRobin)) && xi >= localXS &&
-			xi < localXS + localXM) {
+			xi < localXS + localXM && hasTerm(temperatureTerm)) {
 			// Get the partial derivatives for the temperature
 			auto setValues = temperatureHandler->computePartialsForTemperature(
 				ftime, hConcPtrVec, tempVals, tempIndices, hxLeft, hxRight, xi);
@@ -1122,21 +1251,8 @@ PetscSolver1DHandler::computeJacobian(
 			}
 		}
 
-		// Set the grid fraction
-		if (xi < 0) {
-			gridPosition[0] = (temperatureGrid[0] - temperatureGrid[1]) /
-				(temperatureGrid.back() - temperatureGrid[1]);
-		}
-		else {
-			gridPosition[0] =
-				((temperatureGrid[xi] + temperatureGrid[xi + 1]) / 2.0 -
-					temperatureGrid[1]) /
-				(temperatureGrid.back() - temperatureGrid[1]);
-		}
-
 		// Get the temperature from the temperature handler
-		temperatureHandler->setTemperature(concOffset);
-		double temp = temperatureHandler->getTemperature(gridPosition, ftime);
+		double temp = gridTemps[xi + 1 - localXS];
 
 		// Update the network if the temperature changed
 		if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -1160,7 +1276,8 @@ PetscSolver1DHandler::computeJacobian(
 			continue;
 
 		// Get the partial derivatives for the temperature
-		if (xi >= localXS && xi < localXS + localXM) {
+		if (xi >= localXS && xi < localXS + localXM &&
+			hasTerm(temperatureTerm)) {
 			auto setValues = temperatureHandler->computePartialsForTemperature(
 				ftime, hConcPtrVec, tempVals, tempIndices, hxLeft, hxRight, xi);
 
@@ -1171,7 +1288,10 @@ PetscSolver1DHandler::computeJacobian(
 			}
 		}
 	}
-	deep_copy(subview(vals, std::make_pair(IdType{0}, localXM * 3)), hTempVals);
+	if (hasTerm(temperatureTerm)) {
+		deep_copy(
+			subview(vals, std::make_pair(IdType{0}, localXM * 3)), hTempVals);
+	}
 
 	// Share the information with all the processes
 	bool totalTempHasChanged = false;
@@ -1283,25 +1403,32 @@ PetscSolver1DHandler::computeJacobian(
 		}
 
 		// Get the partial derivatives for the Soret diffusion
-		soretDiffusionHandler->computePartialsForDiffusion(network,
-			core::StencilConcArray{concVector.data(), 3},
-			subview(vals, std::make_pair(valIndex, valIndex + 3 * nSoret)),
-			hxLeft, hxRight, xi - localXS);
+		if (hasTerm(soretTerm)) {
+			soretDiffusionHandler->computePartialsForDiffusion(network,
+				core::StencilConcArray{concVector.data(), 3},
+				subview(vals, std::make_pair(valIndex, valIndex + 3 * nSoret)),
+				hxLeft, hxRight, xi - localXS);
+		}
 		valIndex += 3 * nSoret;
 
 		// Get the partial derivatives for the diffusion
-		diffusionHandler->computePartialsForDiffusion(network,
-			subview(vals, std::make_pair(valIndex, valIndex + 3 * nDiff)),
-			hxLeft, hxRight, xi - localXS);
+		if (hasTerm(diffusionTerm)) {
+			diffusionHandler->computePartialsForDiffusion(network,
+				subview(vals, std::make_pair(valIndex, valIndex + 3 * nDiff)),
+				hxLeft, hxRight, xi - localXS);
+		}
 		valIndex += 3 * nDiff;
 
 		// Get the partial derivatives for the advection
 		// Set the grid position
 		gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
 		for (auto l = 0; l < advectionHandlers.size(); l++) {
-			advectionHandlers[l]->computePartialsForAdvection(network,
-				subview(vals, std::make_pair(valIndex, valIndex + 2 * nAdvec)),
-				gridPosition, hxLeft, hxRight, xi - localXS);
+			if (hasTerm(advectionTerm)) {
+				advectionHandlers[l]->computePartialsForAdvection(network,
+					subview(
+						vals, std::make_pair(valIndex, valIndex + 2 * nAdvec)),
+					gridPosition, hxLeft, hxRight, xi - localXS);
+			}
 			valIndex += 2 * nAdvec;
 		}
 
@@ -1315,12 +1442,15 @@ PetscSolver1DHandler::computeJacobian(
 		auto curSpacing = curXPos - prevXPos;
 
 		// Compute all the partial derivatives for the reactions
-		partialDerivativeCounter->increment();
-		partialDerivativeTimer->start();
-		network.computeAllPartials(concOffset,
-			subview(vals, std::make_pair(valIndex, valIndex + nNetworkEntries)),
-			xi + 1 - localXS, curDepth, curSpacing);
-		partialDerivativeTimer->stop();
+		if (hasTerm(reactionTerm)) {
+			partialDerivativeCounter->increment();
+			partialDerivativeTimer->start();
+			network.computeAllPartials(concOffset,
+				subview(
+					vals, std::make_pair(valIndex, valIndex + nNetworkEntries)),
+				xi + 1 - localXS, curDepth, curSpacing);
+			partialDerivativeTimer->stop();
+		}
 		valIndex += nNetworkEntries;
 	}
 	Kokkos::fence();
@@ -366,27 +366,34 @@ PetscSolver2DHandler::initializeConcentration(
 			auto tsGroup = concGroup->getLastTimestepGroup();
 			assert(tsGroup);
 
-			// Loop on the full grid
-			for (auto j = 0; j < nY; j++) {
-				for (auto i = 0; i < nX; i++) {
-					// Read the concentrations from the HDF5 file
-					auto concVector = tsGroup->readGridPoint(i, j);
-
-					// Change the concentration only if we are on the locally
-					// owned part of the grid
-					if (i >= localXS && i < localXS + localXM && j >= localYS &&
-						j < localYS + localYM) {
-						concOffset = concentrations[j][i];
-						// Loop on the concVector size
-						for (auto l = 0; l < concVector.size(); l++) {
-							concOffset[(IdType)concVector.at(l).at(0)] =
-								concVector.at(l).at(1);
-						}
-						// Get the temperature
-						double temp =
-							concVector.at(concVector.size() - 1).at(1);
-						temperature[i - localXS + 1] = temp;
+			// Read only our block of the grid in one request, the file can
+			// come from a run with a different decomposition
+			std::vector<io::XFile::TimestepGroup::GridBox> points;
+			for (auto j = localYS; j < localYS + localYM; j++) {
+				for (auto i = localXS; i < localXS + localXM; i++) {
+					points.push_back({(int)i, (int)j, 0});
+				}
+			}
+			std::vector<uint32_t> offsets;
+			auto concs = tsGroup->readGridPoints(
+				*xfile, {(int)nX, (int)nY, 1}, 2, points, offsets);
+
+			// Apply the concentrations we just read.
+			auto n = 0;
+			for (auto j = localYS; j < localYS + localYM; j++) {
+				for (auto i = localXS; i < localXS + localXM; i++, n++) {
+					concOffset = concentrations[j][i];
+					for (auto m = offsets[n]; m < offsets[n + 1]; m++) {
+						concOffset[concs[m].first] = concs[m].second;
 					}
+					// Get the temperature, the last value of the grid point
+					if (offsets[n + 1] == offsets[n]) {
+						throw std::runtime_error(
+							"\nThe checkpoint file has no concentration for a "
+							"local grid point.");
+					}
+					temperature[i - localXS + 1] =
+						concs[offsets[n + 1] - 1].second;
 				}
 			}
 		}
@@ -671,81 +678,12 @@ PetscSolver2DHandler::initGBLocation(DM& da, Vec& C)
 	return;
 }
 
-std::vector<std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-PetscSolver2DHandler::getConcVector(DM& da, Vec& C)
-{
-	// Initial declaration
-	const double* gridPointSolution = nullptr;
-
-	// Pointer for the concentration vector
-	PetscScalar*** concentrations = nullptr;
-	PetscCallContinue(DMDAVecGetArrayDOFRead(da, C, &concentrations));
-
-	// Get the network and dof
-	auto& network = getNetwork();
-	const auto dof = network.getDOF();
-
-	// Create the vector for the concentrations
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-		toReturn;
-	std::vector<std::vector<std::vector<std::pair<IdType, double>>>>
-		tempTempTempVector;
-
-	// Loop on the grid points
-	for (auto j = 0; j < localYM; ++j) {
-		std::vector<std::vector<std::pair<IdType, double>>> tempTempVector;
-		for (auto i = 0; i < localXM; ++i) {
-			gridPointSolution = concentrations[localYS + j][localXS + i];
-
-			// Create the temporary vector for this grid point
-			std::vector<std::pair<IdType, double>> tempVector;
-			for (auto l = 0; l < dof + 1; ++l) {
-				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-					tempVector.push_back(
-						std::make_pair(l, gridPointSolution[l]));
-				}
-			}
-			tempTempVector.push_back(tempVector);
-		}
-		tempTempTempVector.push_back(tempTempVector);
-	}
-	toReturn.push_back(tempTempTempVector);
-
-	// Restore the solutionArray
-	PetscCallContinue(DMDAVecRestoreArrayDOFRead(da, C, &concentrations));
-
-	return toReturn;
-}
-
 void
-PetscSolver2DHandler::setConcVector(DM& da, Vec& C,
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-		concVector)
+PetscSolver2DHandler::updateNetworkTemperature(DM& da, Vec& C)
 {
 	// Pointer for the concentration vector
 	PetscScalar* gridPointSolution = nullptr;
 	PetscScalar*** concentrations = nullptr;
-	PetscCallVoid(DMDAVecGetArrayDOF(da, C, &concentrations));
-
-	// Loop on the grid points
-	for (auto j = 0; j < localYM; ++j) {
-		for (auto i = 0; i < localXM; ++i) {
-			gridPointSolution = concentrations[localYS + j][localXS + i];
-
-			// Loop on the given vector
-			for (auto l = 0; l < concVector[0][j][i].size(); l++) {
-				gridPointSolution[concVector[0][j][i][l].first] =
-					concVector[0][j][i][l].second;
-			}
-		}
-	}
-
-	/*
-	 Restore vectors
-	 */
-	PetscCallVoid(DMDAVecRestoreArrayDOF(da, C, &concentrations));
 
 	// Get the complete data array, including ghost cells to set the temperature
 	// at the ghost points
@@ -814,6 +752,48 @@ PetscSolver2DHandler::updateConcentration(
 	std::vector<double> incidentFluxVector;
 	double atomConc = 0.0, totalAtomConc = 0.0;
 
+	// The reactions of all the local grid points are computed in a single
+	// kernel, the points are collected in the loop
+	auto gridConcs = getGridRows<NetworkType::GridConcentrationsView>(concs);
+	auto gridFluxes = getGridRows<NetworkType::GridFluxesView>(updatedConcs);
+	std::vector<NetworkType::GridPoint> reactionPoints;
+	reactionPoints.reserve(localXM * localYM);
+	auto computeReactions = [&]() {
+		if (reactionPoints.empty()) {
+			return;
+		}
+		fluxCounter->increment();
+		fluxTimer->start();
+		network.computeGridFluxes(gridConcs, gridFluxes, reactionPoints);
+		fluxTimer->stop();
+		reactionPoints.clear();
+	};
+
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points, which use the surface of the closest local row
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		gridConcs.extent(0), plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto yg = concs.begin(0); yg < concs.end(0); yg++) {
+		PetscInt yj = std::clamp<PetscInt>(yg, localYS, localYS + localYM - 1);
+		auto surfacePos = grid[surfacePosition[yj] + 1];
+		for (auto xi = concs.begin(1); xi < concs.end(1); xi++) {
+			IdType row = (yg - concs.begin(0)) * concs.extent(1) + xi -
+				concs.begin(1);
+			// Set the grid fraction
+			auto& fraction = gridFractions[row];
+			if (xi < 0)
+				fraction[0] = (grid[0] - surfacePos) /
+					(grid[grid.size() - 1] - surfacePos);
+			else
+				fraction[0] = ((grid[xi] + grid[xi + 1]) / 2.0 - surfacePos) /
+					(grid[grid.size() - 1] - surfacePos);
+			fraction[1] = yj / nY;
+		}
+	}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(
+		gridFractions, ftime, gridConcs, gridTemps);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points in X
 	for (auto yj = localYS; yj < localYS + localYM; yj++) {
@@ -823,7 +803,7 @@ PetscSolver2DHandler::updateConcentration(
 			 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 			// Heat condition
 			if (xi == surfacePosition[yj] && xi >= localXS &&
-				xi < localXS + localXM) {
+				xi < localXS + localXM && hasTerm(temperatureTerm)) {
 				// Compute the old and new array offsets
 				auto concOffset = subview(concs, yj, xi, Kokkos::ALL).view();
 				auto updatedConcOffset =
@@ -867,20 +847,10 @@ PetscSolver2DHandler::updateConcentration(
 			auto updatedConcOffset =
 				subview(updatedConcs, yj, xi, Kokkos::ALL).view();
 
-			// Set the grid fraction
-			if (xi < 0)
-				gridPosition[0] = (grid[0] - grid[surfacePosition[yj] + 1]) /
-					(grid[grid.size() - 1] - grid[surfacePosition[yj] + 1]);
-			else
-				gridPosition[0] = ((grid[xi] + grid[xi + 1]) / 2.0 -
-									  grid[surfacePosition[yj] + 1]) /
-					(grid[grid.size() - 1] - grid[surfacePosition[yj] + 1]);
-			gridPosition[1] = yj / nY;
-
 			// Get the temperature from the temperature handler
-			temperatureHandler->setTemperature(concOffset);
-			double temp =
-				temperatureHandler->getTemperature(gridPosition, ftime);
+			IdType tempRow =
+				(yj - concs.begin(0)) * concs.extent(1) + xi - concs.begin(1);
+			double temp = gridTemps[tempRow];
 
 			// Update the network if the temperature changed
 			if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -933,7 +903,8 @@ PetscSolver2DHandler::updateConcentration(
 			}
 
 			// Compute the temperature over the locally owned part of the grid
-			if (xi >= localXS && xi < localXS + localXM) {
+			if (xi >= localXS && xi < localXS + localXM &&
+				hasTerm(temperatureTerm)) {
 				temperatureHandler->computeTemperature(ftime, concVector.data(),
 					updatedConcOffset, hxLeft, hxRight, xi, sy, yj);
 			}
@@ -1068,23 +1039,31 @@ PetscSolver2DHandler::updateConcentration(
 				continue;
 
 			// ----- Account for flux of incoming particles -----
-			fluxHandler->computeIncidentFlux(
-				ftime, concOffset, updatedConcOffset, xi, surfacePosition[yj]);
+			if (hasTerm(fluxTerm)) {
+				fluxHandler->computeIncidentFlux(ftime, concOffset,
+					updatedConcOffset, xi, surfacePosition[yj]);
+			}
 
 			// ---- Compute diffusion over the locally owned part of the grid
 			// -----
-			diffusionHandler->computeDiffusion(network,
-				core::StencilConcArray{concVector.data(), 5}, updatedConcOffset,
-				hxLeft, hxRight, xi - localXS, sy, yj - localYS);
+			if (hasTerm(diffusionTerm)) {
+				diffusionHandler->computeDiffusion(network,
+					core::StencilConcArray{concVector.data(), 5},
+					updatedConcOffset, hxLeft, hxRight, xi - localXS, sy,
+					yj - localYS);
+			}
 
 			// ---- Compute advection over the locally owned part of the grid
 			// ----- Set the grid position
 			gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-			for (auto i = 0; i < advectionHandlers.size(); i++) {
-				advectionHandlers[i]->computeAdvection(network, gridPosition,
-					core::StencilConcArray{concVector.data(), 5},
-					updatedConcOffset, hxLeft, hxRight, xi - localXS, hY,
-					yj - localYS);
+			if (hasTerm(advectionTerm)) {
+				for (auto i = 0; i < advectionHandlers.size(); i++) {
+					advectionHandlers[i]->computeAdvection(network,
+						gridPosition,
+						core::StencilConcArray{concVector.data(), 5},
+						updatedConcOffset, hxLeft, hxRight, xi - localXS, hY,
+						yj - localYS);
+				}
 			}
 
 			auto surfacePos = grid[surfacePosition[yj] + 1];
@@ -1095,13 +1074,23 @@ PetscSolver2DHandler::updateConcentration(
 
 			// ----- Compute the reaction fluxes over the locally owned part of
 			// the grid -----
-			fluxCounter->increment();
-			fluxTimer->start();
-			network.computeAllFluxes(concOffset, updatedConcOffset,
-				xi + 1 - localXS, curDepth, curSpacing);
-			fluxTimer->stop();
+			if (hasTerm(reactionTerm)) {
+				IdType concRow = (yj - concs.begin(0)) * concs.extent(1) +
+					xi - concs.begin(1);
+				IdType fluxRow = (yj - updatedConcs.begin(0)) *
+						updatedConcs.extent(1) +
+					xi - updatedConcs.begin(1);
+				reactionPoints.push_back({concRow, fluxRow,
+					IdType(xi + 1 - localXS), curDepth, curSpacing});
+			}
+		}
+
+		// The attenuation changes the rates for each Y
+		if (useAttenuation) {
+			computeReactions();
 		}
 	}
+	computeReactions();
 
 	/*
 	 Restore vectors
@@ -1145,6 +1134,33 @@ PetscSolver2DHandler::computeJacobian(
 	const double* hConcPtrVec[5];
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	auto gridConcs = getGridRows<NetworkType::GridConcentrationsView>(concs);
+
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points, which use the surface of the closest local row
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		gridConcs.extent(0), plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto yg = concs.begin(0); yg < concs.end(0); yg++) {
+		PetscInt yj = std::clamp<PetscInt>(yg, localYS, localYS + localYM - 1);
+		auto surfacePos = grid[surfacePosition[yj] + 1];
+		for (auto xi = concs.begin(1); xi < concs.end(1); xi++) {
+			IdType row = (yg - concs.begin(0)) * concs.extent(1) + xi -
+				concs.begin(1);
+			// Set the grid fraction
+			auto& fraction = gridFractions[row];
+			if (xi < 0)
+				fraction[0] = (grid[0] - surfacePos) /
+					(grid[grid.size() - 1] - surfacePos);
+			else
+				fraction[0] = ((grid[xi] + grid[xi + 1]) / 2.0 - surfacePos) /
+					(grid[grid.size() - 1] - surfacePos);
+			fraction[1] = yj / nY;
+		}
+	}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(
+		gridFractions, ftime, gridConcs, gridTemps);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
@@ -1175,9 +1191,6 @@ PetscSolver2DHandler::computeJacobian(
 				hxRight = grid[xi + 1] - grid[xi];
 			}
 
-			// Get the concentrations at this grid point
-			auto concOffset = subview(concs, yj, xi, Kokkos::ALL).view();
-
 			auto tempIndex = valIndex;
 			if (xi >= localXS && xi < localXS + localXM) {
 				int id = 0;
@@ -1196,7 +1209,7 @@ PetscSolver2DHandler::computeJacobian(
 
 			// Heat condition
 			if (xi == surfacePosition[yj] && xi >= localXS &&
-				xi < localXS + localXM) {
+				xi < localXS + localXM && hasTerm(temperatureTerm)) {
 				// Get the partial derivatives for the temperature
 				auto setValues =
 					temperatureHandler->computePartialsForTemperature(ftime,
@@ -1212,20 +1225,10 @@ PetscSolver2DHandler::computeJacobian(
 				}
 			}
 
-			// Set the grid fraction
-			if (xi < 0)
-				gridPosition[0] = (grid[0] - grid[surfacePosition[yj] + 1]) /
-					(grid[grid.size() - 1] - grid[surfacePosition[yj] + 1]);
-			else
-				gridPosition[0] = ((grid[xi] + grid[xi + 1]) / 2.0 -
-									  grid[surfacePosition[yj] + 1]) /
-					(grid[grid.size() - 1] - grid[surfacePosition[yj] + 1]);
-			gridPosition[1] = yj / nY;
-
 			// Get the temperature from the temperature handler
-			temperatureHandler->setTemperature(concOffset);
-			double temp =
-				temperatureHandler->getTemperature(gridPosition, ftime);
+			IdType tempRow =
+				(yj - concs.begin(0)) * concs.extent(1) + xi - concs.begin(1);
+			double temp = gridTemps[tempRow];
 
 			// Update the network if the temperature changed
 			if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -1246,7 +1249,8 @@ PetscSolver2DHandler::computeJacobian(
 			}
 
 			// Get the partial derivatives for the temperature
-			if (xi >= localXS && xi < localXS + localXM) {
+			if (xi >= localXS && xi < localXS + localXM &&
+				hasTerm(temperatureTerm)) {
 				auto setValues =
 					temperatureHandler->computePartialsForTemperature(ftime,
 						hConcPtrVec, tempVals, tempIndices, hxLeft, hxRight, xi,
@@ -1280,6 +1284,21 @@ PetscSolver2DHandler::computeJacobian(
 	deep_copy(subview(vals, std::make_pair(IdType{0}, localYM * localXM * 5)),
 		hTempVals);
 
+	// The partial derivatives of the reactions for all the local grid points
+	// are computed in a single kernel, the points are collected in the loop
+	std::vector<NetworkType::GridPoint> reactionPoints;
+	reactionPoints.reserve(localXM * localYM);
+	auto computeReactions = [&]() {
+		if (reactionPoints.empty()) {
+			return;
+		}
+		partialDerivativeCounter->increment();
+		partialDerivativeTimer->start();
+		network.computeGridPartials(gridConcs, vals, reactionPoints);
+		partialDerivativeTimer->stop();
+		reactionPoints.clear();
+	};
+
 	// Loop over the grid points
 	for (auto yj = localYS; yj < localYS + localYM; yj++) {
 		// Computing the trapped atom concentration is only needed for the
@@ -1369,26 +1388,28 @@ PetscSolver2DHandler::computeJacobian(
 			}
 
 			// Get the partial derivatives for the diffusion
-			diffusionHandler->computePartialsForDiffusion(network,
-				subview(vals, std::make_pair(valIndex, valIndex + 5 * nDiff)),
-				hxLeft, hxRight, xi - localXS, sy, yj - localYS);
+			if (hasTerm(diffusionTerm)) {
+				diffusionHandler->computePartialsForDiffusion(network,
+					subview(
+						vals, std::make_pair(valIndex, valIndex + 5 * nDiff)),
+					hxLeft, hxRight, xi - localXS, sy, yj - localYS);
+			}
 			valIndex += 5 * nDiff;
 
 			// Get the partial derivatives for the advection
 			// Set the grid position
 			gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
 			for (auto l = 0; l < advectionHandlers.size(); l++) {
-				advectionHandlers[l]->computePartialsForAdvection(network,
-					subview(
-						vals, std::make_pair(valIndex, valIndex + 2 * nAdvec)),
-					gridPosition, hxLeft, hxRight, xi - localXS, hY,
-					yj - localYS);
+				if (hasTerm(advectionTerm)) {
+					advectionHandlers[l]->computePartialsForAdvection(network,
+						subview(vals,
+							std::make_pair(valIndex, valIndex + 2 * nAdvec)),
+						gridPosition, hxLeft, hxRight, xi - localXS, hY,
+						yj - localYS);
+				}
 				valIndex += 2 * nAdvec;
 			}
 
-			// Get the concentations
-			auto concOffset = subview(concs, yj, xi, Kokkos::ALL).view();
-
 			// ----- Take care of the reactions for all the reactants -----
 
 			auto surfacePos = grid[surfacePosition[yj] + 1];
@@ -1398,16 +1419,21 @@ PetscSolver2DHandler::computeJacobian(
 			auto curSpacing = curXPos - prevXPos;
 
 			// Compute all the partial derivatives for the reactions
-			partialDerivativeCounter->increment();
-			partialDerivativeTimer->start();
-			network.computeAllPartials(concOffset,
-				subview(
-					vals, std::make_pair(valIndex, valIndex + nNetworkEntries)),
-				xi + 1 - localXS, curDepth, curSpacing);
-			partialDerivativeTimer->stop();
+			if (hasTerm(reactionTerm)) {
+				IdType concRow = (yj - concs.begin(0)) * concs.extent(1) +
+					xi - concs.begin(1);
+				reactionPoints.push_back({concRow, IdType(valIndex),
+					IdType(xi + 1 - localXS), curDepth, curSpacing});
+			}
 			valIndex += nNetworkEntries;
 		}
+
+		// The attenuation changes the rates for each Y
+		if (useAttenuation) {
+			computeReactions();
+		}
 	}
+	computeReactions();
 	Kokkos::fence();
 	PetscCallVoid(MatSetValuesCOO(J, vals.data(), ADD_VALUES));
 
@@ -427,29 +427,35 @@ PetscSolver3DHandler::initializeConcentration(
 			auto tsGroup = concGroup->getLastTimestepGroup();
 			assert(tsGroup);
 
-			// Loop on the full grid
-			for (auto k = 0; k < nZ; k++)
-				for (auto j = 0; j < nY; j++)
-					for (auto i = 0; i < nX; i++) {
-						// Read the concentrations from the HDF5 file
-						auto concVector = tsGroup->readGridPoint(i, j, k);
-
-						// Change the concentration only if we are on the
-						// locally owned part of the grid
-						if (i >= localXS && i < localXS + localXM &&
-							j >= localYS && j < localYS + localYM &&
-							k >= localZS && k < localZS + localZM) {
-							concOffset = concentrations[k][j][i];
-							// Loop on the concVector size
-							for (auto l = 0; l < concVector.size(); l++) {
-								concOffset[(IdType)concVector.at(l).at(0)] =
-									concVector.at(l).at(1);
-							}
-							// Get the temperature
-							double temp =
-								concVector.at(concVector.size() - 1).at(1);
-							temperature[i - localXS + 1] = temp;
+			// Read only our block of the grid in one request, the file can
+			// come from a run with a different decomposition
+			std::vector<io::XFile::TimestepGroup::GridBox> points;
+			for (auto k = localZS; k < localZS + localZM; k++)
+				for (auto j = localYS; j < localYS + localYM; j++)
+					for (auto i = localXS; i < localXS + localXM; i++) {
+						points.push_back({(int)i, (int)j, (int)k});
+					}
+			std::vector<uint32_t> offsets;
+			auto concs = tsGroup->readGridPoints(
+				*xfile, {(int)nX, (int)nY, (int)nZ}, 3, points, offsets);
+
+			// Apply the concentrations we just read.
+			auto n = 0;
+			for (auto k = localZS; k < localZS + localZM; k++)
+				for (auto j = localYS; j < localYS + localYM; j++)
+					for (auto i = localXS; i < localXS + localXM; i++, n++) {
+						concOffset = concentrations[k][j][i];
+						for (auto m = offsets[n]; m < offsets[n + 1]; m++) {
+							concOffset[concs[m].first] = concs[m].second;
+						}
+						// Get the temperature, the last value of the grid point
+						if (offsets[n + 1] == offsets[n]) {
+							throw std::runtime_error(
+								"\nThe checkpoint file has no concentration "
+								"for a local grid point.");
 						}
+						temperature[i - localXS + 1] =
+							concs[offsets[n + 1] - 1].second;
 					}
 		}
 
@@ -742,87 +748,12 @@ PetscSolver3DHandler::initGBLocation(DM& da, Vec& C)
 	return;
 }
 
-std::vector<std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-PetscSolver3DHandler::getConcVector(DM& da, Vec& C)
-{
-	// Initial declaration
-	const double* gridPointSolution = nullptr;
-
-	// Pointer for the concentration vector
-	PetscScalar**** concentrations = nullptr;
-	PetscCallContinue(DMDAVecGetArrayDOFRead(da, C, &concentrations));
-
-	// Get the network and dof
-	auto& network = getNetwork();
-	const auto dof = network.getDOF();
-
-	// Create the vector for the concentrations
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>
-		toReturn;
-
-	// Loop on the grid points
-	for (auto k = 0; k < localZM; ++k) {
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>
-			tempTempTempVector;
-		for (auto j = 0; j < localYM; ++j) {
-			std::vector<std::vector<std::pair<IdType, double>>> tempTempVector;
-			for (auto i = 0; i < localXM; ++i) {
-				gridPointSolution =
-					concentrations[localZS + k][localYS + j][localXS + i];
-
-				// Create the temporary vector for this grid point
-				std::vector<std::pair<IdType, double>> tempVector;
-				for (auto l = 0; l < dof + 1; ++l) {
-					if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-						tempVector.push_back(
-							std::make_pair(l, gridPointSolution[l]));
-					}
-				}
-				tempTempVector.push_back(tempVector);
-			}
-			tempTempTempVector.push_back(tempTempVector);
-		}
-		toReturn.push_back(tempTempTempVector);
-	}
-
-	// Restore the solutionArray
-	PetscCallContinue(DMDAVecRestoreArrayDOFRead(da, C, &concentrations));
-
-	return toReturn;
-}
-
 void
-PetscSolver3DHandler::setConcVector(DM& da, Vec& C,
-	std::vector<
-		std::vector<std::vector<std::vector<std::pair<IdType, double>>>>>&
-		concVector)
+PetscSolver3DHandler::updateNetworkTemperature(DM& da, Vec& C)
 {
 	// Pointer for the concentration vector
 	PetscScalar* gridPointSolution = nullptr;
 	PetscScalar**** concentrations = nullptr;
-	PetscCallVoid(DMDAVecGetArrayDOF(da, C, &concentrations));
-
-	// Loop on the grid points
-	for (auto k = 0; k < localZM; ++k) {
-		for (auto j = 0; j < localYM; ++j) {
-			for (auto i = 0; i < localXM; ++i) {
-				gridPointSolution =
-					concentrations[localZS + k][localYS + j][localXS + i];
-
-				// Loop on the given vector
-				for (auto l = 0; l < concVector[k][j][i].size(); l++) {
-					gridPointSolution[concVector[k][j][i][l].first] =
-						concVector[k][j][i][l].second;
-				}
-			}
-		}
-	}
-
-	/*
-	 Restore vectors
-	 */
-	PetscCallVoid(DMDAVecRestoreArrayDOF(da, C, &concentrations));
 
 	// Get the complete data array, including ghost cells to set the
 	// temperature at the ghost points
@@ -895,6 +826,56 @@ PetscSolver3DHandler::updateConcentration(
 	std::vector<double> incidentFluxVector;
 	double atomConc = 0.0, totalAtomConc = 0.0;
 
+	// The reactions of all the local grid points are computed in a single
+	// kernel, the points are collected in the loop
+	auto gridConcs = getGridRows<NetworkType::GridConcentrationsView>(concs);
+	auto gridFluxes = getGridRows<NetworkType::GridFluxesView>(updatedConcs);
+	std::vector<NetworkType::GridPoint> reactionPoints;
+	reactionPoints.reserve(localXM * localYM * localZM);
+	auto computeReactions = [&]() {
+		if (reactionPoints.empty()) {
+			return;
+		}
+		fluxCounter->increment();
+		fluxTimer->start();
+		network.computeGridFluxes(gridConcs, gridFluxes, reactionPoints);
+		fluxTimer->stop();
+		reactionPoints.clear();
+	};
+
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points, which use the surface of the closest local row
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		gridConcs.extent(0), plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto zg = concs.begin(0); zg < concs.end(0); zg++)
+		for (auto yg = concs.begin(1); yg < concs.end(1); yg++) {
+			PetscInt zk =
+				std::clamp<PetscInt>(zg, localZS, localZS + localZM - 1);
+			PetscInt yj =
+				std::clamp<PetscInt>(yg, localYS, localYS + localYM - 1);
+			auto surfacePos = grid[surfacePosition[yj][zk] + 1];
+			for (auto xi = concs.begin(2); xi < concs.end(2); xi++) {
+				IdType row = ((zg - concs.begin(0)) * concs.extent(1) + yg -
+								 concs.begin(1)) *
+						concs.extent(2) +
+					xi - concs.begin(2);
+				// Set the grid fraction
+				auto& fraction = gridFractions[row];
+				if (xi < 0)
+					fraction[0] = (grid[0] - surfacePos) /
+						(grid[grid.size() - 1] - surfacePos);
+				else
+					fraction[0] =
+						((grid[xi] + grid[xi + 1]) / 2.0 - surfacePos) /
+						(grid[grid.size() - 1] - surfacePos);
+				fraction[1] = yj / nY;
+				fraction[2] = zk / nZ;
+			}
+		}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(
+		gridFractions, ftime, gridConcs, gridTemps);
+
 	// Loop over grid points first for the temperature, including the ghost
 	// points in X
 	for (auto zk = localZS; zk < localZS + localZM; zk++)
@@ -906,7 +887,7 @@ PetscSolver3DHandler::updateConcentration(
 				 xi <= (PetscInt)localXS + (PetscInt)localXM; xi++) {
 				// Heat condition
 				if (xi == surfacePosition[yj][zk] && xi >= localXS &&
-					xi < localXS + localXM) {
+					xi < localXS + localXM && hasTerm(temperatureTerm)) {
 					// Compute the old and new array offsets
 					auto concOffset =
 						subview(concs, zk, yj, xi, Kokkos::ALL).view();
@@ -958,24 +939,12 @@ PetscSolver3DHandler::updateConcentration(
 				auto updatedConcOffset =
 					subview(updatedConcs, zk, yj, xi, Kokkos::ALL).view();
 
-				// Set the grid fraction
-				if (xi < 0)
-					gridPosition[0] =
-						(grid[0] - grid[surfacePosition[yj][zk] + 1]) /
-						(grid[grid.size() - 1] -
-							grid[surfacePosition[yj][zk] + 1]);
-				else
-					gridPosition[0] = ((grid[xi] + grid[xi + 1]) / 2.0 -
-										  grid[surfacePosition[yj][zk] + 1]) /
-						(grid[grid.size() - 1] -
-							grid[surfacePosition[yj][zk] + 1]);
-				gridPosition[1] = yj / nY;
-				gridPosition[2] = zk / nZ;
-
 				// Get the temperature from the temperature handler
-				temperatureHandler->setTemperature(concOffset);
-				double temp =
-					temperatureHandler->getTemperature(gridPosition, ftime);
+				IdType tempRow = ((zk - concs.begin(0)) * concs.extent(1) +
+									 yj - concs.begin(1)) *
+						concs.extent(2) +
+					xi - concs.begin(2);
+				double temp = gridTemps[tempRow];
 
 				// Update the network if the temperature changed
 				if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -1037,7 +1006,8 @@ PetscSolver3DHandler::updateConcentration(
 
 				// ---- Compute the temperature over the locally owned part
 				// of the grid -----
-				if (xi >= localXS && xi < localXS + localXM) {
+				if (xi >= localXS && xi < localXS + localXM &&
+					hasTerm(temperatureTerm)) {
 					temperatureHandler->computeTemperature(ftime,
 						concVector.data(), updatedConcOffset, hxLeft, hxRight,
 						xi, sy, yj, sz, zk);
@@ -1188,25 +1158,31 @@ PetscSolver3DHandler::updateConcentration(
 					continue;
 
 				// ----- Account for flux of incoming particles -----
-				fluxHandler->computeIncidentFlux(ftime, concOffset,
-					updatedConcOffset, xi, surfacePosition[yj][zk]);
+				if (hasTerm(fluxTerm)) {
+					fluxHandler->computeIncidentFlux(ftime, concOffset,
+						updatedConcOffset, xi, surfacePosition[yj][zk]);
+				}
 
 				// ---- Compute diffusion over the locally owned part of the
 				// grid -----
-				diffusionHandler->computeDiffusion(network,
-					core::StencilConcArray{concVector.data(), 7},
-					updatedConcOffset, hxLeft, hxRight, xi - localXS, sy,
-					yj - localYS, sz, zk - localZS);
+				if (hasTerm(diffusionTerm)) {
+					diffusionHandler->computeDiffusion(network,
+						core::StencilConcArray{concVector.data(), 7},
+						updatedConcOffset, hxLeft, hxRight, xi - localXS, sy,
+						yj - localYS, sz, zk - localZS);
+				}
 
 				// ---- Compute advection over the locally owned part of the
 				// grid ----- Set the grid position
 				gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
-				for (auto i = 0; i < advectionHandlers.size(); i++) {
-					advectionHandlers[i]->computeAdvection(network,
-						gridPosition,
-						core::StencilConcArray{concVector.data(), 7},
-						updatedConcOffset, hxLeft, hxRight, xi - localXS, hY,
-						yj - localYS, hZ, zk - localZS);
+				if (hasTerm(advectionTerm)) {
+					for (auto i = 0; i < advectionHandlers.size(); i++) {
+						advectionHandlers[i]->computeAdvection(network,
+							gridPosition,
+							core::StencilConcArray{concVector.data(), 7},
+							updatedConcOffset, hxLeft, hxRight, xi - localXS,
+							hY, yj - localYS, hZ, zk - localZS);
+					}
 				}
 
 				auto surfacePos = grid[surfacePosition[yj][zk] + 1];
@@ -1217,13 +1193,27 @@ PetscSolver3DHandler::updateConcentration(
 
 				// ----- Compute the reaction fluxes over the locally owned
 				// part of the grid -----
-				fluxCounter->increment();
-				fluxTimer->start();
-				network.computeAllFluxes(concOffset, updatedConcOffset,
-					xi + 1 - localXS, curDepth, curSpacing);
-				fluxTimer->stop();
+				if (hasTerm(reactionTerm)) {
+					IdType concRow = ((zk - concs.begin(0)) * concs.extent(1) +
+										 yj - concs.begin(1)) *
+							concs.extent(2) +
+						xi - concs.begin(2);
+					IdType fluxRow = ((zk - updatedConcs.begin(0)) *
+											 updatedConcs.extent(1) +
+										 yj - updatedConcs.begin(1)) *
+							updatedConcs.extent(2) +
+						xi - updatedConcs.begin(2);
+					reactionPoints.push_back({concRow, fluxRow,
+						IdType(xi + 1 - localXS), curDepth, curSpacing});
+				}
+			}
+
+			// The attenuation changes the rates for each (Y, Z)
+			if (useAttenuation) {
+				computeReactions();
 			}
 		}
+	computeReactions();
 
 	/*
 	 Restore vectors
@@ -1267,6 +1257,41 @@ PetscSolver3DHandler::computeJacobian(
 	const double* hConcPtrVec[7];
 	plsm::SpaceVector<double, 3> gridPosition{0.0, 0.0, 0.0};
 
+	auto gridConcs = getGridRows<NetworkType::GridConcentrationsView>(concs);
+
+	// Get the temperatures of all the grid points at once, including the
+	// ghost points, which use the surface of the closest local row
+	std::vector<plsm::SpaceVector<double, 3>> gridFractions(
+		gridConcs.extent(0), plsm::SpaceVector<double, 3>{0.0, 0.0, 0.0});
+	for (auto zg = concs.begin(0); zg < concs.end(0); zg++)
+		for (auto yg = concs.begin(1); yg < concs.end(1); yg++) {
+			PetscInt zk =
+				std::clamp<PetscInt>(zg, localZS, localZS + localZM - 1);
+			PetscInt yj =
+				std::clamp<PetscInt>(yg, localYS, localYS + localYM - 1);
+			auto surfacePos = grid[surfacePosition[yj][zk] + 1];
+			for (auto xi = concs.begin(2); xi < concs.end(2); xi++) {
+				IdType row = ((zg - concs.begin(0)) * concs.extent(1) + yg -
+								 concs.begin(1)) *
+						concs.extent(2) +
+					xi - concs.begin(2);
+				// Set the grid fraction
+				auto& fraction = gridFractions[row];
+				if (xi < 0)
+					fraction[0] = (grid[0] - surfacePos) /
+						(grid[grid.size() - 1] - surfacePos);
+				else
+					fraction[0] =
+						((grid[xi] + grid[xi + 1]) / 2.0 - surfacePos) /
+						(grid[grid.size() - 1] - surfacePos);
+				fraction[1] = yj / nY;
+				fraction[2] = zk / nZ;
+			}
+		}
+	std::vector<double> gridTemps;
+	temperatureHandler->getTemperatures(
+		gridFractions, ftime, gridConcs, gridTemps);
+
 	/*
 	 Loop over grid points for the temperature, including ghosts
 	 */
@@ -1299,10 +1324,6 @@ PetscSolver3DHandler::computeJacobian(
 					hxRight = grid[xi + 1] - grid[xi];
 				}
 
-				// Get the concentrations at this grid point
-				auto concOffset =
-					subview(concs, zk, yj, xi, Kokkos::ALL).view();
-
 				auto tempIndex = valIndex;
 				if (xi >= localXS && xi < localXS + localXM) {
 					int id = 0;
@@ -1324,7 +1345,7 @@ PetscSolver3DHandler::computeJacobian(
 
 				// Heat condition
 				if (xi == surfacePosition[yj][zk] && xi >= localXS &&
-					xi < localXS + localXM) {
+					xi < localXS + localXM && hasTerm(temperatureTerm)) {
 					// Get the partial derivatives for the temperature
 					auto setValues =
 						temperatureHandler->computePartialsForTemperature(ftime,
@@ -1342,24 +1363,12 @@ PetscSolver3DHandler::computeJacobian(
 					}
 				}
 
-				// Set the grid fraction
-				if (xi < 0)
-					gridPosition[0] =
-						(grid[0] - grid[surfacePosition[yj][zk] + 1]) /
-						(grid[grid.size() - 1] -
-							grid[surfacePosition[yj][zk] + 1]);
-				else
-					gridPosition[0] = ((grid[xi] + grid[xi + 1]) / 2.0 -
-										  grid[surfacePosition[yj][zk] + 1]) /
-						(grid[grid.size() - 1] -
-							grid[surfacePosition[yj][zk] + 1]);
-				gridPosition[1] = yj / nY;
-				gridPosition[2] = zk / nZ;
-
 				// Get the temperature from the temperature handler
-				temperatureHandler->setTemperature(concOffset);
-				double temp =
-					temperatureHandler->getTemperature(gridPosition, ftime);
+				IdType tempRow = ((zk - concs.begin(0)) * concs.extent(1) +
+									 yj - concs.begin(1)) *
+						concs.extent(2) +
+					xi - concs.begin(2);
+				double temp = gridTemps[tempRow];
 
 				// Update the network if the temperature changed
 				if (std::fabs(temperature[xi + 1 - localXS] - temp) > 0.1) {
@@ -1382,7 +1391,8 @@ PetscSolver3DHandler::computeJacobian(
 				}
 
 				// Get the partial derivatives for the temperature
-				if (xi >= localXS && xi < localXS + localXM) {
+				if (xi >= localXS && xi < localXS + localXM &&
+					hasTerm(temperatureTerm)) {
 					auto setValues =
 						temperatureHandler->computePartialsForTemperature(ftime,
 							hConcPtrVec, tempVals, tempIndices, hxLeft, hxRight,
@@ -1422,6 +1432,21 @@ PetscSolver3DHandler::computeJacobian(
 				  std::make_pair(IdType{0}, localZM * localYM * localXM * 7)),
 		hTempVals);
 
+	// The partial derivatives of the reactions for all the local grid points
+	// are computed in a single kernel, the points are collected in the loop
+	std::vector<NetworkType::GridPoint> reactionPoints;
+	reactionPoints.reserve(localXM * localYM * localZM);
+	auto computeReactions = [&]() {
+		if (reactionPoints.empty()) {
+			return;
+		}
+		partialDerivativeCounter->increment();
+		partialDerivativeTimer->start();
+		network.computeGridPartials(gridConcs, vals, reactionPoints);
+		partialDerivativeTimer->stop();
+		reactionPoints.clear();
+	};
+
 	// Loop over the grid points
 	for (auto zk = localZS; zk < localZS + localZM; zk++) {
 		for (auto yj = localYS; yj < localYS + localYM; yj++) {
@@ -1519,29 +1544,31 @@ PetscSolver3DHandler::computeJacobian(
 				}
 
 				// Get the partial derivatives for the diffusion
-				diffusionHandler->computePartialsForDiffusion(network,
-					subview(
-						vals, std::make_pair(valIndex, valIndex + 7 * nDiff)),
-					hxLeft, hxRight, xi - localXS, sy, yj - localYS, sz,
-					zk - localZS);
+				if (hasTerm(diffusionTerm)) {
+					diffusionHandler->computePartialsForDiffusion(network,
+						subview(vals,
+							std::make_pair(valIndex, valIndex + 7 * nDiff)),
+						hxLeft, hxRight, xi - localXS, sy, yj - localYS, sz,
+						zk - localZS);
+				}
 				valIndex += 7 * nDiff;
 
 				// Get the partial derivatives for the advection
 				// Set the grid position
 				gridPosition[0] = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1];
 				for (auto l = 0; l < advectionHandlers.size(); l++) {
-					advectionHandlers[l]->computePartialsForAdvection(network,
-						subview(vals,
-							std::make_pair(valIndex, valIndex + 2 * nAdvec)),
-						gridPosition, hxLeft, hxRight, xi - localXS, hY,
-						yj - localYS, hZ, zk - localZS);
+					if (hasTerm(advectionTerm)) {
+						advectionHandlers[l]->computePartialsForAdvection(
+							network,
+							subview(vals,
+								std::make_pair(
+									valIndex, valIndex + 2 * nAdvec)),
+							gridPosition, hxLeft, hxRight, xi - localXS, hY,
+							yj - localYS, hZ, zk - localZS);
+					}
 					valIndex += 2 * nAdvec;
 				}
 
-				// Get the concentration
-				auto concOffset =
-					subview(concs, zk, yj, xi, Kokkos::ALL).view();
-
 				// ----- Take care of the reactions for all the reactants
 				// -----
 
@@ -1552,17 +1579,24 @@ PetscSolver3DHandler::computeJacobian(
 				auto curSpacing = curXPos - prevXPos;
 
 				// Compute all the partial derivatives for the reactions
-				partialDerivativeCounter->increment();
-				partialDerivativeTimer->start();
-				network.computeAllPartials(concOffset,
-					subview(vals,
-						std::make_pair(valIndex, valIndex + nNetworkEntries)),
-					xi + 1 - localXS, curDepth, curSpacing);
-				partialDerivativeTimer->stop();
+				if (hasTerm(reactionTerm)) {
+					IdType concRow = ((zk - concs.begin(0)) * concs.extent(1) +
+										 yj - concs.begin(1)) *
+							concs.extent(2) +
+						xi - concs.begin(2);
+					reactionPoints.push_back({concRow, IdType(valIndex),
+						IdType(xi + 1 - localXS), curDepth, curSpacing});
+				}
 				valIndex += nNetworkEntries;
 			}
+
+			// The attenuation changes the rates for each (Y, Z)
+			if (useAttenuation) {
+				computeReactions();
+			}
 		}
 	}
+	computeReactions();
 	Kokkos::fence();
 	PetscCallVoid(MatSetValuesCOO(J, vals.data(), ADD_VALUES));
 
@@ -54,6 +54,8 @@ SolverHandler::SolverHandler(NetworkType& _network,
 	rngSeed(0),
 	heVRatio(4.0),
 	previousTime(0.0),
+	rhsTerms(allTerms),
+	temperatureDecoupled(false),
 	nXeGB(0.0),
 	gridType(""),
 	gridFileName(""),
@@ -0,0 +1,155 @@
+#include <hdf5.h>
+
+#include <algorithm>
+
+#include <xolotl/solver/monitor/CheckpointWriter.h>
+#include <xolotl/util/Log.h>
+#include <xolotl/util/MPIUtils.h>
+
+namespace xolotl
+{
+namespace solver
+{
+namespace monitor
+{
+CheckpointWriter::CheckpointWriter(bool async, std::size_t nBuffers) :
+	_async(false),
+	_capacity(std::max<std::size_t>(nBuffers, 1)),
+	_comm(util::getMPIComm()),
+	_pending(0),
+	_stop(false)
+{
+	if (not async) {
+		return;
+	}
+
+	// Check that the writes can be done from another thread
+	int threadLevel;
+	MPI_Query_thread(&threadLevel);
+	hbool_t threadSafe = 0;
+	H5is_library_threadsafe(&threadSafe);
+	if (threadLevel < MPI_THREAD_MULTIPLE or not threadSafe) {
+		if (util::getMPIRank() == 0) {
+			XOLOTL_LOG_WARN
+				<< "WARNING: (CheckpointWriter) asynchronous writes need "
+				   "MPI_THREAD_MULTIPLE and a thread-safe HDF5, the "
+				   "checkpoints will be written synchronously.";
+		}
+		return;
+	}
+
+	// The background writes use their own communicator
+	MPI_Comm_dup(util::getMPIComm(), &_comm);
+	_async = true;
+	_thread = std::thread(&CheckpointWriter::run, this);
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+	if (not _async) {
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_stop = true;
+	}
+	_condition.notify_all();
+	_thread.join();
+
+	int finalized;
+	MPI_Finalized(&finalized);
+	if (not finalized) {
+		MPI_Comm_free(&_comm);
+	}
+}
+
+void
+CheckpointWriter::waitForSlot()
+{
+	if (not _async) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this] { return _pending < _capacity or _error; });
+	lock.unlock();
+	rethrow();
+}
+
+void
+CheckpointWriter::submit(Task task)
+{
+	if (not _async) {
+		task(_comm);
+		return;
+	}
+
+	waitForSlot();
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		_tasks.push_back(std::move(task));
+		++_pending;
+	}
+	_condition.notify_all();
+}
+
+void
+CheckpointWriter::wait()
+{
+	if (not _async) {
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this] { return _pending == 0 or _error; });
+	lock.unlock();
+	rethrow();
+}
+
+void
+CheckpointWriter::run()
+{
+	while (true) {
+		Task task;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_condition.wait(lock, [this] { return _stop or !_tasks.empty(); });
+			if (_tasks.empty()) {
+				return;
+			}
+			task = std::move(_tasks.front());
+			_tasks.pop_front();
+		}
+
+		try {
+			task(_comm);
+		}
+		catch (...) {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_error = std::current_exception();
+		}
+
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			--_pending;
+		}
+		_condition.notify_all();
+	}
+}
+
+void
+CheckpointWriter::rethrow()
+{
+	std::exception_ptr error;
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+		std::swap(error, _error);
+	}
+	if (error) {
+		std::rethrow_exception(error);
+	}
+}
+} /* namespace monitor */
+} /* namespace solver */
+} /* namespace xolotl */
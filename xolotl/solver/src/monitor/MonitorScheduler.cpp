@@ -0,0 +1,125 @@
+#include <xolotl/perf/ScopedTimer.h>
+#include <xolotl/solver/monitor/MonitorScheduler.h>
+#include <xolotl/util/MPIUtils.h>
+
+namespace xolotl
+{
+namespace solver
+{
+namespace monitor
+{
+MonitorScheduler::MonitorScheduler(
+	std::shared_ptr<perf::IPerfHandler> perfHandler) :
+	_perfHandler(perfHandler),
+	_current(nullptr)
+{
+}
+
+PetscErrorCode
+MonitorScheduler::add(
+	TS ts, const std::string& name, MonitorFunction monitor, void* ctx)
+{
+	PetscFunctionBeginUser;
+
+	auto entry = std::make_unique<Entry>();
+	entry->scheduler = this;
+	entry->name = name;
+	entry->monitor = monitor;
+	entry->ctx = ctx;
+	entry->everySteps = 0;
+	entry->everyTime = 0.0;
+	entry->everyWall = 0.0;
+	entry->timer = _perfHandler->getTimer("monitor:" + name);
+	entry->hasRun = false;
+	entry->previousTime = 0.0;
+
+	// Read the cadence
+	auto prefix = "-" + name;
+	PetscCall(PetscOptionsGetInt(NULL, NULL,
+		(prefix + "_every_steps").c_str(), &entry->everySteps, NULL));
+	PetscCall(PetscOptionsGetReal(
+		NULL, NULL, (prefix + "_every_time").c_str(), &entry->everyTime, NULL));
+	PetscCall(PetscOptionsGetReal(
+		NULL, NULL, (prefix + "_every_wall").c_str(), &entry->everyWall, NULL));
+
+	PetscCall(TSMonitorSet(ts, MonitorScheduler::runEntry, entry.get(), NULL));
+	_entries.push_back(std::move(entry));
+
+	PetscFunctionReturn(0);
+}
+
+PetscReal
+MonitorScheduler::getPreviousRunTime(PetscReal defaultTime) const
+{
+	if (_current && _current->hasRun) {
+		return _current->previousTime;
+	}
+	return defaultTime;
+}
+
+bool
+MonitorScheduler::isDue(const Entry& entry, PetscInt timestep,
+	PetscReal time, bool lastStep) const
+{
+	// Every time step by default, and always the first and last times
+	if ((entry.everySteps <= 0 && entry.everyTime <= 0.0 &&
+			entry.everyWall <= 0.0) ||
+		!entry.hasRun || lastStep) {
+		return true;
+	}
+
+	if (entry.everySteps > 0 && timestep % entry.everySteps == 0) {
+		return true;
+	}
+
+	if (entry.everyTime > 0.0 && time - entry.previousTime >= entry.everyTime) {
+		return true;
+	}
+
+	if (entry.everyWall > 0.0) {
+		// The first process decides for everyone
+		int due = 0;
+		if (util::getMPIRank() == 0) {
+			std::chrono::duration<double> elapsed =
+				std::chrono::steady_clock::now() - entry.previousWall;
+			due = elapsed.count() >= entry.everyWall;
+		}
+		MPI_Bcast(&due, 1, MPI_INT, 0, util::getMPIComm());
+		return due;
+	}
+
+	return false;
+}
+
+PetscErrorCode
+MonitorScheduler::runEntry(
+	TS ts, PetscInt timestep, PetscReal time, Vec solution, void* ictx)
+{
+	PetscFunctionBeginUser;
+
+	auto entry = static_cast<Entry*>(ictx);
+	auto scheduler = entry->scheduler;
+	TSConvergedReason reason;
+	PetscCall(TSGetConvergedReason(ts, &reason));
+	bool lastStep = reason != TS_CONVERGED_ITERATING;
+	if (!scheduler->isDue(*entry, timestep, time, lastStep)) {
+		PetscFunctionReturn(0);
+	}
+
+	{
+		perf::ScopedTimer myTimer(entry->timer);
+		scheduler->_current = entry;
+		auto ierr = entry->monitor(ts, timestep, time, solution, entry->ctx);
+		scheduler->_current = nullptr;
+		PetscCall(ierr);
+	}
+
+	entry->hasRun = true;
+	entry->previousTime = time;
+	entry->previousWall = std::chrono::steady_clock::now();
+
+	PetscFunctionReturn(0);
+}
+} /* namespace monitor */
+} /* namespace solver */
+} /* namespace xolotl */
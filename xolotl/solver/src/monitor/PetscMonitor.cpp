@@ -1,6 +1,11 @@
+#include <petscvec_kokkos.hpp>
+
+#include <limits>
+
 #include <xolotl/io/XFile.h>
 #include <xolotl/perf/ScopedTimer.h>
 #include <xolotl/solver/monitor/PetscMonitor.h>
+#include <xolotl/util/Log.h>
 #include <xolotl/util/MPIUtils.h>
 
 namespace xolotl
@@ -161,14 +166,54 @@ PetscMonitor::PetscMonitor(TS ts,
 	_solverHandler(solverHandler),
 	_hdf5OutputName(checkpointFileName)
 {
-	// Create the checkpoint file if necessary
+	// The retention policy of the checkpoint file: only the last time steps
+	// are kept, plus one every few strides
+	PetscCallVoid(PetscOptionsGetInt(
+		NULL, NULL, "-checkpoint_keep", &_checkpointKeepLast, NULL));
+	PetscCallVoid(PetscOptionsGetInt(
+		NULL, NULL, "-checkpoint_keep_every", &_checkpointKeepEvery, NULL));
+
+	// Create the checkpoint file if necessary, the space of the removed time
+	// steps is then reused
 	if (this->checkForCreatingCheckpoint()) {
-		io::XFile checkpointFile(_hdf5OutputName, 1, util::getMPIComm());
+		io::XFile checkpointFile(_hdf5OutputName, 1, util::getMPIComm(),
+			io::XFile::AccessMode::CreateOrTruncateIfExists,
+			_checkpointKeepLast > 0);
 	}
+
+	// Write the checkpoints in the background if requested
+	PetscBool asyncFlag = PETSC_FALSE;
+	PetscCallVoid(
+		PetscOptionsHasName(NULL, NULL, "-async_checkpoint", &asyncFlag));
+	_checkpointWriter = std::make_unique<CheckpointWriter>(asyncFlag);
+
+	// The dense layout for the concentrations, possibly compressed
+	PetscBool denseFlag = PETSC_FALSE;
+	PetscCallVoid(
+		PetscOptionsHasName(NULL, NULL, "-checkpoint_dense", &denseFlag));
+	_denseCheckpoint = denseFlag;
+	PetscCallVoid(PetscOptionsGetInt(
+		NULL, NULL, "-checkpoint_deflate", &_checkpointDeflate, NULL));
+
+	// The diagnostic monitors run with their own cadence
+	_monitorScheduler =
+		std::make_unique<MonitorScheduler>(_solverHandler->getPerfHandler());
 }
 
 PetscMonitor::~PetscMonitor()
 {
+	// Close the checkpoint file after the last write
+	if (_checkpointWriter) {
+		try {
+			closeCheckpoint();
+		}
+		catch (const std::exception& e) {
+			XOLOTL_LOG_WARN << "WARNING: (PetscMonitor) the checkpoint file "
+							   "could not be closed: "
+							<< e.what();
+		}
+	}
+	_checkpointWriter.reset();
 }
 
 bool
@@ -219,6 +264,161 @@ PetscMonitor::writeNetwork(MPI_Comm comm, const std::string& targetFileName,
 	}
 }
 
+PetscErrorCode
+PetscMonitor::stageSolution(
+	Vec solution, std::shared_ptr<const std::vector<double>>& staged)
+{
+	PetscFunctionBeginUser;
+
+	PetscInt localSize;
+	PetscCall(VecGetLocalSize(solution, &localSize));
+	const PetscScalar* array;
+	PetscCall(VecGetArrayRead(solution, &array));
+	staged =
+		std::make_shared<const std::vector<double>>(array, array + localSize);
+	PetscCall(VecRestoreArrayRead(solution, &array));
+
+	PetscFunctionReturn(0);
+}
+
+double
+PetscMonitor::getMonitorPreviousTime() const
+{
+	auto previousTime = _solverHandler->getPreviousTime();
+	if (_monitorScheduler) {
+		previousTime = _monitorScheduler->getPreviousRunTime(previousTime);
+	}
+	return previousTime;
+}
+
+PetscErrorCode
+PetscMonitor::getLocalMaxComponent(
+	Vec solution, IdType component, double& maxValue)
+{
+	PetscFunctionBeginUser;
+
+	PetscInt blockSize;
+	PetscCall(VecGetBlockSize(solution, &blockSize));
+	ConstPetscScalarKokkosView values;
+	PetscCall(VecGetKokkosView(solution, &values));
+	const IdType nPoints = values.extent(0) / blockSize;
+
+	maxValue = -std::numeric_limits<double>::max();
+	Kokkos::parallel_reduce(
+		"PetscMonitor::getLocalMaxComponent", nPoints,
+		KOKKOS_LAMBDA(IdType i, double& localMax) {
+			auto value = values(i * blockSize + component);
+			if (value > localMax) {
+				localMax = value;
+			}
+		},
+		Kokkos::Max<double>(maxValue));
+
+	PetscCall(VecRestoreKokkosView(solution, &values));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscMonitor::clampNearZero(Vec solution, IdType nComponents, double threshold)
+{
+	PetscFunctionBeginUser;
+
+	PetscInt blockSize;
+	PetscCall(VecGetBlockSize(solution, &blockSize));
+	PetscScalarKokkosView values;
+	PetscCall(VecGetKokkosView(solution, &values));
+
+	Kokkos::parallel_for(
+		"PetscMonitor::clampNearZero", values.extent(0),
+		KOKKOS_LAMBDA(IdType n) {
+			if (n % blockSize >= nComponents) {
+				return;
+			}
+			auto& value = values(n);
+			if (value > 0.0 && value < threshold) {
+				value = threshold;
+			}
+			else if (value < 0.0 && value > -threshold) {
+				value = -threshold;
+			}
+		});
+
+	PetscCall(VecRestoreKokkosView(solution, &values));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscMonitor::sumLocalGridPoints(Vec solution,
+	const std::vector<double>& weights, Kokkos::View<double*>& sums)
+{
+	PetscFunctionBeginUser;
+
+	PetscInt blockSize;
+	PetscCall(VecGetBlockSize(solution, &blockSize));
+	ConstPetscScalarKokkosView values;
+	PetscCall(VecGetKokkosView(solution, &values));
+	const IdType nPoints = values.extent(0) / blockSize;
+	if (weights.size() != nPoints) {
+		throw std::runtime_error("\nxolotlSolver::Monitor: the number of "
+								 "weights does not match the local grid.");
+	}
+
+	// Move the weights to the device
+	auto dWeights = Kokkos::View<double*>("Weights", nPoints);
+	using HostUnmanaged = Kokkos::View<const double*, Kokkos::HostSpace,
+		Kokkos::MemoryUnmanaged>;
+	Kokkos::deep_copy(dWeights, HostUnmanaged(weights.data(), nPoints));
+
+	// One team per component, its threads reduce over the grid points
+	sums = Kokkos::View<double*>("Sums", blockSize);
+	auto result = sums;
+	using TeamPolicy = Kokkos::TeamPolicy<>;
+	using TeamMember = TeamPolicy::member_type;
+	Kokkos::parallel_for(
+		"PetscMonitor::sumLocalGridPoints", TeamPolicy(blockSize, Kokkos::AUTO),
+		KOKKOS_LAMBDA(const TeamMember& team) {
+			const IdType l = team.league_rank();
+			double sum = 0.0;
+			Kokkos::parallel_reduce(
+				Kokkos::TeamThreadRange(team, nPoints),
+				[&](IdType i, double& local) {
+					local += dWeights(i) * values(i * blockSize + l);
+				},
+				sum);
+			Kokkos::single(Kokkos::PerTeam(team), [&]() { result(l) = sum; });
+		});
+
+	PetscCall(VecRestoreKokkosView(solution, &values));
+
+	PetscFunctionReturn(0);
+}
+
+PetscErrorCode
+PetscMonitor::copyGridPointToHost(
+	Vec solution, IdType localPoint, std::vector<double>& values)
+{
+	PetscFunctionBeginUser;
+
+	PetscInt blockSize;
+	PetscCall(VecGetBlockSize(solution, &blockSize));
+	ConstPetscScalarKokkosView all;
+	PetscCall(VecGetKokkosView(solution, &all));
+
+	values.resize(blockSize);
+	auto point = Kokkos::subview(all,
+		std::make_pair<IdType, IdType>(
+			localPoint * blockSize, (localPoint + 1) * blockSize));
+	using HostUnmanaged =
+		Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
+	Kokkos::deep_copy(HostUnmanaged(values.data(), blockSize), point);
+
+	PetscCall(VecRestoreKokkosView(solution, &all));
+
+	PetscFunctionReturn(0);
+}
+
 PetscErrorCode
 PetscMonitor::startStop(TS ts, PetscInt timestep, PetscReal time, Vec solution)
 {
@@ -240,27 +440,16 @@ PetscMonitor::startStop(TS ts, PetscInt timestep, PetscReal time, Vec solution)
 		_hdf5Previous++;
 	}
 
-	// Gets MPI comm
-	auto xolotlComm = util::getMPIComm();
-
-	// Open the existing HDF5 file
-	io::XFile checkpointFile(
-		_hdf5OutputName, xolotlComm, io::XFile::AccessMode::OpenReadWrite);
+	// Wait if the previous checkpoints are not written yet
+	_checkpointWriter->waitForSlot();
 
 	// Get the current time step
 	double currentTimeStep;
 	PetscCall(TSGetTimeStep(ts, &currentTimeStep));
 
-	// Add a concentration time step group for the current time step.
-	auto concGroup = checkpointFile.getGroup<io::XFile::ConcentrationGroup>();
-	assert(concGroup);
-	auto tsGroup = concGroup->addTimestepGroup(
-		_ctrlStep, _loopNumber, timestep, time, previousTime, currentTimeStep);
-
-	// Save the fluence
+	// Get the fluence
 	auto fluxHandler = _solverHandler->getFluxHandler();
 	auto fluence = fluxHandler->getFluence();
-	tsGroup->writeFluence(fluence);
 
 	// Get the names of the species in the network
 	auto& network = _solverHandler->getNetwork();
@@ -270,12 +459,80 @@ PetscMonitor::startStop(TS ts, PetscInt timestep, PetscReal time, Vec solution)
 		speciesNames.push_back(network.getSpeciesName(id));
 	}
 
-	this->startStopImpl(ts, timestep, time, solution, checkpointFile,
-		tsGroup.get(), speciesNames);
+	// Snapshot the data specific to the dimension
+	CheckpointTask task;
+	PetscCall(this->startStopImpl(
+		ts, timestep, time, solution, speciesNames, task));
+
+	// Whether this time step escapes the retention policy
+	bool keep =
+		_checkpointKeepEvery > 0 and _hdf5Previous % _checkpointKeepEvery == 0;
+
+	// The write only uses copies so the solver can continue
+	auto keepLast = _checkpointKeepLast;
+	_checkpointWriter->submit([task, checkpointFile = _checkpointFile,
+								  fileName = _hdf5OutputName,
+								  ctrlStep = _ctrlStep, loop = _loopNumber,
+								  timestep, time, previousTime, currentTimeStep,
+								  fluence, keep, keepLast](MPI_Comm comm) {
+		// Open the existing HDF5 file the first time, it then stays open
+		if (not checkpointFile->file) {
+			checkpointFile->file = std::make_unique<io::XFile>(
+				fileName, comm, io::XFile::AccessMode::OpenReadWrite);
+			checkpointFile->concGroup =
+				checkpointFile->file->getGroup<io::XFile::ConcentrationGroup>();
+			assert(checkpointFile->concGroup);
+		}
+		auto& concGroup = checkpointFile->concGroup;
+
+		// Add a concentration time step group for the current time step.
+		auto tsGroup = concGroup->addTimestepGroup(
+			ctrlStep, loop, timestep, time, previousTime, currentTimeStep);
+		if (keep) {
+			tsGroup->setKept();
+		}
+
+		// Save the fluence
+		tsGroup->writeFluence(fluence);
+
+		task(*checkpointFile->file, *tsGroup, comm);
+		tsGroup.reset();
+
+		// Remove the time steps we don't need anymore
+		if (keepLast > 0) {
+			concGroup->pruneTimesteps(keepLast);
+		}
+
+		// Make sure the time step is on disk
+		checkpointFile->file->flush();
+	});
 
 	PetscFunctionReturn(0);
 }
 
+void
+PetscMonitor::waitForCheckpoints()
+{
+	if (_checkpointWriter) {
+		_checkpointWriter->wait();
+	}
+}
+
+void
+PetscMonitor::closeCheckpoint()
+{
+	if (not _checkpointWriter) {
+		return;
+	}
+
+	// The file is closed by the writes, after the queued ones
+	_checkpointWriter->submit([checkpointFile = _checkpointFile](MPI_Comm) {
+		checkpointFile->concGroup.reset();
+		checkpointFile->file.reset();
+	});
+	waitForCheckpoints();
+}
+
 PetscErrorCode
 PetscMonitor::monitorTime(
 	TS ts, PetscInt timestep, PetscReal time, Vec solution)
@@ -294,9 +551,9 @@ PetscMonitor::computeFluence(
 {
 	PetscFunctionBeginUser;
 
-	// If it's a restart
+	// If it's a restart, only the first time step needs the file
 	bool hasConcentrations = false;
-	if (_solverHandler->checkForRestart()) {
+	if (timestep == 0 and _solverHandler->checkForRestart()) {
 		auto restartFilePath = _solverHandler->getRestartFilePath();
 		auto networkFile = std::make_unique<io::XFile>(restartFilePath);
 		auto concGroup = networkFile->getGroup<io::XFile::ConcentrationGroup>();
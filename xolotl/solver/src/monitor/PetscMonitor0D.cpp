@@ -121,31 +121,33 @@ PetscMonitor0D::setup(int loop)
 		// Give it to the plot
 		_scatterPlot->setDataProvider(dataProvider);
 
-		// monitorScatter will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorScatter, this, nullptr));
+		// monitorScatter will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_1d", monitor::monitorScatter, this));
 	}
 
 	// Set the monitor to save text file of the mean concentration of bubbles
 	if (flagBubble) {
-		// monitorBubble0D will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::monitorBubble, this, nullptr));
+		// monitorBubble0D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "bubble", monitor::monitorBubble, this));
 	}
 
 	// Set the monitor to output data for Alloy
 	if (flagAlloy) {
 		_solverHandler->getNetwork().writeMonitorOutputHeader();
 
-		// computeAlloy0D will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::computeAlloy, this, nullptr));
+		// computeAlloy0D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "alloy", monitor::computeAlloy, this));
 	}
 	// Set the monitor to output data for AlphaZr
 	if (flagZr) {
 		_solverHandler->getNetwork().writeMonitorOutputHeader();
 
-		// computeAlphaZr will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::computeAlphaZr, this, nullptr));
+		// computeAlphaZr will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "alpha_zr", monitor::computeAlphaZr, this));
 	}
 
 	// Set the monitor to compute the xenon content
@@ -239,9 +241,9 @@ PetscMonitor0D::setup(int loop)
 		PetscCallVoid(PetscOptionsGetReal(
 			NULL, NULL, "-largest_conc", &_largestThreshold, &flag));
 
-		// monitorLargest1D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorLargest, this, nullptr));
+		// monitorLargest1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "largest_conc", monitor::monitorLargest, this));
 	}
 
 	// Set the monitor to save the status of the simulation in hdf5 file
@@ -275,6 +277,10 @@ PetscMonitor0D::setup(int loop)
 			// Get the MPI communicator
 			auto xolotlComm = util::getMPIComm();
 
+			// The checkpoint writes must not hold the file while it is
+			// opened here
+			closeCheckpoint();
+
 			// Create and initialize a checkpoint file.
 			// We do this in its own scope so that the file
 			// is closed when the file object goes out of scope.
@@ -308,22 +314,14 @@ PetscErrorCode
 PetscMonitor0D::monitorLargest(
 	TS ts, PetscInt timestep, PetscReal time, Vec solution)
 {
-	// Initial declaration
-	double **solutionArray, *gridPointSolution;
-
 	PetscFunctionBeginUser;
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOF(da, solution, &solutionArray));
+	// Get the largest concentration of the cluster on the local grid
+	double largest;
+	PetscCall(getLocalMaxComponent(solution, _largestClusterId, largest));
 
-	// Get the pointer to the beginning of the solution data for this grid point
-	gridPointSolution = solutionArray[0];
 	// Check the concentration
-	if (gridPointSolution[_largestClusterId] > _largestThreshold) {
+	if (largest > _largestThreshold) {
 		PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
 		// Send an error
 		throw std::runtime_error(
@@ -331,55 +329,62 @@ PetscMonitor0D::monitorLargest(
 			"concentration is too high!!");
 	}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOF(da, solution, &solutionArray));
-
 	PetscFunctionReturn(0);
 }
 
 PetscErrorCode
 PetscMonitor0D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
-	Vec solution, io::XFile& checkpointFile, io::XFile::TimestepGroup* tsGroup,
-	[[maybe_unused]] const std::vector<std::string>& speciesNames)
+	Vec solution, [[maybe_unused]] const std::vector<std::string>& speciesNames,
+	CheckpointTask& task)
 {
-	// Initial declaration
-	const double **solutionArray, *gridPointSolution;
-
 	PetscFunctionBeginUser;
 
 	// Get the da from ts
 	DM da;
 	PetscCall(TSGetDM(ts, &da));
 
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOFRead(da, solution, &solutionArray));
-
-	// Get the network and dof
-	auto& network = _solverHandler->getNetwork();
-	const auto dof = network.getDOF();
-
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
-
-	// Determine the concentration values we will write.
-	io::XFile::TimestepGroup::Concs1DType concs(1);
+	// Get the number of points, there is more than one for an ensemble
+	PetscInt xs, xm, Mx;
+	PetscCall(DMDAGetCorners(da, &xs, NULL, NULL, &xm, NULL, NULL));
+	PetscCall(DMDAGetInfo(da, PETSC_IGNORE, &Mx, PETSC_IGNORE, PETSC_IGNORE,
+		PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE,
+		PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE, PETSC_IGNORE));
+
+	// Get the dof
+	const auto dof = _solverHandler->getNetwork().getDOF();
+
+	// Copy the solution
+	std::shared_ptr<const std::vector<double>> staged;
+	PetscCall(stageSolution(solution, staged));
+
+	task = [staged, xs, xm, Mx, dof, dense = _denseCheckpoint,
+			   deflate = _checkpointDeflate](io::XFile& checkpointFile,
+			   io::XFile::TimestepGroup& tsGroup, MPI_Comm) {
+		// The dense layout is written straight from the solution copy
+		if (dense) {
+			tsGroup.writeDenseConcentrations({(int)Mx, 1, 1}, {(int)xs, 0, 0},
+				{(int)xm, 1, 1}, dof + 1, staged->data(), deflate);
+			return;
+		}
 
-	// Access the solution data for the current grid point.
-	gridPointSolution = solutionArray[0];
+		// Determine the concentration values we will write.
+		io::XFile::TimestepGroup::Concs1DType concs(xm);
+		for (auto i = 0; i < xm; ++i) {
+			// Access the solution data for the current point.
+			auto gridPointSolution = staged->data() + i * (dof + 1);
 
-	for (auto l = 0; l < dof + 1; ++l) {
-		if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-			concs[0].emplace_back(l, gridPointSolution[l]);
+			for (auto l = 0; l < dof + 1; ++l) {
+				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+					concs[i].emplace_back(l, gridPointSolution[l]);
+				}
+			}
 		}
-	}
 
-	// Write our concentration data to the current timestep group
-	// in the HDF5 file.
-	// We only write the data for the grid points we own.
-	tsGroup->writeConcentrations(checkpointFile, 0, concs);
-
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray));
+		// Write our concentration data to the current timestep group
+		// in the HDF5 file.
+		// We only write the data for the points we own.
+		tsGroup.writeConcentrations(checkpointFile, xs, concs);
+	};
 
 	PetscFunctionReturn(0);
 }
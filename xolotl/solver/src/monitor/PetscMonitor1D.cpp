@@ -317,9 +317,9 @@ PetscMonitor1D::setup(int loop)
 			_scatterPlot->setDataProvider(dataProvider);
 		}
 
-		// monitorScatter1D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorScatter, this, nullptr));
+		// monitorScatter1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_1d", monitor::monitorScatter, this));
 	}
 
 	// Set the monitor to save 1D plot of many concentrations
@@ -354,8 +354,9 @@ PetscMonitor1D::setup(int loop)
 			}
 		}
 
-		// monitorSeries1D will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::monitorSeries, this, nullptr));
+		// monitorSeries1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_series", monitor::monitorSeries, this));
 	}
 
 	// Set the monitor to save performance plots (has to be in parallel)
@@ -381,17 +382,18 @@ PetscMonitor1D::setup(int loop)
 			_perfPlot->setDataProvider(dataProvider);
 		}
 
-		// monitorPerf will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::monitorPerf, this, nullptr));
+		// monitorPerf will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_perf", monitor::monitorPerf, this));
 	}
 
 	// Set the monitor to output data for AlphaZr
 	if (flagZr) {
 		network.writeMonitorOutputHeader();
 
-		// computeAlphaZr will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::computeAlphaZr, this, nullptr));
+		// computeAlphaZr will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "alpha_zr", monitor::computeAlphaZr, this));
 	}
 
 	// Set the monitor to compute the helium retention
@@ -466,9 +468,9 @@ PetscMonitor1D::setup(int loop)
 		PetscCallVoid(
 			TSMonitorSet(_ts, monitor::computeFluence, this, nullptr));
 
-		// computeHeliumRetention1D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::computeHeliumRetention, this, nullptr));
+		// computeHeliumRetention1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "helium_retention", monitor::computeHeliumRetention, this));
 
 		// Master process
 		if (procId == 0 and _loopNumber == 0) {
@@ -576,8 +578,9 @@ PetscMonitor1D::setup(int loop)
 
 	// Set the monitor to output data for TRIDYN
 	if (flagTRIDYN) {
-		// computeTRIDYN will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::computeTRIDYN, this, nullptr));
+		// computeTRIDYN will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "tridyn", monitor::computeTRIDYN, this));
 	}
 
 	// Set the monitor to output data for Alloy
@@ -586,8 +589,9 @@ PetscMonitor1D::setup(int loop)
 			network.writeMonitorOutputHeader();
 		}
 
-		// computeAlloy1D will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::computeAlloy, this, nullptr));
+		// computeAlloy1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "alloy", monitor::computeAlloy, this));
 	}
 
 	// Set the monitor to compute the temperature profile
@@ -622,9 +626,9 @@ PetscMonitor1D::setup(int loop)
 			outputFile.close();
 		}
 
-		// computeCumulativeHelium1D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::profileTemperature, this, nullptr));
+		// computeCumulativeHelium1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "temp_profile", monitor::profileTemperature, this));
 	}
 
 	// Set the monitor to monitor the concentration of the largest cluster
@@ -637,9 +641,9 @@ PetscMonitor1D::setup(int loop)
 		PetscCallVoid(PetscOptionsGetReal(
 			NULL, NULL, "-largest_conc", &_largestThreshold, &flag));
 
-		// monitorLargest1D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorLargest, this, nullptr));
+		// monitorLargest1D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "largest_conc", monitor::monitorLargest, this));
 	}
 
 	// Set the monitor to save the status of the simulation in hdf5 file
@@ -665,6 +669,10 @@ PetscMonitor1D::setup(int loop)
 		// Don't do anything if both files have the same name
 		if (_hdf5OutputName != _solverHandler->getRestartFilePath() and
 			_loopNumber == 0) {
+			// The checkpoint writes must not hold the file while it is
+			// opened here
+			closeCheckpoint();
+
 			// Create and initialize a checkpoint file.
 			// We do this in its own scope so that the file
 			// is closed when the file object goes out of scope.
@@ -698,50 +706,30 @@ PetscErrorCode
 PetscMonitor1D::monitorLargest(
 	TS ts, PetscInt timestep, PetscReal time, Vec solution)
 {
-	// Initial declaration
-	double **solutionArray, *gridPointSolution;
-	IdType xs, xm, Mx, ys, ym, My, zs, zm, Mz;
-
 	PetscFunctionBeginUser;
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOF(da, solution, &solutionArray));
+	// Get the largest concentration of the cluster on the local grid
+	double largest;
+	PetscCall(getLocalMaxComponent(solution, _largestClusterId, largest));
 
-	// Get local coordinates
-	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
-
-	// Loop on the local grid
-	for (auto i = xs; i < xs + xm; i++) {
-		// Get the pointer to the beginning of the solution data for this grid
-		// point
-		gridPointSolution = solutionArray[i];
-		// Check the concentration
-		if (gridPointSolution[_largestClusterId] > _largestThreshold) {
-			PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
-			// Send an error
-			throw std::runtime_error(
-				"\nxolotlSolver::Monitor1D: The largest cluster "
-				"concentration is too high!!");
-		}
+	// Check the concentration
+	if (largest > _largestThreshold) {
+		PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
+		// Send an error
+		throw std::runtime_error(
+			"\nxolotlSolver::Monitor1D: The largest cluster "
+			"concentration is too high!!");
 	}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOF(da, solution, &solutionArray));
-
 	PetscFunctionReturn(0);
 }
 
 PetscErrorCode
 PetscMonitor1D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
-	Vec solution, io::XFile& checkpointFile, io::XFile::TimestepGroup* tsGroup,
-	const std::vector<std::string>& speciesNames)
+	Vec solution, const std::vector<std::string>& speciesNames,
+	CheckpointTask& task)
 {
 	// Initial declaration
-	const double **solutionArray, *gridPointSolution;
 	IdType xs, xm, Mx, ys, ym, My, zs, zm, Mz;
 
 	PetscFunctionBeginUser;
@@ -749,61 +737,73 @@ PetscMonitor1D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
 	// Get local coordinates
 	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOFRead(da, solution, &solutionArray));
-
 	// Get the network and dof
 	auto& network = _solverHandler->getNetwork();
 	const auto dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
+	// Copy the solution
+	std::shared_ptr<const std::vector<double>> staged;
+	PetscCall(stageSolution(solution, staged));
+
+	// Everything else that is written is copied too
+	bool writeSurface =
+		_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1;
+	bool writeBottom = _solverHandler->getRightOffset() == 1;
+	bool writeBursting = _solverHandler->burstBubbles();
+	task = [staged, xs, xm, Mx, dof, dense = _denseCheckpoint,
+			   deflate = _checkpointDeflate, speciesNames,
+			   grid = _solverHandler->getXGrid(), writeSurface,
+			   nSurf = _nSurf, surfFlux = _previousSurfFlux, writeBottom,
+			   nBulk = _nBulk, bulkFlux = _previousBulkFlux, writeBursting,
+			   nHe = _nHeliumBurst, nD = _nDeuteriumBurst,
+			   nT = _nTritiumBurst](io::XFile& checkpointFile,
+			   io::XFile::TimestepGroup& tsGroup, MPI_Comm) {
+		// Write the physical grid
+		tsGroup.writeGrid(grid);
+
+		if (writeSurface) {
+			// Write the surface positions and the associated interstitial
+			// quantities in the concentration sub group
+			tsGroup.writeSurface1D(nSurf, surfFlux, speciesNames);
+		}
 
-	// Get the physical grid and write to file
-	auto grid = _solverHandler->getXGrid();
-	tsGroup->writeGrid(grid);
+		// Write the bottom impurity information if the bottom is a free
+		// surface
+		if (writeBottom)
+			tsGroup.writeBottom1D(nBulk, bulkFlux, speciesNames);
 
-	if (_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1) {
-		// Write the surface positions and the associated interstitial
-		// quantities in the concentration sub group
-		tsGroup->writeSurface1D(_nSurf, _previousSurfFlux, speciesNames);
-	}
+		// Write the bursting information if the bubble bursting is used
+		if (writeBursting)
+			tsGroup.writeBursting(nHe, nD, nT);
 
-	// Write the bottom impurity information if the bottom is a free surface
-	if (_solverHandler->getRightOffset() == 1)
-		tsGroup->writeBottom1D(_nBulk, _previousBulkFlux, speciesNames);
-
-	// Write the bursting information if the bubble bursting is used
-	if (_solverHandler->burstBubbles())
-		tsGroup->writeBursting(_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst);
-
-	// Determine the concentration values we will write.
-	// We only examine and collect the grid points we own.
-	// TODO measure impact of us building the flattened representation
-	// rather than a ragged 2D representation.
-	io::XFile::TimestepGroup::Concs1DType concs(xm);
-	for (auto i = 0; i < xm; ++i) {
-		// Access the solution data for the current grid point.
-		auto gridPointSolution = solutionArray[xs + i];
-
-		for (auto l = 0; l < dof + 1; ++l) {
-			if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-				concs[i].emplace_back(l, gridPointSolution[l]);
-			}
+		// The dense layout is written straight from the solution copy
+		if (dense) {
+			tsGroup.writeDenseConcentrations({(int)Mx, 1, 1}, {(int)xs, 0, 0},
+				{(int)xm, 1, 1}, dof + 1, staged->data(), deflate);
+			return;
 		}
-	}
 
-	// Write our concentration data to the current timestep group
-	// in the HDF5 file.
-	// We only write the data for the grid points we own.
-	tsGroup->writeConcentrations(checkpointFile, xs, concs);
+		// Determine the concentration values we will write.
+		// We only examine and collect the grid points we own.
+		// TODO measure impact of us building the flattened representation
+		// rather than a ragged 2D representation.
+		io::XFile::TimestepGroup::Concs1DType concs(xm);
+		for (auto i = 0; i < xm; ++i) {
+			// Access the solution data for the current grid point.
+			auto gridPointSolution = staged->data() + i * (dof + 1);
+
+			for (auto l = 0; l < dof + 1; ++l) {
+				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+					concs[i].emplace_back(l, gridPointSolution[l]);
+				}
+			}
+		}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray));
+		// Write our concentration data to the current timestep group
+		// in the HDF5 file.
+		// We only write the data for the grid points we own.
+		tsGroup.writeConcentrations(checkpointFile, xs, concs);
+	};
 
 	if (auto psiNetwork =
 			dynamic_cast<core::network::IPSIReactionNetwork*>(&network))
@@ -831,10 +831,6 @@ PetscMonitor1D::computeHeliumRetention(
 	// Get the diffusion handler
 	auto diffusionHandler = _solverHandler->getDiffusionHandler();
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
 	// Get the physical grid
 	auto grid = _solverHandler->getXGrid();
 
@@ -842,57 +838,42 @@ PetscMonitor1D::computeHeliumRetention(
 	using NetworkType = core::network::IPSIReactionNetwork;
 	using AmountType = NetworkType::AmountType;
 	auto& network = dynamic_cast<NetworkType&>(_solverHandler->getNetwork());
-	const auto dof = network.getDOF();
-
-	// Get the complete data array, including ghost cells
-	Vec localSolution;
-	PetscCall(DMGetLocalVector(da, &localSolution));
-	PetscCall(DMGlobalToLocalBegin(da, solution, INSERT_VALUES, localSolution));
-	PetscCall(DMGlobalToLocalEnd(da, solution, INSERT_VALUES, localSolution));
-	// Get the array of concentration
-	PetscReal** solutionArray;
-	PetscCall(DMDAVecGetArrayDOFRead(da, localSolution, &solutionArray));
 
 	// Store the concentration over the grid
 	auto numSpecies = network.getSpeciesListSize();
 	auto specIdI = network.getInterstitialSpeciesId();
 	auto myConcData = std::vector<double>(numSpecies, 0.0);
 
-	// Declare the pointer for the concentrations at a specific grid point
-	PetscReal* gridPointSolution;
-
-	// Loop on the grid
+	// The totals are linear in the concentrations so the grid points are
+	// summed on the device first, weighted by their size (0 outside of the
+	// boundaries)
+	std::vector<double> weights(xm, 0.0);
 	for (auto xi = xs; xi < xs + xm; xi++) {
 		// Boundary conditions
 		if (xi < _solverHandler->getLeftOffset() ||
 			xi >= Mx - _solverHandler->getRightOffset())
 			continue;
 
-		// Get the pointer to the beginning of the solution data for this grid
-		// point
-		gridPointSolution = solutionArray[xi];
-
-		double hx = grid[xi + 1] - grid[xi];
-
-		using HostUnmanaged =
-			Kokkos::View<double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>;
-		auto hConcs = HostUnmanaged(gridPointSolution, dof);
-		auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-		deep_copy(dConcs, hConcs);
-
-		// Get the total concentrations at this grid point
-		using Quant = core::network::IReactionNetwork::TotalQuantity;
-		std::vector<Quant> quant;
-		quant.reserve(numSpecies);
-		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-			quant.push_back({Quant::Type::atom, id, 1});
-		}
-		auto totals = network.getTotalsVec(dConcs, quant);
-		for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-			myConcData[id()] += totals[id()] * hx;
-		}
+		weights[xi - xs] = grid[xi + 1] - grid[xi];
+	}
+	Kokkos::View<double*> dConcs;
+	PetscCall(sumLocalGridPoints(solution, weights, dConcs));
+
+	// Get the total concentrations over the local grid
+	using Quant = core::network::IReactionNetwork::TotalQuantity;
+	std::vector<Quant> quant;
+	quant.reserve(numSpecies);
+	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		quant.push_back({Quant::Type::atom, id, 1});
+	}
+	auto totals = network.getTotalsVec(dConcs, quant);
+	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		myConcData[id()] = totals[id()];
 	}
 
+	// The outgoing fluxes are computed on the host for a single grid point
+	std::vector<double> gridPointSolution;
+
 	// Get the current process ID
 	auto xolotlComm = util::getMPIComm();
 	int procId;
@@ -904,8 +885,9 @@ PetscMonitor1D::computeHeliumRetention(
 	MPI_Reduce(myConcData.data(), totalConcData.data(), numSpecies, MPI_DOUBLE,
 		MPI_SUM, 0, xolotlComm);
 
-	// Get the delta time from the previous timestep to this timestep
-	double previousTime = _solverHandler->getPreviousTime();
+	// Get the delta time from the previous run of this monitor, it may not
+	// run at every time step
+	double previousTime = getMonitorPreviousTime();
 	double dt = time - previousTime;
 
 	// Look at the fluxes leaving the free surface
@@ -928,9 +910,9 @@ PetscMonitor1D::computeHeliumRetention(
 			}
 			auto myFluxData = std::vector<double>(numSpecies, 0.0);
 
-			// Get the pointer to the beginning of the solution data for this
-			// grid point
-			gridPointSolution = solutionArray[xi];
+			// Get the solution data for this grid point
+			PetscCall(
+				copyGridPointToHost(solution, xi - xs, gridPointSolution));
 
 			// Factor for finite difference
 			double hxLeft = 0.0, hxRight = 0.0;
@@ -951,8 +933,8 @@ PetscMonitor1D::computeHeliumRetention(
 			// Get the vector of diffusing clusters
 			auto diffusingIds = diffusionHandler->getDiffusingIds();
 
-			network.updateOutgoingDiffFluxes(
-				gridPointSolution, factor, diffusingIds, myFluxData, xi - xs);
+			network.updateOutgoingDiffFluxes(gridPointSolution.data(), factor,
+				diffusingIds, myFluxData, xi - xs);
 
 			// Take into account the surface advection
 			// Get the surface advection handler
@@ -964,7 +946,7 @@ PetscMonitor1D::computeHeliumRetention(
 			double distance = (grid[xi] + grid[xi + 1]) / 2.0 - grid[1] -
 				advecHandler->getLocation();
 
-			network.updateOutgoingAdvecFluxes(gridPointSolution,
+			network.updateOutgoingAdvecFluxes(gridPointSolution.data(),
 				3.0 /
 					(core::kBoltzmann * distance * distance * distance *
 						distance),
@@ -1023,9 +1005,9 @@ PetscMonitor1D::computeHeliumRetention(
 			}
 			auto myFluxData = std::vector<double>(numSpecies, 0.0);
 
-			// Get the pointer to the beginning of the solution data for this
-			// grid point
-			gridPointSolution = solutionArray[xi];
+			// Get the solution data for this grid point
+			PetscCall(
+				copyGridPointToHost(solution, xi - xs, gridPointSolution));
 
 			// Factor for finite difference
 			double hxLeft = 0.0, hxRight = 0.0;
@@ -1046,8 +1028,8 @@ PetscMonitor1D::computeHeliumRetention(
 			// Get the vector of diffusing clusters
 			auto diffusingIds = diffusionHandler->getDiffusingIds();
 
-			network.updateOutgoingDiffFluxes(
-				gridPointSolution, factor, diffusingIds, myFluxData, xi - xs);
+			network.updateOutgoingDiffFluxes(gridPointSolution.data(), factor,
+				diffusingIds, myFluxData, xi - xs);
 
 			for (auto i = 0; i < numSpecies; ++i) {
 				_previousBulkFlux[i] = myFluxData[i];
@@ -1136,10 +1118,6 @@ PetscMonitor1D::computeHeliumRetention(
 		}
 	}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOFRead(da, localSolution, &solutionArray));
-	PetscCall(DMRestoreLocalVector(da, &localSolution));
-
 	PetscFunctionReturn(0);
 }
 
@@ -1995,47 +1973,13 @@ PetscErrorCode
 PetscMonitor1D::checkNegative(
 	TS ts, PetscInt timestep, PetscReal time, Vec solution)
 {
-	// Initial declaration
-	double **solutionArray, *gridPointSolution;
-	IdType xs, xm, Mx, ys, ym, My, zs, zm, Mz;
-
 	PetscFunctionBeginUser;
 
 	perf::ScopedTimer myTimer(_checkNegativeTimer);
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOF(da, solution, &solutionArray));
-
-	// Get local coordinates
-	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
-
-	// Get the network and dof
-	auto& network = _solverHandler->getNetwork();
-	const auto nClusters = network.getNumClusters();
-
-	// Loop on the local grid
-	for (auto i = xs; i < xs + xm; i++) {
-		// Get the pointer to the beginning of the solution data for this grid
-		// point
-		gridPointSolution = solutionArray[i]; // Loop on the concentrations
-		for (auto l = 0; l < nClusters; l++) {
-			if (gridPointSolution[l] < _negThreshold &&
-				gridPointSolution[l] > 0.0) {
-				gridPointSolution[l] = _negThreshold;
-			}
-			else if (gridPointSolution[l] > -_negThreshold &&
-				gridPointSolution[l] < 0.0) {
-				gridPointSolution[l] = -_negThreshold;
-			}
-		}
-	}
-
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOF(da, solution, &solutionArray));
+	// Only the cluster concentrations are checked, not the temperature
+	const auto nClusters = _solverHandler->getNetwork().getNumClusters();
+	PetscCall(clampNearZero(solution, nClusters, _negThreshold));
 
 	PetscFunctionReturn(0);
 }
@@ -2051,9 +1995,6 @@ PetscMonitor1D::computeTRIDYN(
 
 	perf::ScopedTimer myTimer(_tridynTimer);
 
-	// Get the MPI communicator
-	auto xolotlComm = util::getMPIComm();
-
 	// Get local coordinates
 	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
 
@@ -2078,26 +2019,11 @@ PetscMonitor1D::computeTRIDYN(
 	PetscReal** solutionArray;
 	PetscCall(DMDAVecGetArrayDOFRead(da, localSolution, &solutionArray));
 
-	// Save current concentrations as an HDF5 file.
-	//
-	// First create the file for parallel file access.
-	std::ostringstream tdFileStr;
-	tdFileStr << "TRIDYN_" << timestep << ".h5";
-	io::HDF5File tdFile(tdFileStr.str(),
-		io::HDF5File::AccessMode::CreateOrTruncateIfExists, xolotlComm, true);
-
-	// Define a dataset for concentrations.
-	// Everyone must create the dataset with the same shape.
+	// Save current concentrations as an HDF5 file, every process writes the
+	// same shape.
 	const auto numValsPerGridpoint = 5 + 2;
 	const auto firstIdxToWrite = (_solverHandler->getLeftOffset());
 	const auto numGridpointsWithConcs = (Mx - firstIdxToWrite);
-	io::HDF5File::SimpleDataSpace<2>::Dimensions concsDsetDims = {
-		(hsize_t)numGridpointsWithConcs, numValsPerGridpoint};
-	io::HDF5File::SimpleDataSpace<2> concsDsetSpace(concsDsetDims);
-
-	const std::string concsDsetName = "concs";
-	io::HDF5File::DataSet<double> concsDset(
-		tdFile, concsDsetName, concsDsetSpace);
 
 	// Specify the concentrations we will write.
 	// We only consider our own grid points.
@@ -2150,10 +2076,29 @@ PetscMonitor1D::computeTRIDYN(
 		}
 	}
 
-	// Write the concs dataset in parallel.
+	// Write the concs dataset in parallel, with the checkpoint writes so
+	// that no other collective HDF5 call can run at the same time.
 	// (We write only our part.)
-	concsDset.parWrite2D<numValsPerGridpoint>(
-		xolotlComm, myFirstIdxToWrite - firstIdxToWrite, myConcs);
+	std::ostringstream tdFileStr;
+	tdFileStr << "TRIDYN_" << timestep << ".h5";
+	_checkpointWriter->submit(
+		[fileName = tdFileStr.str(), numGridpointsWithConcs,
+			offset = myFirstIdxToWrite - firstIdxToWrite,
+			myConcs = std::move(myConcs)](MPI_Comm comm) {
+			// First create the file for parallel file access.
+			io::HDF5File tdFile(fileName,
+				io::HDF5File::AccessMode::CreateOrTruncateIfExists, comm, true);
+
+			// Define a dataset for concentrations.
+			io::HDF5File::SimpleDataSpace<2>::Dimensions concsDsetDims = {
+				(hsize_t)numGridpointsWithConcs, numValsPerGridpoint};
+			io::HDF5File::SimpleDataSpace<2> concsDsetSpace(concsDsetDims);
+			const std::string concsDsetName = "concs";
+			io::HDF5File::DataSet<double> concsDset(
+				tdFile, concsDsetName, concsDsetSpace);
+
+			concsDset.parWrite2D<numValsPerGridpoint>(comm, offset, myConcs);
+		});
 
 	// Restore the solutionArray
 	PetscCall(DMDAVecRestoreArrayDOFRead(da, localSolution, &solutionArray));
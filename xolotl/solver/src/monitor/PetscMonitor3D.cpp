@@ -262,8 +262,9 @@ PetscMonitor3D::setup(int loop)
 			_perfPlot->setDataProvider(dataProvider);
 		}
 
-		// monitorPerf will be called at each timestep
-		PetscCallVoid(TSMonitorSet(_ts, monitor::monitorPerf, this, nullptr));
+		// monitorPerf will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_perf", monitor::monitorPerf, this));
 	}
 
 	// Set the monitor to compute the helium fluence for the retention
@@ -337,9 +338,9 @@ PetscMonitor3D::setup(int loop)
 		PetscCallVoid(
 			TSMonitorSet(_ts, monitor::computeFluence, this, nullptr));
 
-		// computeHeliumRetention3D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::computeHeliumRetention, this, nullptr));
+		// computeHeliumRetention3D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "helium_retention", monitor::computeHeliumRetention, this));
 
 		// Master process
 		if (procId == 0 and _loopNumber == 0) {
@@ -467,9 +468,9 @@ PetscMonitor3D::setup(int loop)
 			_surfacePlotXY->setDataProvider(dataProvider);
 		}
 
-		// monitorSurfaceXY will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorSurfaceXY, this, nullptr));
+		// monitorSurfaceXY will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_2d_xy", monitor::monitorSurfaceXY, this));
 	}
 
 	// Set the monitor to save surface plots of clusters concentration
@@ -497,9 +498,9 @@ PetscMonitor3D::setup(int loop)
 			_surfacePlotXZ->setDataProvider(dataProvider);
 		}
 
-		// monitorSurfaceXZ will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorSurfaceXZ, this, nullptr));
+		// monitorSurfaceXZ will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "plot_2d_xz", monitor::monitorSurfaceXZ, this));
 	}
 
 	// Set the monitor to monitor the concentration of the largest cluster
@@ -513,9 +514,9 @@ PetscMonitor3D::setup(int loop)
 		PetscCallVoid(PetscOptionsGetReal(
 			NULL, NULL, "-largest_conc", &_largestThreshold, &flag));
 
-		// monitorLargest3D will be called at each timestep
-		PetscCallVoid(
-			TSMonitorSet(_ts, monitor::monitorLargest, this, nullptr));
+		// monitorLargest3D will be called with its cadence
+		PetscCallVoid(_monitorScheduler->add(
+			_ts, "largest_conc", monitor::monitorLargest, this));
 	}
 
 	// Set the monitor to save the status of the simulation in hdf5 file
@@ -540,6 +541,10 @@ PetscMonitor3D::setup(int loop)
 		// Don't do anything if both files have the same name
 		if (_hdf5OutputName != _solverHandler->getRestartFilePath() and
 			_loopNumber == 0) {
+			// The checkpoint writes must not hold the file while it is
+			// opened here
+			closeCheckpoint();
+
 			// Create a checkpoint file.
 			// Create and initialize a checkpoint file.
 			// We do this in its own scope so that the file
@@ -574,52 +579,30 @@ PetscErrorCode
 PetscMonitor3D::monitorLargest(
 	TS ts, PetscInt timestep, PetscReal time, Vec solution)
 {
-	// Initial declaration
-	double ****solutionArray, *gridPointSolution;
-	IdType xs, xm, Mx, ys, ym, My, zs, zm, Mz;
-
 	PetscFunctionBeginUser;
 
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOF(da, solution, &solutionArray));
+	// Get the largest concentration of the cluster on the local grid
+	double largest;
+	PetscCall(getLocalMaxComponent(solution, _largestClusterId, largest));
 
-	// Get the local coordinates
-	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
-
-	// Loop on the local grid
-	for (auto k = zs; k < zs + zm; k++)
-		for (auto j = ys; j < ys + ym; j++)
-			for (auto i = xs; i < xs + xm; i++) {
-				// Get the pointer to the beginning of the solution data for
-				// this grid point
-				gridPointSolution = solutionArray[k][j][i];
-				// Check the concentration
-				if (gridPointSolution[_largestClusterId] > _largestThreshold) {
-					PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
-					// Send an error
-					throw std::runtime_error(
-						"\nxolotlSolver::Monitor3D: The largest "
-						"cluster concentration is too high!!");
-				}
-			}
-
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOF(da, solution, &solutionArray));
+	// Check the concentration
+	if (largest > _largestThreshold) {
+		PetscCall(TSSetConvergedReason(ts, TS_CONVERGED_USER));
+		// Send an error
+		throw std::runtime_error(
+			"\nxolotlSolver::Monitor3D: The largest cluster "
+			"concentration is too high!!");
+	}
 
 	PetscFunctionReturn(0);
 }
 
 PetscErrorCode
 PetscMonitor3D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
-	Vec solution, io::XFile& checkpointFile, io::XFile::TimestepGroup* tsGroup,
-	const std::vector<std::string>& speciesNames)
+	Vec solution, const std::vector<std::string>& speciesNames,
+	CheckpointTask& task)
 {
 	// Initial declarations
-	const double ****solutionArray, *gridPointSolution;
 	IdType xs, xm, Mx, ys, ym, My, zs, zm, Mz;
 
 	PetscFunctionBeginUser;
@@ -627,23 +610,13 @@ PetscMonitor3D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
 	// Get the local coordinates
 	_solverHandler->getLocalCoordinates(xs, xm, Mx, ys, ym, My, zs, zm, Mz);
 
-	// Gets the process ID (important when it is running in parallel)
-	auto xolotlComm = util::getMPIComm();
-	auto procId = util::getMPIRank();
-
-	// Get the da from ts
-	DM da;
-	PetscCall(TSGetDM(ts, &da));
-
-	// Get the solutionArray
-	PetscCall(DMDAVecGetArrayDOFRead(da, solution, &solutionArray));
-
 	// Get the network and dof
 	auto& network = _solverHandler->getNetwork();
 	const auto dof = network.getDOF();
 
-	// Create an array for the concentration
-	double concArray[dof + 1][2];
+	// Copy the solution
+	std::shared_ptr<const std::vector<double>> staged;
+	PetscCall(stageSolution(solution, staged));
 
 	// Get the vector of positions of the surface
 	std::vector<std::vector<int>> surfaceIndices;
@@ -657,87 +630,67 @@ PetscMonitor3D::startStopImpl(TS ts, PetscInt timestep, PetscReal time,
 		surfaceIndices.push_back(temp);
 	}
 
-	// Get the physical grid
-	auto grid = _solverHandler->getXGrid();
-	// Write it in the file
-	tsGroup->writeGrid(grid);
-
-	if (_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1) {
-		// Write the surface positions and the associated interstitial
-		// quantities in the concentration sub group
-		tsGroup->writeSurface3D(
-			surfaceIndices, _nSurf, _previousSurfFlux, speciesNames);
-	}
-
-	// Write the bottom impurity information if the bottom is a free surface
-	if (_solverHandler->getRightOffset() == 1)
-		tsGroup->writeBottom3D(_nBulk, _previousBulkFlux, speciesNames);
-
-	// Write the bursting information if the bubble bursting is used
-	if (_solverHandler->burstBubbles())
-		tsGroup->writeBursting(_nHeliumBurst, _nDeuteriumBurst, _nTritiumBurst);
-
-	// Loop on the full grid
-	for (auto k = 0; k < Mz; k++) {
-		for (auto j = 0; j < My; j++) {
-			for (auto i = 0; i < Mx; i++) {
-				// Wait for all the processes
-				MPI_Barrier(xolotlComm);
-
-				// Size of the concentration that will be stored
-				int concSize = -1;
-				// To save which proc has the information
-				int concId = 0;
-				// To know which process should write
-				bool write = false;
-
-				// If it is the locally owned part of the grid
-				if (i >= xs && i < xs + xm && j >= ys && j < ys + ym &&
-					k >= zs && k < zs + zm) {
-					write = true;
-					// Get the pointer to the beginning of the solution data for
-					// this grid point
-					gridPointSolution = solutionArray[k][j][i];
+	// Everything else that is written is copied too
+	bool writeSurface =
+		_solverHandler->moveSurface() || _solverHandler->getLeftOffset() == 1;
+	bool writeBottom = _solverHandler->getRightOffset() == 1;
+	bool writeBursting = _solverHandler->burstBubbles();
+	task = [staged, xs, xm, Mx, ys, ym, My, zs, zm, Mz, dof,
+			   dense = _denseCheckpoint, deflate = _checkpointDeflate,
+			   speciesNames, grid = _solverHandler->getXGrid(),
+			   hy = _solverHandler->getStepSizeY(),
+			   hz = _solverHandler->getStepSizeZ(), surfaceIndices,
+			   writeSurface, nSurf = _nSurf, surfFlux = _previousSurfFlux,
+			   writeBottom, nBulk = _nBulk, bulkFlux = _previousBulkFlux,
+			   writeBursting, nHe = _nHeliumBurst, nD = _nDeuteriumBurst,
+			   nT = _nTritiumBurst](io::XFile& checkpointFile,
+			   io::XFile::TimestepGroup& tsGroup, MPI_Comm) {
+		// Write the physical grid
+		tsGroup.writeGrid(grid, My, hy, Mz, hz);
+
+		if (writeSurface) {
+			// Write the surface positions and the associated interstitial
+			// quantities in the concentration sub group
+			tsGroup.writeSurface3D(
+				surfaceIndices, nSurf, surfFlux, speciesNames);
+		}
 
-					// Loop on the concentrations
-					for (auto l = 0; l < dof + 1; l++) {
-						if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
-							// Increase concSize
-							concSize++;
-							// Fill the concArray
-							concArray[concSize][0] = (double)l;
-							concArray[concSize][1] = gridPointSolution[l];
-						}
-					}
+		// Write the bottom impurity information if the bottom is a free
+		// surface
+		if (writeBottom)
+			tsGroup.writeBottom3D(nBulk, bulkFlux, speciesNames);
+
+		// Write the bursting information if the bubble bursting is used
+		if (writeBursting)
+			tsGroup.writeBursting(nHe, nD, nT);
+
+		// The dense layout is written straight from the solution copy
+		if (dense) {
+			tsGroup.writeDenseConcentrations({(int)Mx, (int)My, (int)Mz},
+				{(int)xs, (int)ys, (int)zs}, {(int)xm, (int)ym, (int)zm},
+				dof + 1, staged->data(), deflate);
+			return;
+		}
 
-					// Increase concSize one last time
-					concSize++;
+		// Determine the concentration values we will write.
+		// We only examine and collect the grid points we own.
+		io::XFile::TimestepGroup::Concs1DType concs(xm * ym * zm);
+		for (auto n = 0; n < concs.size(); ++n) {
+			// Access the solution data for the current grid point.
+			auto gridPointSolution = staged->data() + n * (dof + 1);
 
-					// Save the procId
-					concId = procId;
+			for (auto l = 0; l < dof + 1; ++l) {
+				if (std::fabs(gridPointSolution[l]) > 1.0e-16) {
+					concs[n].emplace_back(l, gridPointSolution[l]);
 				}
-
-				// Get which processor will send the information
-				int concProc = 0;
-				MPI_Allreduce(
-					&concId, &concProc, 1, MPI_INT, MPI_SUM, xolotlComm);
-
-				// Broadcast the size
-				MPI_Bcast(&concSize, 1, MPI_INT, concProc, xolotlComm);
-
-				// Skip the grid point if the size is 0
-				if (concSize == 0)
-					continue;
-
-				// All processes create the dataset and fill it
-				tsGroup->writeConcentrationDataset(
-					concSize, concArray, write, i, j, k);
 			}
 		}
-	}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray));
+		// Write our concentration data to the current timestep group
+		// in the HDF5 file, each grid line we own is a range of rows.
+		tsGroup.writeConcentrations(checkpointFile, {(int)Mx, (int)My, (int)Mz},
+			{(int)xs, (int)ys, (int)zs}, {(int)xm, (int)ym, (int)zm}, concs);
+	};
 
 	PetscFunctionReturn(0);
 }
@@ -769,22 +722,20 @@ PetscMonitor3D::computeHeliumRetention(
 	// Get the network
 	using NetworkType = core::network::IPSIReactionNetwork;
 	auto& network = dynamic_cast<NetworkType&>(_solverHandler->getNetwork());
-	const auto dof = network.getDOF();
 
 	// Setup step size variables
 	double hy = _solverHandler->getStepSizeY();
 	double hz = _solverHandler->getStepSizeZ();
 
-	// Get the array of concentration
-	double ****solutionArray, *gridPointSolution;
-	PetscCall(DMDAVecGetArrayDOFRead(da, solution, &solutionArray));
-
 	// Store the concentration over the grid
 	auto numSpecies = network.getSpeciesListSize();
 	auto specIdI = network.getInterstitialSpeciesId();
 	auto myConcData = std::vector<double>(numSpecies, 0.0);
 
-	// Loop on the grid
+	// The totals are linear in the concentrations so the grid points are
+	// summed on the device first, weighted by their volume (0 outside of the
+	// boundaries)
+	std::vector<double> weights(zm * ym * xm, 0.0);
 	for (auto zk = zs; zk < zs + zm; zk++) {
 		for (auto yj = ys; yj < ys + ym; yj++) {
 			// Get the surface position
@@ -796,32 +747,28 @@ PetscMonitor3D::computeHeliumRetention(
 					xi >= Mx - _solverHandler->getRightOffset())
 					continue;
 
-				// Get the pointer to the beginning of the solution data for
-				// this grid point
-				gridPointSolution = solutionArray[zk][yj][xi];
-
-				double hx = grid[xi + 1] - grid[xi];
-
-				using HostUnmanaged = Kokkos::View<double*, Kokkos::HostSpace,
-					Kokkos::MemoryUnmanaged>;
-				auto hConcs = HostUnmanaged(gridPointSolution, dof);
-				auto dConcs = Kokkos::View<double*>("Concentrations", dof);
-				deep_copy(dConcs, hConcs);
-
-				// Get the total concentrations at this grid point
-				using Quant = core::network::IReactionNetwork::TotalQuantity;
-				std::vector<Quant> quant;
-				quant.reserve(numSpecies);
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-					quant.push_back({Quant::Type::atom, id, 1});
-				}
-				auto totals = network.getTotalsVec(dConcs, quant);
-				for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
-					myConcData[id()] += totals[id()] * hx * hy * hz;
-				}
+				auto localPoint = ((zk - zs) * ym + yj - ys) * xm + xi - xs;
+				weights[localPoint] = (grid[xi + 1] - grid[xi]) * hy * hz;
 			}
 		}
 	}
+	Kokkos::View<double*> dConcs;
+	PetscCall(sumLocalGridPoints(solution, weights, dConcs));
+
+	// Get the total concentrations over the local grid
+	using Quant = core::network::IReactionNetwork::TotalQuantity;
+	std::vector<Quant> quant;
+	quant.reserve(numSpecies);
+	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		quant.push_back({Quant::Type::atom, id, 1});
+	}
+	auto totals = network.getTotalsVec(dConcs, quant);
+	for (auto id = core::network::SpeciesId(numSpecies); id; ++id) {
+		myConcData[id()] = totals[id()];
+	}
+
+	// The outgoing fluxes are computed on the host for a single grid point
+	std::vector<double> gridPointSolution;
 
 	// Get the current process ID
 	auto xolotlComm = util::getMPIComm();
@@ -834,8 +781,9 @@ PetscMonitor3D::computeHeliumRetention(
 	MPI_Reduce(myConcData.data(), totalConcData.data(), myConcData.size(),
 		MPI_DOUBLE, MPI_SUM, 0, xolotlComm);
 
-	// Get the delta time from the previous timestep to this timestep
-	double previousTime = _solverHandler->getPreviousTime();
+	// Get the delta time from the previous run of this monitor, it may not
+	// run at every time step
+	double previousTime = getMonitorPreviousTime();
 	double dt = time - previousTime;
 
 	// Look at the fluxes going in the bulk if the bottom is a free surface
@@ -865,9 +813,10 @@ PetscMonitor3D::computeHeliumRetention(
 					}
 					auto myFluxData = std::vector<double>(numSpecies, 0.0);
 
-					// Get the pointer to the beginning of the solution data for
-					// this grid point
-					gridPointSolution = solutionArray[k][j][xi];
+					// Get the solution data for this grid point
+					auto localPoint = ((k - zs) * ym + j - ys) * xm + xi - xs;
+					PetscCall(copyGridPointToHost(
+						solution, localPoint, gridPointSolution));
 
 					// Factor for finite difference
 					double hxLeft = 0.0, hxRight = 0.0;
@@ -885,8 +834,8 @@ PetscMonitor3D::computeHeliumRetention(
 					}
 					double factor = 2.0 * hy * hz / (hxLeft + hxRight);
 
-					network.updateOutgoingDiffFluxes(gridPointSolution, factor,
-						diffusingIds, myFluxData, xi - xs);
+					network.updateOutgoingDiffFluxes(gridPointSolution.data(),
+						factor, diffusingIds, myFluxData, xi - xs);
 
 					// Take into account the surface advection
 					// Get the surface advection handler
@@ -898,7 +847,7 @@ PetscMonitor3D::computeHeliumRetention(
 					double distance = (grid[xi] + grid[xi + 1]) / 2.0 -
 						grid[1] - advecHandler->getLocation();
 
-					network.updateOutgoingAdvecFluxes(gridPointSolution,
+					network.updateOutgoingAdvecFluxes(gridPointSolution.data(),
 						3.0 * hy * hz /
 							(core::kBoltzmann * distance * distance * distance *
 								distance),
@@ -963,9 +912,10 @@ PetscMonitor3D::computeHeliumRetention(
 					}
 					auto myFluxData = std::vector<double>(numSpecies, 0.0);
 
-					// Get the pointer to the beginning of the solution data for
-					// this grid point
-					gridPointSolution = solutionArray[k][j][xi];
+					// Get the solution data for this grid point
+					auto localPoint = ((k - zs) * ym + j - ys) * xm + xi - xs;
+					PetscCall(copyGridPointToHost(
+						solution, localPoint, gridPointSolution));
 
 					// Factor for finite difference
 					double hxLeft = 0.0, hxRight = 0.0;
@@ -983,8 +933,8 @@ PetscMonitor3D::computeHeliumRetention(
 					}
 					double factor = 2.0 * hy * hz / (hxLeft + hxRight);
 
-					network.updateOutgoingDiffFluxes(gridPointSolution, factor,
-						diffusingIds, myFluxData, xi - xs);
+					network.updateOutgoingDiffFluxes(gridPointSolution.data(),
+						factor, diffusingIds, myFluxData, xi - xs);
 
 					for (auto i = 0; i < numSpecies; ++i) {
 						_previousBulkFlux[i][j][k] = myFluxData[i];
@@ -1105,9 +1055,6 @@ PetscMonitor3D::computeHeliumRetention(
 		}
 	}
 
-	// Restore the solutionArray
-	PetscCall(DMDAVecRestoreArrayDOFRead(da, solution, &solutionArray));
-
 	PetscFunctionReturn(0);
 }
 
@@ -28,9 +28,12 @@ getMPIComm();
 
 /**
  * Initialize MPI with const char array
+ *
+ * @param threadMultiple Whether to ask for MPI_THREAD_MULTIPLE, only needed
+ * when several threads make MPI calls
  */
 void
-mpiInit(int& argc, const char* argv[]);
+mpiInit(int& argc, const char* argv[], bool threadMultiple = false);
 
 /**
  * Has MPI been initialized
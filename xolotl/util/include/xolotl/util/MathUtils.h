@@ -9,10 +9,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <vector>
 
 #include <Kokkos_Array.hpp>
 
@@ -82,6 +84,29 @@ equal(double a, double b)
 	return std::fabs(b - a) < epsilon<double>;
 }
 
+/**
+ * Linearly interpolate a table of values, the first and last values are kept
+ * outside of the table. The interval is found by binary search.
+ *
+ * @param xs The abscissas, sorted in increasing order
+ * @param ys The values at the abscissas
+ * @param x The abscissa where to interpolate
+ * @return The interpolated value
+ */
+inline double
+interpolateTable(
+	const std::vector<double>& xs, const std::vector<double>& ys, double x)
+{
+	if (x <= xs.front())
+		return ys.front();
+	if (x >= xs.back())
+		return ys.back();
+
+	// The first interval containing x, xs[k] < x <= xs[k + 1]
+	auto k = std::lower_bound(xs.begin(), xs.end(), x) - xs.begin() - 1;
+	return ys[k] + (ys[k + 1] - ys[k]) * (x - xs[k]) / (xs[k + 1] - xs[k]);
+}
+
 /**
  * This operation computes the Legendre polynomial, P_n (x), of degree n.
  *
@@ -25,10 +25,17 @@ getMPIComm()
 }
 
 void
-mpiInit(int& argc, const char* argv[])
+mpiInit(int& argc, const char* argv[], bool threadMultiple)
 {
 	auto ncargv = const_cast<char**>(argv);
-	MPI_Init(&argc, &ncargv);
+	if (not threadMultiple) {
+		MPI_Init(&argc, &ncargv);
+		return;
+	}
+
+	// The level actually provided is checked by the users of the threads
+	int provided;
+	MPI_Init_thread(&argc, &ncargv, MPI_THREAD_MULTIPLE, &provided);
 }
 
 bool